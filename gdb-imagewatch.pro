@@ -30,13 +30,23 @@ QMAKE_LFLAGS += \
 
 SOURCES += \
   src/giw_window.cpp \
+  src/concurrency/task_scheduler.cpp \
   src/debuggerinterface/buffer_request_message.cpp \
   src/debuggerinterface/managed_pointer.cpp \
+  src/debuggerinterface/python_module.cpp \
   src/debuggerinterface/python_native_interface.cpp \
   src/io/buffer_exporter.cpp \
+  src/io/plot_capture.cpp \
+  src/io/settings_writer.cpp \
   src/math/assorted.cpp \
+  src/math/buffer_statistics.cpp \
   src/math/linear_algebra.cpp \
+  src/math/simd_dispatch.cpp \
+  src/profiling/metrics.cpp \
+  src/profiling/tracer.cpp \
   src/ui/gl_canvas.cpp \
+  src/ui/interaction_benchmark.cpp \
+  src/ui/memory_usage_panel.cpp \
   src/ui/symbol_completer.cpp \
   src/ui/symbol_search_input.cpp \
   src/ui/main_window/main_window.cpp \
@@ -46,6 +56,7 @@ SOURCES += \
   src/visualization/events.cpp \
   src/visualization/game_object.cpp \
   src/visualization/shader.cpp \
+  src/visualization/software_renderer.cpp \
   src/visualization/stage.cpp \
   src/visualization/components/background.cpp \
   src/visualization/components/buffer.cpp \
@@ -59,6 +70,8 @@ SOURCES += \
   src/visualization/shaders/text_fs.cpp \
   src/visualization/shaders/text_vs.cpp \
   src/ui/gl_text_renderer.cpp \
+  src/ui/gl_texture_pool.cpp \
+  src/ui/glyph_atlas.cpp \
   src/ui/go_to_widget.cpp \
   src/ui/decorated_line_edit.cpp
 
@@ -66,7 +79,9 @@ SOURCES += \
 HEADERS += \
   src/debuggerinterface/preprocessor_directives.h \
   src/ui/gl_canvas.h \
+  src/ui/interaction_benchmark.h \
   src/ui/main_window/main_window.h \
+  src/ui/memory_usage_panel.h \
   src/ui/symbol_completer.h \
   src/ui/symbol_search_input.h \
   src/ui/gl_text_renderer.h \
@@ -4,8 +4,14 @@
 
 """
 GDB-ImageWatch entry point. Can be called with --test for opening the watcher
-window with a couple of sample buffers; otherwise, should be invoked by the
-debugger (GDB).
+window with a couple of sample buffers, with --benchmark-interaction for
+measuring the pan/zoom latency, with --benchmark-calls for measuring the
+overhead of the calls into the native library, with --benchmark-restore for
+measuring the time taken to restore a previous session, with --replay for
+reproducing a session recorded with giw-capture, with --connect for showing
+the buffers served by the giw-agent command of a remote debugger, or with
+--open for showing buffers dumped to .npy files or exported as raw matrices;
+otherwise, should be invoked by the debugger (GDB).
 """
 
 import argparse
@@ -39,8 +45,12 @@ def main():
     sys.path.append(script_path)
 
     # Load dependency modules
+    from giwscripts import benchmark
     from giwscripts import events
+    from giwscripts import fileview
     from giwscripts import giwwindow
+    from giwscripts import remote
+    from giwscripts import replay
     from giwscripts import test
     from giwscripts.ides import qtcreator
 
@@ -48,11 +58,67 @@ def main():
     parser.add_argument('--test',
                         help='Open a test window with sample buffers',
                         action='store_true')
+    parser.add_argument('--benchmark-interaction',
+                        metavar='REPORT',
+                        help='Replay synthetic pan/zoom input on large sample '
+                             'buffers and write the latency report to REPORT')
+    parser.add_argument('--benchmark-calls',
+                        metavar='N',
+                        type=int,
+                        help='Measure the average duration of N calls to the '
+                             'native library with the extension module and '
+                             'with ctypes')
+    parser.add_argument('--benchmark-restore',
+                        help='Measure the time to the first interactive frame '
+                             'when restoring %d buffers of a previous session'
+                             % benchmark.BENCHMARK_RESTORE_COUNT,
+                        action='store_true')
+    parser.add_argument('--replay',
+                        metavar='CAPTURE',
+                        help='Plot the buffers recorded in CAPTURE with the '
+                             'giw-capture command')
+    parser.add_argument('--max-speed',
+                        help='With --replay, ignore the recorded timing and '
+                             'exit once all buffers were plotted',
+                        action='store_true')
+    parser.add_argument('--connect',
+                        metavar='[HOST:]PORT',
+                        help='Show the buffers served by the agent started '
+                             'with giw-agent listen in a (remote) debugger')
+    parser.add_argument('--bandwidth-limit',
+                        metavar='RATE',
+                        type=remote.parse_bandwidth,
+                        help='With --connect, throttle the connection to RATE '
+                             'bytes per second (e.g. 500K or 2M), to simulate '
+                             'a slow link over the loopback interface')
+    parser.add_argument('--open',
+                        metavar='FILE',
+                        nargs='+',
+                        help='Show the buffers stored in .npy files or in raw '
+                             'matrices exported by the window')
     args = parser.parse_args()
 
     if args.test:
         # Test application
         test.giwtest(script_path)
+    elif args.benchmark_interaction:
+        # Interaction latency benchmark
+        benchmark.giwbenchmark(script_path, args.benchmark_interaction)
+    elif args.benchmark_calls:
+        # Call overhead benchmark
+        benchmark.giwbenchmark_calls(script_path, args.benchmark_calls)
+    elif args.benchmark_restore:
+        # Session restore benchmark
+        benchmark.giwbenchmark_restore(script_path)
+    elif args.replay:
+        # Capture replay
+        replay.giwreplay(script_path, args.replay, args.max_speed)
+    elif args.connect:
+        # Viewer of a remote agent
+        remote.giwviewer(script_path, args.connect, args.bandwidth_limit)
+    elif args.open:
+        # Viewer of buffer files
+        fileview.giwopen(script_path, args.open)
     else:
         # Setup GDB interface
         debugger = get_debugger_bridge()
@@ -0,0 +1,243 @@
+# -*- coding: utf-8 -*-
+
+"""
+Interaction latency benchmark: opens a set of large sample buffers and replays
+synthetic pan and zoom input on them (see InteractionBenchmark in the native
+library). Also measures the overhead of the calls made into the native library
+at every debugger stop, and the time taken to restore the buffers of a previous
+session.
+"""
+
+import array
+import json
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+from giwscripts import giwwindow
+from giwscripts import symbols
+from giwscripts import test
+
+# Large enough to be split in several textures (see Buffer::max_texture_size)
+BENCHMARK_BUFFER_WIDTH = 2560
+BENCHMARK_BUFFER_HEIGHT = 1600
+# Number of buffers, which are all moved together in the link-views runs
+BENCHMARK_BUFFER_COUNT = 8
+# Size of the symbol list given to set_available_symbols in the call overhead
+# benchmark
+BENCHMARK_SYMBOL_COUNT = 1000
+# Number of buffers restored from the previous session in the restore
+# benchmark
+BENCHMARK_RESTORE_COUNT = 30
+
+
+def _gen_buffers(count, width, height):
+    """
+    Generate 'count' single channel float buffers with a different ramp each
+    """
+    buffers = {}
+
+    for idx in range(count):
+        name = 'benchmark_buffer_%d' % idx
+        period = 64 * (idx + 1)
+
+        row = array.array('f', [(pos_x % period) / float(period)
+                                for pos_x in range(width)])
+        pixels = row * height
+
+        buffers[name] = {
+            'variable_name': name,
+            'display_name': 'float* ' + name,
+            'pointer': memoryview(pixels),
+            'width': width,
+            'height': height,
+            'channels': 1,
+            'type': symbols.GIW_TYPES_FLOAT32,
+            'row_stride': width,
+            'pixel_layout': 'rgba',
+            'transpose_buffer': False
+        }
+
+    return buffers
+
+
+def _print_report(report_path):
+    with open(report_path) as report_file:
+        report = json.load(report_file)
+
+    print('Interaction benchmark (%d buffers of %dx%d)' %
+          (report['stages'], BENCHMARK_BUFFER_WIDTH, BENCHMARK_BUFFER_HEIGHT))
+
+    for scenario in report['scenarios']:
+        latency = scenario['input_to_present_us']
+        frame_time = scenario['frame_time_us']
+        print('  %-24s input to present: p50=%6dus p90=%6dus p99=%6dus | '
+              'frame time: p50=%6dus p99=%6dus | missed frames: %d' %
+              (scenario['name'],
+               latency['p50'],
+               latency['p90'],
+               latency['p99'],
+               frame_time['p50'],
+               frame_time['p99'],
+               scenario['missed_frames']))
+
+
+def giwbenchmark(script_path, report_path):
+    """
+    Entry point for the interaction benchmark mode.
+    """
+    buffers = _gen_buffers(BENCHMARK_BUFFER_COUNT,
+                           BENCHMARK_BUFFER_WIDTH,
+                           BENCHMARK_BUFFER_HEIGHT)
+    dummy_debugger = test.DummyDebugger(buffers)
+
+    window = giwwindow.GdbImageWatchWindow(script_path, dummy_debugger)
+    window.initialize_window()
+
+    try:
+        # Wait for window to initialize
+        while not window.is_ready():
+            time.sleep(0.1)
+
+        for buffer in dummy_debugger.get_available_symbols():
+            window.plot_variable(buffer)
+
+        # Wait for all buffers to be uploaded
+        while len(window.get_observed_buffers()) < len(buffers):
+            time.sleep(0.1)
+
+        window.start_interaction_benchmark(report_path)
+        while window.is_interaction_benchmark_running():
+            time.sleep(0.1)
+
+        _print_report(report_path)
+
+    except KeyboardInterrupt:
+        pass
+
+    window.terminate()
+    dummy_debugger.kill()
+
+
+def _time_calls(function, num_calls):
+    """
+    Average duration, in nanoseconds, of calling 'function' num_calls times
+    """
+    start = time.perf_counter()
+    for _ in range(num_calls):
+        function()
+    return (time.perf_counter() - start) * 1e9 / num_calls
+
+
+def giwbenchmark_calls(script_path, num_calls):
+    """
+    Entry point for the call overhead benchmark mode. Compares the CPython
+    extension module against the ctypes API.
+    """
+    buffer_metadata = _gen_buffers(1, 16, 16)['benchmark_buffer_0']
+    available_symbols = ['benchmark_symbol_%d' % idx
+                         for idx in range(BENCHMARK_SYMBOL_COUNT)]
+
+    window = giwwindow.GdbImageWatchWindow(script_path, None)
+    window.initialize_window()
+
+    try:
+        # Wait for window to initialize
+        while not window.is_ready():
+            time.sleep(0.1)
+
+        print('Call overhead benchmark (%d calls)' % num_calls)
+        for use_native in [True, False]:
+            if window.set_native_module_enabled(use_native) != use_native:
+                print('  native module not available')
+                continue
+
+            plot_ns = _time_calls(
+                lambda: window._plot_buffer(buffer_metadata), num_calls)
+            symbols_ns = _time_calls(
+                lambda: window.set_available_symbols(available_symbols),
+                num_calls)
+            print('  %-8s plot_buffer: %8dns/call | '
+                  'set_available_symbols (%d symbols): %8dns/call' %
+                  ('native' if use_native else 'ctypes',
+                   plot_ns,
+                   BENCHMARK_SYMBOL_COUNT,
+                   symbols_ns))
+
+    except KeyboardInterrupt:
+        pass
+
+    window.terminate()
+
+
+def _wait_for_latency(window, stage):
+    """
+    Wait until the window has measured the latency of 'stage', and return its
+    histogram
+    """
+    while True:
+        latencies = window.get_metrics()['latencies_us']
+        if stage in latencies:
+            return latencies[stage]
+        time.sleep(0.05)
+
+
+def restore_benchmark_session(script_path, phase):
+    """
+    One of the sessions of the restore benchmark, run in a separate process:
+    'record' plots all sample buffers, so that they are saved as the previous
+    session; 'restore' simulates a debugger stop in which they are available.
+    """
+    buffers = _gen_buffers(BENCHMARK_RESTORE_COUNT,
+                           BENCHMARK_BUFFER_WIDTH,
+                           BENCHMARK_BUFFER_HEIGHT)
+    dummy_debugger = test.DummyDebugger(buffers)
+
+    window = giwwindow.GdbImageWatchWindow(script_path, dummy_debugger)
+    window.initialize_window()
+
+    while not window.is_ready():
+        time.sleep(0.1)
+
+    if phase == 'record':
+        for buffer in dummy_debugger.get_available_symbols():
+            window.plot_variable(buffer)
+
+        while len(window.get_observed_buffers()) < len(buffers):
+            time.sleep(0.1)
+
+        # Give the window time to persist its settings
+        time.sleep(1.0)
+    else:
+        window.set_available_symbols(dummy_debugger.get_available_symbols())
+
+        first_frame = _wait_for_latency(window, 'restore_first_frame')
+        restore_all = _wait_for_latency(window, 'restore_all')
+        print('Restore benchmark (%d buffers of %dx%d)' %
+              (len(buffers), BENCHMARK_BUFFER_WIDTH, BENCHMARK_BUFFER_HEIGHT))
+        print('  time to first interactive frame: %8dus' % first_frame['max'])
+        print('  time to restore all buffers:     %8dus' % restore_all['max'])
+
+    window.terminate()
+    dummy_debugger.kill()
+
+
+def giwbenchmark_restore(script_path):
+    """
+    Entry point for the session restore benchmark mode. The previous session
+    is stored in a temporary settings folder, so that the user settings are
+    not affected.
+    """
+    with tempfile.TemporaryDirectory() as config_path:
+        env = dict(os.environ, XDG_CONFIG_HOME=config_path)
+
+        for phase in ['record', 'restore']:
+            subprocess.check_call(
+                [sys.executable, '-c',
+                 'import sys; sys.path.append(%r); '
+                 'from giwscripts import benchmark; '
+                 'benchmark.restore_benchmark_session(%r, %r)' %
+                 (script_path, script_path, phase)],
+                env=env)
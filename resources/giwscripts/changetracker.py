@@ -0,0 +1,207 @@
+# -*- coding: utf-8 -*-
+
+"""
+Detection of the buffer regions modified by the debuggee between two stops,
+based on the soft-dirty page bits of the Linux kernel (see
+Documentation/admin-guide/mm/soft-dirty.rst). After a buffer is read, the
+soft-dirty bits of the debuggee are cleared; on the next stop, only the pages
+whose bit was set again have to be read.
+"""
+
+import array
+import ctypes
+import mmap
+import os
+
+PAGE_SIZE = mmap.PAGESIZE
+# Bit 55 of each /proc/<pid>/pagemap entry is the soft-dirty flag
+SOFT_DIRTY_BIT = 1 << 55
+# Value written to /proc/<pid>/clear_refs to clear the soft-dirty bits
+CLEAR_SOFT_DIRTY = b'4'
+
+
+def _read_soft_dirty_pages(pid, address, size):
+    """
+    Return a list with the soft-dirty flag of each page overlapping the range
+    [address, address + size) of process 'pid'
+    """
+    first_page = address // PAGE_SIZE
+    num_pages = (address + size - 1) // PAGE_SIZE - first_page + 1
+
+    entries = array.array('Q')
+    with open('/proc/%d/pagemap' % pid, 'rb') as pagemap:
+        pagemap.seek(first_page * entries.itemsize)
+        entries.frombytes(pagemap.read(num_pages * entries.itemsize))
+
+    if len(entries) != num_pages:
+        raise IOError('Could not read the page map of process %d' % pid)
+
+    return [(entry & SOFT_DIRTY_BIT) != 0 for entry in entries]
+
+
+def _clear_soft_dirty(pid):
+    with open('/proc/%d/clear_refs' % pid, 'wb') as clear_refs:
+        clear_refs.write(CLEAR_SOFT_DIRTY)
+
+
+def _kernel_supports_soft_dirty():
+    """
+    Kernels built without CONFIG_MEM_SOFT_DIRTY accept writes to clear_refs
+    but never set the soft-dirty bit, which would hide all modifications. We
+    check that writing to a page of our own process sets it.
+    """
+    probe = bytearray(2 * PAGE_SIZE)
+    probe_address = ctypes.addressof(ctypes.c_char.from_buffer(probe))
+    page_offset = -probe_address % PAGE_SIZE
+
+    try:
+        _clear_soft_dirty(os.getpid())
+        probe[page_offset] = 1
+        return _read_soft_dirty_pages(os.getpid(),
+                                      probe_address + page_offset,
+                                      1)[0]
+    except (IOError, OSError):
+        return False
+
+
+def is_local_process(pid, executable):
+    """
+    Check that 'pid' refers to the debuggee in this machine (and not, e.g.,
+    to an unrelated process while debugging with gdbserver)
+    """
+    try:
+        return (executable is not None and
+                os.path.realpath(os.readlink('/proc/%d/exe' % pid)) ==
+                os.path.realpath(executable))
+    except OSError:
+        return False
+
+
+class SoftDirtyTracker():
+    """
+    Reads buffers from the debuggee, only fetching the pages modified since
+    the previous stop when the kernel allows us to track them. Falls back to
+    reading the whole buffer otherwise.
+    """
+    def __init__(self):
+        self._kernel_support = None
+        self._pid = None
+        self._tracking_enabled = False
+        # Buffer contents at the last read, indexed by (address, size)
+        self._buffers = {}
+        # Buffers read since the soft-dirty bits were last cleared
+        self._read_buffers = set()
+        # Dirty page flags of each buffer in self._buffers at the current
+        # stop, or None if they weren't collected yet
+        self._dirty_pages = None
+
+    def on_stop(self):
+        """
+        Must be called whenever the debuggee stops or resumes, so that the
+        soft-dirty flags collected at a stop are never used after it
+        """
+        self._dirty_pages = None
+
+    def reset(self):
+        """
+        Forget all buffers (e.g. when the debuggee exits)
+        """
+        self._pid = None
+        self._buffers = {}
+        self._read_buffers = set()
+        self._dirty_pages = None
+
+    def read_memory(self, inferior, address, size, executable):
+        """
+        Read 'size' bytes at 'address' from 'inferior'. Returns a tuple with a
+        memoryview of the buffer contents and a list of [begin, end) byte
+        ranges modified since the previous read, or None if the whole buffer
+        must be considered modified.
+        """
+        if not self._start_tracking(inferior.pid, executable):
+            return inferior.read_memory(address, size), None
+
+        key = (address, size)
+        previous = self._buffers.get(key)
+        dirty_pages = self._dirty_pages.pop(key, None)
+
+        if previous is None or dirty_pages is None:
+            contents = inferior.read_memory(address, size)
+            dirty_ranges = None
+        else:
+            contents = bytearray(previous)
+            dirty_ranges = self._dirty_byte_ranges(address, size, dirty_pages)
+            for begin, end in dirty_ranges:
+                contents[begin:end] = inferior.read_memory(address + begin,
+                                                           end - begin)
+            # The previous contents may still be in use by the window, so we
+            # never modify them in place
+            contents = memoryview(contents)
+
+        self._buffers[key] = contents
+        self._read_buffers.add(key)
+
+        return contents, dirty_ranges
+
+    def _start_tracking(self, pid, executable):
+        """
+        Collect the soft-dirty flags of the known buffers and clear them, once
+        per stop. Returns False if the flags are not available.
+        """
+        if self._dirty_pages is not None:
+            return self._tracking_enabled
+
+        if self._kernel_support is None:
+            self._kernel_support = _kernel_supports_soft_dirty()
+
+        if pid != self._pid:
+            self.reset()
+            self._pid = pid
+            self._tracking_enabled = (self._kernel_support and
+                                      is_local_process(pid, executable))
+
+        self._dirty_pages = {}
+        if not self._tracking_enabled:
+            return False
+
+        # Buffers that are not being read anymore are forgotten
+        self._buffers = {key: contents
+                         for key, contents in self._buffers.items()
+                         if key in self._read_buffers}
+        self._read_buffers = set()
+
+        try:
+            for address, size in self._buffers:
+                self._dirty_pages[(address, size)] = _read_soft_dirty_pages(
+                    pid, address, size)
+            _clear_soft_dirty(pid)
+        except (IOError, OSError):
+            self._tracking_enabled = False
+            self._buffers = {}
+            self._dirty_pages = {}
+
+        return self._tracking_enabled
+
+    @staticmethod
+    def _dirty_byte_ranges(address, size, dirty_pages):
+        """
+        Convert the per-page dirty flags of a buffer into a list of merged
+        [begin, end) byte ranges, relative to the buffer start
+        """
+        first_page_address = address - address % PAGE_SIZE
+        ranges = []
+
+        for page_idx, is_dirty in enumerate(dirty_pages):
+            if not is_dirty:
+                continue
+
+            page_begin = first_page_address + page_idx * PAGE_SIZE
+            begin = max(page_begin, address) - address
+            end = min(page_begin + PAGE_SIZE, address + size) - address
+
+            if ranges and ranges[-1][1] == begin:
+                ranges[-1][1] = end
+            else:
+                ranges.append([begin, end])
+
+        return ranges
@@ -6,7 +6,13 @@ Code responsible with directly interacting with GDB
 
 import gdb
 
+from giwscripts import changetracker
+from giwscripts import gatherread
+from giwscripts import metrics_report
+from giwscripts import regionfetch
+from giwscripts import remote
 from giwscripts import sysinfo
+from giwscripts import tracer
 from giwscripts.debuggers.interfaces import BridgeInterface
 
 
@@ -17,13 +23,33 @@ class GdbBridge(BridgeInterface):
     """
     def __init__(self, type_bridge):
         self._type_bridge = type_bridge
-        self._commands = dict(plot=PlotterCommand(self))
+        self._change_tracker = changetracker.SoftDirtyTracker()
+        # Whether the debuggee is stopped and the stop event was handled.
+        # Breakpoint conditions are evaluated before any stop event, when the
+        # soft-dirty flags of the previous stop are stale
+        self._stop_handled = False
+        self._max_fetch_bytes = regionfetch.MAX_FULL_FETCH_BYTES
+        self._commands = dict(plot=PlotterCommand(self),
+                              stats=StatsCommand(),
+                              trace=TraceCommand(),
+                              capture=CaptureCommand(),
+                              break_if=BreakIfCommand(),
+                              buffer_stats=BufferStatsCommand(),
+                              agent=AgentCommand(),
+                              stat_function=StatFunction())
 
     def queue_request(self, callable_request):
         return gdb.post_event(callable_request)
 
-    def get_buffer_metadata(self, variable):
-        picked_obj = gdb.parse_and_eval(variable)
+    def get_buffer_metadata(self, variable, allow_overview=False):
+        with tracer.span('get_buffer_metadata'):
+            return self._get_buffer_metadata(variable, allow_overview)
+
+    def _get_buffer_metadata(self, variable, allow_overview):
+        # Slices (e.g. img[100:612, ::2]) are applied to the buffer read from
+        # the expression that precedes them
+        expression, slices = regionfetch.parse_slice(variable)
+        picked_obj = gdb.parse_and_eval(expression)
 
         buffer_metadata = self._type_bridge.get_buffer_metadata(
             variable, picked_obj, self)
@@ -34,13 +60,37 @@ class GdbBridge(BridgeInterface):
             buffer_metadata['type'],
             buffer_metadata['row_stride']
         )
+        pixel_size = _get_pixel_size(buffer_metadata)
+
+        slice_x, slice_y, slice_width, slice_height, slice_step = \
+            regionfetch.get_slice_region(slices,
+                                         buffer_metadata['width'],
+                                         buffer_metadata['height'])
+        sliced_width = regionfetch.num_samples(slice_width, slice_step)
+        sliced_height = regionfetch.num_samples(slice_height, slice_step)
+
+        # Buffers too large to be fetched at once are shown as an overview,
+        # whose regions are fetched on demand (see get_buffer_region). The
+        # statistics and conditions always need every pixel
+        overview_step = 1
+        if allow_overview:
+            overview_step = regionfetch.get_overview_step(
+                sliced_width,
+                sliced_height,
+                sliced_width * pixel_size,
+                pixel_size,
+                self._max_fetch_bytes)
+        fetch_size = (
+            regionfetch.num_samples(sliced_width, overview_step) *
+            regionfetch.num_samples(sliced_height, overview_step) *
+            pixel_size)
 
         # Check if buffer is initialized
         if buffer_metadata['pointer'] == 0x0:
             raise Exception('Invalid null buffer pointer')
         if bufsize == 0:
             raise Exception('Invalid buffer of zero bytes')
-        elif bufsize >= sysinfo.get_memory_usage()['free'] / 10:
+        elif fetch_size >= sysinfo.get_memory_usage()['free'] / 10:
             raise Exception('Invalid buffer size larger than available memory')
 
         # Check if buffer is valid. If it isn't, this function will throw an
@@ -48,16 +98,155 @@ class GdbBridge(BridgeInterface):
         gdb.execute('x '+str(int(buffer_metadata['pointer'])))
 
         inferior = gdb.selected_inferior()
+        executable = gdb.current_progspace().filename
         buffer_metadata['variable_name'] = variable
-        buffer_metadata['pointer'] = inferior.read_memory(
-            buffer_metadata['pointer'], bufsize)
+
+        # Rows of sliced, downsampled and padded buffers (e.g. OpenCV ROIs)
+        # are gathered and packed densely, so that only displayed pixels are
+        # read
+        if (slices is not None or overview_step > 1 or
+                buffer_metadata['row_stride'] > buffer_metadata['width']):
+            with tracer.span('read_memory'):
+                contents = regionfetch.read_region(
+                    inferior,
+                    executable,
+                    int(buffer_metadata['pointer']),
+                    buffer_metadata['row_stride'] * pixel_size,
+                    pixel_size,
+                    slice_x,
+                    slice_y,
+                    slice_width,
+                    slice_height,
+                    slice_step * overview_step)
+            extra_fields = {}
+            if overview_step > 1:
+                extra_fields.update(downsample=overview_step,
+                                    full_width=sliced_width,
+                                    full_height=sliced_height)
+            if slices is not None:
+                extra_fields.update(slice=(slice_x, slice_y, slice_step))
+            return _sampled_buffer_metadata(buffer_metadata,
+                                            contents,
+                                            slice_width,
+                                            slice_height,
+                                            slice_step * overview_step,
+                                            **extra_fields)
+
+        # Only the window plots read through the change tracker: each read
+        # advances it, so the modified rows reported to the window would miss
+        # the changes seen by the one-off reads of conditions and statistics
+        with tracer.span('read_memory'):
+            if allow_overview and self._stop_handled:
+                contents, dirty_ranges = self._change_tracker.read_memory(
+                    inferior,
+                    int(buffer_metadata['pointer']),
+                    bufsize,
+                    executable)
+            else:
+                contents = inferior.read_memory(
+                    int(buffer_metadata['pointer']), bufsize)
+                dirty_ranges = None
+            buffer_metadata['pointer'] = contents
+
+        if dirty_ranges is not None:
+            buffer_metadata['dirty_rows'] = _bytes_to_rows(
+                dirty_ranges, bufsize // buffer_metadata['height'])
+            gatherread.record_read(
+                sum(end - begin for begin, end in dirty_ranges), bufsize)
+        else:
+            gatherread.record_read(bufsize, bufsize)
 
         return buffer_metadata
 
+    def get_buffer_region(self, variable, x, y, width, height, step):
+        with tracer.span('get_buffer_region'):
+            expression, slices = regionfetch.parse_slice(variable)
+            picked_obj = gdb.parse_and_eval(expression)
+
+            buffer_metadata = self._type_bridge.get_buffer_metadata(
+                variable, picked_obj, self)
+
+            # Regions of sliced buffers are given in slice pixels
+            slice_x, slice_y, slice_width, slice_height, slice_step = \
+                regionfetch.get_slice_region(slices,
+                                             buffer_metadata['width'],
+                                             buffer_metadata['height'])
+
+            # The buffer may have been resized since the overview was read
+            width = min(width,
+                        regionfetch.num_samples(slice_width, slice_step) - x)
+            height = min(height,
+                         regionfetch.num_samples(slice_height, slice_step) - y)
+            if (buffer_metadata['pointer'] == 0x0 or x < 0 or y < 0 or
+                    width <= 0 or height <= 0 or step <= 0):
+                raise Exception('Invalid buffer region')
+
+            pixel_size = _get_pixel_size(buffer_metadata)
+            with tracer.span('read_memory'):
+                contents = regionfetch.read_region(
+                    gdb.selected_inferior(),
+                    gdb.current_progspace().filename,
+                    int(buffer_metadata['pointer']),
+                    buffer_metadata['row_stride'] * pixel_size,
+                    pixel_size,
+                    slice_x + x * slice_step,
+                    slice_y + y * slice_step,
+                    width * slice_step,
+                    height * slice_step,
+                    step * slice_step)
+
+            buffer_metadata['variable_name'] = variable
+            extra_fields = dict(region=(x, y, step))
+            if slices is not None:
+                extra_fields.update(slice=(slice_x, slice_y, slice_step))
+            return _sampled_buffer_metadata(buffer_metadata,
+                                            contents,
+                                            width * slice_step,
+                                            height * slice_step,
+                                            step * slice_step,
+                                            **extra_fields)
+
+    def set_max_fetch_bytes(self, max_fetch_bytes):
+        if max_fetch_bytes is None:
+            max_fetch_bytes = regionfetch.MAX_FULL_FETCH_BYTES
+        self._max_fetch_bytes = max_fetch_bytes
+
+    def is_resumable_stop(self, event):
+        return isinstance(event, gdb.BreakpointEvent)
+
+    def resume(self):
+        # The debuggee can't be resumed from within a stop event handler
+        gdb.post_event(lambda: gdb.execute('continue'))
+
+    def _on_stop(self, event):
+        self._change_tracker.on_stop()
+        self._stop_handled = True
+
+    def _on_continue(self, event):
+        self._change_tracker.on_stop()
+        self._stop_handled = False
+
     def register_event_handlers(self, event_handler):
+        # The change tracker must be notified before any buffer is read
+        gdb.events.stop.connect(self._on_stop)
+        gdb.events.cont.connect(self._on_continue)
+        gdb.events.exited.connect(
+            lambda event: self._change_tracker.reset())
         gdb.events.stop.connect(event_handler.stop_handler)
         gdb.events.exited.connect(event_handler.exit_handler)
         self._commands['plot'].set_command_listener(event_handler.plot_handler)
+        self._commands['stats'].set_command_listener(
+            event_handler.stats_handler)
+        self._commands['capture'].set_command_listener(
+            event_handler.capture_handler)
+        self._commands['break_if'].set_command_listener(
+            event_handler.break_if_handler)
+        self._commands['buffer_stats'].set_command_listener(
+            event_handler.buffer_stats_handler)
+        self._commands['stat_function'].set_command_listener(
+            event_handler.buffer_stats_handler)
+        self._commands['agent'].set_command_listener(
+            event_handler.agent_handler)
 
     def get_fields_from_type(self, this_type, observable_symbols):
         """
@@ -117,6 +306,52 @@ class GdbBridge(BridgeInterface):
         return observable_symbols
 
 
+def _get_pixel_size(buffer_metadata):
+    """
+    Size of a pixel of the buffer described by buffer_metadata, in bytes
+    """
+    return sysinfo.get_buffer_size(1,
+                                   buffer_metadata['channels'],
+                                   buffer_metadata['type'],
+                                   1)
+
+
+def _sampled_buffer_metadata(buffer_metadata, contents, width, height, step,
+                             **extra_fields):
+    """
+    Describe the samples read by regionfetch.read_region from a region of
+    width x height pixels of the buffer described by buffer_metadata
+    """
+    sampled_width = regionfetch.num_samples(width, step)
+
+    buffer_metadata['pointer'] = memoryview(contents)
+    buffer_metadata['width'] = sampled_width
+    buffer_metadata['height'] = regionfetch.num_samples(height, step)
+    buffer_metadata['row_stride'] = sampled_width
+    buffer_metadata.update(extra_fields)
+
+    return buffer_metadata
+
+
+def _bytes_to_rows(byte_ranges, row_size):
+    """
+    Convert a list of [begin, end) byte ranges into the list of [first, last)
+    buffer rows they overlap
+    """
+    rows = []
+
+    for begin, end in byte_ranges:
+        first_row = begin // row_size
+        last_row = (end + row_size - 1) // row_size
+
+        if rows and rows[-1][1] >= first_row:
+            rows[-1][1] = max(rows[-1][1], last_row)
+        else:
+            rows.append([first_row, last_row])
+
+    return rows
+
+
 class PlotterCommand(gdb.Command):
     """
     Implements the 'plot' command for the GDB command line mode
@@ -139,8 +374,341 @@ class PlotterCommand(gdb.Command):
         """
         Called by GDB whenever the plot command is invoked.
         """
+        # Slices may contain spaces, e.g. 'plot img[100:612, 200:712]'
         args = gdb.string_to_argv(arg)
-        var_name = str(args[0])
+        var_name = ' '.join(args)
 
         if self._command_listener is not None:
             self._command_listener(var_name)
+
+
+class StatsCommand(gdb.Command):
+    """
+    Implements the 'giw-stats' command, which prints the performance metrics
+    collected by the ImageWatch window
+    """
+    def __init__(self):
+        super(StatsCommand, self).__init__("giw-stats",
+                                           gdb.COMMAND_STATUS,
+                                           gdb.COMPLETE_NONE)
+        self._command_listener = None
+
+    def set_command_listener(self, callback):
+        """
+        Called by the GDB bridge in order to configure which callback must be
+        called to retrieve the metrics dict.
+        """
+        self._command_listener = callback
+
+    def invoke(self, arg, from_tty):
+        """
+        Called by GDB whenever the giw-stats command is invoked.
+        """
+        metrics = None
+        if self._command_listener is not None:
+            metrics = self._command_listener()
+
+        if metrics is None:
+            print('[gdb-imagewatch] No metrics available: the window is not '
+                  'running')
+            return
+
+        # Reads from the debuggee are accounted for by the bridge
+        metrics['counters'].update(gatherread.get_counters())
+
+        print(metrics_report.format_metrics(metrics))
+
+
+class TraceCommand(gdb.Command):
+    """
+    Implements the 'giw-trace' command, which controls the pipeline tracer:
+
+        giw-trace start
+        giw-trace stop
+        giw-trace flush /path/to/trace.json
+
+    The flushed file can be loaded in chrome://tracing or Perfetto.
+    """
+    def __init__(self):
+        super(TraceCommand, self).__init__("giw-trace",
+                                           gdb.COMMAND_DATA,
+                                           gdb.COMPLETE_FILENAME)
+
+    def invoke(self, arg, from_tty):
+        """
+        Called by GDB whenever the giw-trace command is invoked.
+        """
+        args = gdb.string_to_argv(arg)
+
+        if len(args) == 1 and args[0] == 'start':
+            tracer.enable()
+        elif len(args) == 1 and args[0] == 'stop':
+            tracer.disable()
+        elif len(args) == 2 and args[0] == 'flush':
+            if tracer.flush(args[1]):
+                print('[gdb-imagewatch] Trace written to %s' % args[1])
+            else:
+                print('[gdb-imagewatch] Error: Could not write trace to %s'
+                      % args[1])
+        else:
+            print('Usage: giw-trace start|stop|flush <file>')
+
+
+class CaptureCommand(gdb.Command):
+    """
+    Implements the 'giw-capture' command, which records every plotted buffer
+    to a file that can be replayed without a debugger:
+
+        giw-capture start /path/to/session.giwcap
+        giw-capture stop
+
+    See the --replay option of gdb-imagewatch.py.
+    """
+    def __init__(self):
+        super(CaptureCommand, self).__init__("giw-capture",
+                                             gdb.COMMAND_DATA,
+                                             gdb.COMPLETE_FILENAME)
+        self._command_listener = None
+
+    def set_command_listener(self, callback):
+        """
+        Called by the GDB bridge in order to configure which callback must be
+        called to start or stop the capture.
+        """
+        self._command_listener = callback
+
+    def invoke(self, arg, from_tty):
+        """
+        Called by GDB whenever the giw-capture command is invoked.
+        """
+        args = gdb.string_to_argv(arg)
+
+        if len(args) == 2 and args[0] == 'start':
+            capture_path = args[1]
+        elif len(args) == 1 and args[0] == 'stop':
+            capture_path = None
+        else:
+            print('Usage: giw-capture start <file>|stop')
+            return
+
+        if self._command_listener is None:
+            return
+
+        if not self._command_listener(capture_path):
+            print('[gdb-imagewatch] Error: Could not write capture to %s'
+                  % capture_path)
+        elif capture_path is not None:
+            print('[gdb-imagewatch] Recording plotted buffers to %s'
+                  % capture_path)
+
+
+class BreakIfCommand(gdb.Command):
+    """
+    Implements the 'giw-break-if' command, which keeps the debuggee running
+    (without updating the window) until a condition holds for a buffer:
+
+        giw-break-if depth max > 10
+        giw-break-if image nan
+        giw-break-if clear
+
+    The condition is evaluated each time a breakpoint is hit. It has the form
+    "<reduction> <comparison> <value>", where the reduction is one of min,
+    max, mean, nan_count or inf_count; "nan" and "inf" test for any NaN or
+    infinite value.
+    """
+    def __init__(self):
+        super(BreakIfCommand, self).__init__("giw-break-if",
+                                             gdb.COMMAND_BREAKPOINTS,
+                                             gdb.COMPLETE_SYMBOL)
+        self._command_listener = None
+
+    def set_command_listener(self, callback):
+        """
+        Called by the GDB bridge in order to configure which callback must be
+        called to set or remove the buffer condition.
+        """
+        self._command_listener = callback
+
+    def invoke(self, arg, from_tty):
+        """
+        Called by GDB whenever the giw-break-if command is invoked.
+        """
+        args = arg.split(None, 1)
+
+        if len(args) == 1 and args[0] == 'clear':
+            variable_name, condition = None, None
+        elif len(args) == 2:
+            variable_name, condition = args
+        else:
+            print('Usage: giw-break-if <variable> <condition>|clear')
+            return
+
+        if self._command_listener is None:
+            return
+
+        if not self._command_listener(variable_name, condition):
+            print('[gdb-imagewatch] Error: Invalid condition "%s"' % condition)
+
+
+class BufferStatsCommand(gdb.Command):
+    """
+    Implements the 'giw-buffer-stats' command, which prints the statistics of
+    a buffer without plotting it:
+
+        giw-buffer-stats depth
+        giw-buffer-stats depth 16
+
+    The optional second argument is the number of histogram bins.
+    """
+    def __init__(self):
+        super(BufferStatsCommand, self).__init__("giw-buffer-stats",
+                                                 gdb.COMMAND_DATA,
+                                                 gdb.COMPLETE_SYMBOL)
+        self._command_listener = None
+
+    def set_command_listener(self, callback):
+        """
+        Called by the GDB bridge in order to configure which callback must be
+        called to compute the statistics.
+        """
+        self._command_listener = callback
+
+    def invoke(self, arg, from_tty):
+        """
+        Called by GDB whenever the giw-buffer-stats command is invoked.
+        """
+        args = gdb.string_to_argv(arg)
+
+        if len(args) not in (1, 2) or (len(args) == 2 and
+                                       not args[1].isdigit()):
+            print('Usage: giw-buffer-stats <variable> [histogram bins]')
+            return
+
+        if self._command_listener is None:
+            return
+
+        histogram_bins = int(args[1]) if len(args) == 2 else 0
+        stats = self._command_listener(args[0], histogram_bins)
+
+        for channel in range(len(stats['min'])):
+            print('channel %d: min=%g max=%g mean=%g count=%d nan=%d inf=%d' %
+                  (channel,
+                   stats['min'][channel],
+                   stats['max'][channel],
+                   stats['mean'][channel],
+                   stats['count'][channel],
+                   stats['nan_count'][channel],
+                   stats['inf_count'][channel]))
+            if 'histogram' in stats:
+                print('  histogram: %s' %
+                      ' '.join(str(count)
+                               for count in stats['histogram'][channel]))
+
+
+class AgentCommand(gdb.Command):
+    """
+    Implements the 'giw-agent' command, which serves the buffers to a viewer
+    running on another machine (see gdb-imagewatch.py --connect), instead of
+    opening the window here:
+
+        giw-agent listen [host:]port [bandwidth limit, e.g. 2M]
+        giw-agent status
+        giw-agent stop
+
+    The host defaults to 127.0.0.1; the port is meant to be forwarded with
+    ssh -L.
+    """
+    def __init__(self):
+        super(AgentCommand, self).__init__("giw-agent",
+                                           gdb.COMMAND_DATA,
+                                           gdb.COMPLETE_NONE)
+        self._command_listener = None
+        self._agent = None
+
+    def set_command_listener(self, callback):
+        """
+        Called by the GDB bridge in order to configure which callback must be
+        called to start or stop the agent.
+        """
+        self._command_listener = callback
+
+    def invoke(self, arg, from_tty):
+        """
+        Called by GDB whenever the giw-agent command is invoked.
+        """
+        args = gdb.string_to_argv(arg)
+
+        if self._command_listener is None:
+            return
+
+        if len(args) in (2, 3) and args[0] == 'listen':
+            try:
+                bandwidth_limit = remote.parse_bandwidth(
+                    args[2] if len(args) == 3 else None)
+                self._agent = self._command_listener(args[1],
+                                                     bandwidth_limit)
+            except (ValueError, OSError) as err:
+                print('[gdb-imagewatch] Error: Could not start the agent: %s'
+                      % err)
+                return
+            print('[gdb-imagewatch] Waiting for viewers at %s' %
+                  self._agent.address)
+        elif len(args) == 1 and args[0] == 'stop':
+            self._agent = self._command_listener(None, None)
+        elif len(args) == 1 and args[0] == 'status':
+            if self._agent is None:
+                print('[gdb-imagewatch] The agent is not running')
+                return
+            counters = self._agent.get_counters()
+            print('viewer connected: %s' %
+                  ('yes' if counters['viewer_connected'] else 'no'))
+            print('buffers sent: %d (%d as deltas)' %
+                  (counters['buffers_sent'], counters['deltas_sent']))
+            print('bytes sent: %s (%s of pixels before compression)' %
+                  (metrics_report.format_bytes(counters['bytes_sent']),
+                   metrics_report.format_bytes(
+                       counters['bytes_uncompressed'])))
+            print('bytes received: %s' %
+                  metrics_report.format_bytes(counters['bytes_received']))
+        else:
+            print('Usage: giw-agent listen [host:]port [bandwidth]|status|'
+                  'stop')
+
+
+class StatFunction(gdb.Function):
+    """
+    Implements the '$giw_stat' convenience function, which returns a
+    statistic of a buffer so that it can be used in breakpoint conditions and
+    scripts:
+
+        break foo.cpp:42 if $giw_stat("depth", "max") > 10
+        print $giw_stat("image", "nan_count", 2)
+
+    The statistic is one of min, max, mean, count, nan_count or inf_count.
+    The optional third argument is the channel (0 by default).
+    """
+    def __init__(self):
+        super(StatFunction, self).__init__("giw_stat")
+        self._command_listener = None
+
+    def set_command_listener(self, callback):
+        """
+        Called by the GDB bridge in order to configure which callback must be
+        called to compute the statistics.
+        """
+        self._command_listener = callback
+
+    def invoke(self, variable_name, stat_name, channel=0):
+        """
+        Called by GDB whenever $giw_stat is evaluated.
+        """
+        if self._command_listener is None:
+            raise gdb.GdbError('gdb-imagewatch is not initialized')
+
+        stats = self._command_listener(variable_name.string(), 0)
+        stat_name = stat_name.string()
+
+        if stat_name not in stats or stat_name == 'histogram':
+            raise gdb.GdbError('Unknown buffer statistic %s' % stat_name)
+
+        return stats[stat_name][int(channel)]
@@ -18,12 +18,34 @@ class BridgeInterface():
         """
         raise NotImplementedError("Method is not implemented")
 
-    def get_buffer_metadata(self, variable):
+    def get_buffer_metadata(self, variable, allow_overview=False):
         """
         Given a string defining a variable name, must return the following
         information about it:
 
         [mem, width, height, channels, type, step, pixel_layout]
+
+        If allow_overview is True, buffers too large to be fetched at once
+        may be returned as an overview (every n-th pixel of every n-th row,
+        see regionfetch), which is only suitable for display. Only these
+        reads, made for the window, may report the rows modified since the
+        previous one in the optional field 'dirty_rows'.
+        """
+        raise NotImplementedError("Method is not implemented")
+
+    def get_buffer_region(self, variable, x, y, width, height, step):
+        """
+        Same as get_buffer_metadata, but only reads every 'step'-th pixel of
+        every 'step'-th row of the region [x, x + width) x [y, y + height) of
+        the buffer. The returned metadata describes the samples, and has an
+        additional field 'region' with the tuple (x, y, step).
+        """
+        raise NotImplementedError("Method is not implemented")
+
+    def set_max_fetch_bytes(self, max_fetch_bytes):
+        """
+        Set the size above which get_buffer_metadata returns an overview of
+        the buffer instead of all of its pixels. None restores the default.
         """
         raise NotImplementedError("Method is not implemented")
 
@@ -34,6 +56,20 @@ class BridgeInterface():
         """
         raise NotImplementedError("Method is not implemented")
 
+    def is_resumable_stop(self, event):
+        """
+        Returns True if the debuggee can be resumed automatically after the
+        stop event 'event' (i.e. it stopped at a breakpoint, and not due to a
+        signal or to a step requested by the user).
+        """
+        raise NotImplementedError("Method is not implemented")
+
+    def resume(self):
+        """
+        Continue the execution of the debuggee.
+        """
+        raise NotImplementedError("Method is not implemented")
+
     def get_casted_pointer(self, typename, debugger_object):
         """
         Given the string 'typename' specifying any arbitrary type name of the
@@ -82,3 +118,44 @@ class BridgeEventHandlerInterface():
         command from the debugger console.
         """
         raise NotImplementedError("Method is not implemented")
+
+    def stats_handler(self):
+        """
+        Handler to be called whenever the user requests the performance
+        metrics from the debugger console. Returns the metrics dict, or None
+        if the window is not available.
+        """
+        raise NotImplementedError("Method is not implemented")
+
+    def capture_handler(self, capture_path):
+        """
+        Handler to be called whenever the user starts (with the output file
+        path) or stops (with None) recording plot requests from the debugger
+        console. Returns True on success.
+        """
+        raise NotImplementedError("Method is not implemented")
+
+    def buffer_stats_handler(self, variable_name, histogram_bins):
+        """
+        Handler to be called whenever the statistics of a buffer are requested
+        from the debugger console or from a script. Returns the statistics
+        dict (see GdbImageWatchWindow.compute_stats).
+        """
+        raise NotImplementedError("Method is not implemented")
+
+    def break_if_handler(self, variable_name, condition):
+        """
+        Handler to be called whenever the user sets (with a variable name and
+        a condition) or removes (with None) a buffer condition from the
+        debugger console. Returns False if the condition is invalid.
+        """
+        raise NotImplementedError("Method is not implemented")
+
+    def agent_handler(self, address, bandwidth_limit):
+        """
+        Handler to be called whenever the user starts (with the address to
+        listen at, and the bandwidth limit in bytes per second or None) or
+        stops (with None) the remote viewer agent from the debugger console.
+        Returns the running agent, or None.
+        """
+        raise NotImplementedError("Method is not implemented")
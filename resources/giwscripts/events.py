@@ -6,6 +6,7 @@ Implementation of handlers for events raised by the debugger
 
 import time
 
+from giwscripts import remote
 from giwscripts.debuggers.interfaces import BridgeEventHandlerInterface
 
 
@@ -16,6 +17,12 @@ class GdbImageWatchEvents(BridgeEventHandlerInterface):
     def __init__(self, window, debugger):
         self._window = window
         self._debugger = debugger
+        # Window of this machine, replaced by the agent in self._window while
+        # the buffers are served to a remote viewer (see giw-agent)
+        self._local_window = window
+        self._agent = None
+        # (variable name, condition) set with the break-if command
+        self._buffer_condition = None
 
     def _set_symbol_complete_list(self):
         """
@@ -37,22 +44,123 @@ class GdbImageWatchEvents(BridgeEventHandlerInterface):
         The debugger has stopped (e.g. a breakpoint was hit). We must list all
         available buffers and pass it to the imagewatch window.
         """
+        # Keep running, without updating the window, while the buffer
+        # condition doesn't hold
+        if (self._buffer_condition is not None and
+                self._debugger.is_resumable_stop(event) and
+                not self._buffer_condition_holds()):
+            self._debugger.resume()
+            return
+
         # Block until the window is up and running
         if not self._window.is_ready():
             self._window.initialize_window()
             while not self._window.is_ready():
                 time.sleep(0.1)
 
-        # Update buffers being visualized
-        observed_buffers = self._window.get_observed_buffers()
-        for buffer_name in observed_buffers:
+        # Update the buffers being visualized whose refresh policy requires
+        # it; the others are not even read from the debuggee
+        refreshed_buffers = self._window.get_buffers_to_refresh()
+        for buffer_name in refreshed_buffers:
             self._window.plot_variable(buffer_name)
 
         # Set list of available symbols
         self._set_symbol_complete_list()
 
+    def _buffer_condition_holds(self):
+        """
+        Evaluate the buffer condition, reporting its cost. Errors are reported
+        as a match, so that the user gets control back.
+        """
+        variable_name, condition = self._buffer_condition
+
+        try:
+            read_start = time.monotonic()
+            buffer_metadata = self._debugger.get_buffer_metadata(variable_name)
+            scan_start = time.monotonic()
+            holds = self._window.evaluate_buffer_condition(buffer_metadata,
+                                                           condition)
+            scan_end = time.monotonic()
+        except Exception as err:
+            print('[gdb-imagewatch] Could not evaluate "%s" on %s: %s' %
+                  (condition, variable_name, err))
+            return True
+
+        print('[gdb-imagewatch] %s: "%s" is %s (read %.2f ms, scan %.2f ms)' %
+              (variable_name,
+               condition,
+               'true' if holds else 'false',
+               (scan_start - read_start) * 1e3,
+               (scan_end - scan_start) * 1e3))
+
+        return holds
+
     def plot_handler(self, variable_name):
         """
         Command window to plot variable_name if user requests from debugger log
         """
         self._window.plot_variable(variable_name)
+
+    def stats_handler(self):
+        """
+        Retrieve the performance metrics collected by the window
+        """
+        if not self._window.is_ready():
+            return None
+
+        return self._window.get_metrics()
+
+    def capture_handler(self, capture_path):
+        """
+        Start recording plotted buffers to capture_path, or stop recording if
+        capture_path is None
+        """
+        if capture_path is None:
+            self._window.stop_capture()
+            return True
+
+        return self._window.start_capture(capture_path)
+
+    def buffer_stats_handler(self, variable_name, histogram_bins):
+        """
+        Compute the statistics of the buffer variable_name, without plotting
+        it. Like the buffer condition, it is not read as an overview, which
+        keeps the read out of the change tracker of the window plots.
+        """
+        buffer_metadata = self._debugger.get_buffer_metadata(variable_name)
+        return self._window.compute_stats(buffer_metadata, histogram_bins)
+
+    def break_if_handler(self, variable_name, condition):
+        """
+        Keep the debuggee running until condition holds for the buffer
+        variable_name. A None variable_name removes the condition.
+        """
+        if variable_name is None:
+            self._buffer_condition = None
+            return True
+
+        if not self._window.is_buffer_condition_valid(condition):
+            return False
+
+        self._buffer_condition = (variable_name, condition)
+        return True
+
+    def agent_handler(self, address, bandwidth_limit):
+        """
+        Serve the buffers to a remote viewer listening at address, or go back
+        to the local window if address is None
+        """
+        if self._agent is not None:
+            self._agent.close()
+            self._agent = None
+            self._window = self._local_window
+
+        if address is None:
+            return None
+
+        self._agent = remote.TileAgent(self._local_window,
+                                       self._debugger,
+                                       address,
+                                       bandwidth_limit)
+        self._window = self._agent
+        return self._agent
@@ -0,0 +1,321 @@
+# -*- coding: utf-8 -*-
+
+"""
+Standalone viewer for buffers dumped to disk: NumPy .npy files and the raw
+matrices written by the "Octave Raw Matrix" export of the window. Files are
+mapped in memory rather than read, so that only the pages of the displayed
+pixels are ever loaded; files too large to be plotted at once are shown as an
+overview whose regions are read as the window zooms in, as it happens for
+buffers read from a debuggee (see regionfetch).
+"""
+
+import ast
+import mmap
+import os
+import queue
+import struct
+import threading
+import time
+
+from giwscripts import giwwindow
+from giwscripts import regionfetch
+from giwscripts import symbols
+from giwscripts import sysinfo
+from giwscripts.debuggers.interfaces import BridgeInterface
+
+NPY_MAGIC = b'\x93NUMPY'
+
+# NumPy type descriptors (without their byte order) of the supported types
+_NPY_TYPES = {
+    'u1': symbols.GIW_TYPES_UINT8,
+    'u2': symbols.GIW_TYPES_UINT16,
+    'i2': symbols.GIW_TYPES_INT16,
+    'i4': symbols.GIW_TYPES_INT32,
+    'f4': symbols.GIW_TYPES_FLOAT32,
+    'f8': symbols.GIW_TYPES_FLOAT64,
+}
+
+# Type names written in the first line of the raw matrices (see
+# get_type_descriptor in buffer_exporter.cpp)
+_RAW_TYPES = {
+    b'uint8': symbols.GIW_TYPES_UINT8,
+    b'uint16': symbols.GIW_TYPES_UINT16,
+    b'int16': symbols.GIW_TYPES_INT16,
+    b'int32': symbols.GIW_TYPES_INT32,
+    b'float': symbols.GIW_TYPES_FLOAT32,
+    b'double': symbols.GIW_TYPES_FLOAT64,
+}
+
+# Longest type name line of a raw matrix
+_MAX_RAW_TYPE_LINE = max(len(name) for name in _RAW_TYPES) + 1
+# Height, width and channels of a raw matrix
+_RAW_DIMENSIONS = struct.Struct('=iii')
+
+
+def _parse_npy_header(mapping):
+    """
+    Returns the type, width, height, channels and data offset of the array
+    in a .npy file, and whether it is stored in column-major order
+    """
+    major_version = mapping[len(NPY_MAGIC)]
+    if major_version == 1:
+        header_size, = struct.unpack_from('<H', mapping, 8)
+        header_offset = 10
+    elif major_version in (2, 3):
+        header_size, = struct.unpack_from('<I', mapping, 8)
+        header_offset = 12
+    else:
+        raise Exception('Unsupported .npy version %d' % major_version)
+
+    header = ast.literal_eval(
+        mapping[header_offset:header_offset + header_size].decode('latin1'))
+    descriptor = header['descr']
+    shape = header['shape']
+
+    if (not isinstance(descriptor, str) or descriptor[0] == '>' or
+            descriptor[1:] not in _NPY_TYPES):
+        raise Exception('Unsupported array type %s' % str(descriptor))
+
+    if len(shape) == 2:
+        shape += (1,)
+    if len(shape) != 3 or not 1 <= shape[2] <= 4:
+        raise Exception('Arrays must have shape (height, width) or '
+                        '(height, width, channels), with up to 4 channels')
+    if header['fortran_order'] and shape[2] != 1:
+        raise Exception('Column-major arrays must have a single channel')
+
+    return (_NPY_TYPES[descriptor[1:]],
+            shape[1],
+            shape[0],
+            shape[2],
+            header_offset + header_size,
+            header['fortran_order'])
+
+
+def _parse_raw_header(mapping):
+    """
+    Returns the type, width, height, channels and data offset of a raw matrix
+    """
+    type_line_end = mapping.find(b'\n', 0, _MAX_RAW_TYPE_LINE)
+    type_name = mapping[:type_line_end]
+    if type_line_end < 0 or type_name not in _RAW_TYPES:
+        raise Exception('Not a .npy file or a raw matrix')
+
+    height, width, channels = _RAW_DIMENSIONS.unpack_from(mapping,
+                                                          type_line_end + 1)
+    if not 1 <= channels <= 4:
+        raise Exception('Raw matrices must have 1 to 4 channels')
+
+    return (_RAW_TYPES[type_name],
+            width,
+            height,
+            channels,
+            type_line_end + 1 + _RAW_DIMENSIONS.size)
+
+
+def map_buffer_file(path):
+    """
+    Map the file at 'path' in memory and describe the buffer it contains.
+    Returns a buffer metadata dict (see BridgeInterface.get_buffer_metadata)
+    whose pointer is a memoryview of the mapped pixels.
+    """
+    with open(path, 'rb') as dump_file:
+        mapping = mmap.mmap(dump_file.fileno(), 0, access=mmap.ACCESS_READ)
+
+    transpose_buffer = False
+    if mapping[:len(NPY_MAGIC)] == NPY_MAGIC:
+        buffer_type, width, height, channels, offset, transpose_buffer = \
+            _parse_npy_header(mapping)
+    else:
+        buffer_type, width, height, channels, offset = \
+            _parse_raw_header(mapping)
+
+    # Column-major arrays are stored as their transpose
+    if transpose_buffer:
+        width, height = height, width
+
+    size = sysinfo.get_buffer_size(height, channels, buffer_type, width)
+    if width <= 0 or height <= 0 or offset + size > len(mapping):
+        raise Exception('Truncated buffer file')
+
+    name = os.path.basename(path)
+    return {
+        'variable_name': path,
+        'display_name': '%s [%dx%dx%d]' % (name, width, height, channels),
+        'pointer': memoryview(mapping)[offset:offset + size],
+        'width': width,
+        'height': height,
+        'channels': channels,
+        'type': buffer_type,
+        'row_stride': width,
+        'pixel_layout': 'rgba',
+        'transpose_buffer': transpose_buffer
+    }
+
+
+class _MappedMemory():
+    """
+    Stands in for the debugger inferior in regionfetch.read_region, reading
+    from a mapped buffer instead
+    """
+    pid = None
+
+    def __init__(self, pixels):
+        self._pixels = pixels
+
+    def read_memory(self, address, size):
+        """
+        Return the 'size' bytes at offset 'address' of the buffer
+        """
+        return self._pixels[address:address + size]
+
+
+class FileBridge(BridgeInterface):
+    """
+    Debugger bridge serving the buffers of mapped files. Buffers that fit in
+    regionfetch.MAX_FULL_FETCH_BYTES are plotted straight from their mapping,
+    without copies; larger ones are sampled like the buffers of a debuggee.
+    """
+    def __init__(self, buffers):
+        self._buffers = buffers
+
+        self._request_queue = queue.Queue()
+        self._request_consumer_thread = threading.Thread(
+            target=self._request_consumer,
+            daemon=True)
+        self._request_consumer_thread.start()
+
+    def _request_consumer(self):
+        while True:
+            latest_request = self._request_queue.get(block=True, timeout=None)
+            latest_request()
+
+    def queue_request(self, callable_request):
+        self._request_queue.put(callable_request)
+
+    def get_available_symbols(self):
+        return list(self._buffers)
+
+    def get_buffer_metadata(self, variable, allow_overview=False):
+        if variable not in self._buffers:
+            return None
+        if not allow_overview:
+            return dict(self._buffers[variable])
+
+        buffer_metadata = dict(self._buffers[variable])
+        width = buffer_metadata['width']
+        height = buffer_metadata['height']
+        pixel_size = _get_pixel_size(buffer_metadata)
+
+        step = regionfetch.get_overview_step(width,
+                                             height,
+                                             width * pixel_size,
+                                             pixel_size)
+        if step == 1:
+            return buffer_metadata
+
+        buffer_metadata.update(downsample=step,
+                               full_width=width,
+                               full_height=height)
+        return _sample_buffer(buffer_metadata, 0, 0, width, height, step)
+
+    def get_buffer_region(self, variable, x, y, width, height, step):
+        buffer_metadata = dict(self._buffers[variable])
+
+        width = min(width, buffer_metadata['width'] - x)
+        height = min(height, buffer_metadata['height'] - y)
+        if x < 0 or y < 0 or width <= 0 or height <= 0 or step <= 0:
+            raise Exception('Invalid buffer region')
+
+        buffer_metadata['region'] = (x, y, step)
+        return _sample_buffer(buffer_metadata, x, y, width, height, step)
+
+    def get_casted_pointer(self, typename, debugger_object):
+        return debugger_object
+
+    def register_event_handlers(self, events):
+        pass
+
+    def is_resumable_stop(self, event):
+        return False
+
+    def resume(self):
+        pass
+
+    def set_max_fetch_bytes(self, max_fetch_bytes):
+        pass
+
+
+def _get_pixel_size(buffer_metadata):
+    """
+    Size of a pixel of the buffer described by buffer_metadata, in bytes
+    """
+    return sysinfo.get_buffer_size(1,
+                                   buffer_metadata['channels'],
+                                   buffer_metadata['type'],
+                                   1)
+
+
+def _sample_buffer(buffer_metadata, x, y, width, height, step):
+    """
+    Replace the pixels of buffer_metadata with every 'step'-th pixel of every
+    'step'-th row of the region [x, x + width) x [y, y + height). Only the
+    pages of the sampled rows are loaded from the file.
+    """
+    pixel_size = _get_pixel_size(buffer_metadata)
+    contents = regionfetch.read_region(
+        _MappedMemory(buffer_metadata['pointer']),
+        None,
+        0,
+        buffer_metadata['row_stride'] * pixel_size,
+        pixel_size,
+        x,
+        y,
+        width,
+        height,
+        step)
+
+    sampled_width = regionfetch.num_samples(width, step)
+    buffer_metadata['pointer'] = memoryview(contents)
+    buffer_metadata['width'] = sampled_width
+    buffer_metadata['height'] = regionfetch.num_samples(height, step)
+    buffer_metadata['row_stride'] = sampled_width
+
+    return buffer_metadata
+
+
+def giwopen(script_path, paths):
+    """
+    Entry point for the file viewer mode: plot the buffers of the files in
+    'paths'
+    """
+    buffers = {}
+    for path in paths:
+        try:
+            buffers[path] = map_buffer_file(path)
+        except Exception as err:
+            print('[gdb-imagewatch] Error: Could not open %s: %s' %
+                  (path, err))
+
+    if not buffers:
+        return
+
+    bridge = FileBridge(buffers)
+    window = giwwindow.GdbImageWatchWindow(script_path, bridge)
+    window.initialize_window()
+
+    try:
+        # Wait for window to initialize
+        while not window.is_ready():
+            time.sleep(0.1)
+
+        window.set_available_symbols(bridge.get_available_symbols())
+
+        for path in buffers:
+            window.plot_variable(path)
+
+        while window.is_ready():
+            time.sleep(0.5)
+
+    except KeyboardInterrupt:
+        window.terminate()
@@ -0,0 +1,135 @@
+# -*- coding: utf-8 -*-
+
+"""
+Scatter-gather reads of buffer rows from the debuggee. Only the requested
+bytes of each row are read, and they are packed densely on arrival. When the
+debuggee runs in this machine, the rows are read in batches with
+process_vm_readv(2), straight into their destination; otherwise, each row is
+read through the debugger.
+"""
+
+import ctypes
+import errno
+import os
+
+from giwscripts import changetracker
+
+# Maximum number of iovecs accepted by process_vm_readv (UIO_MAXIOV)
+try:
+    MAX_IOVECS = os.sysconf('SC_IOV_MAX')
+except (ValueError, OSError):
+    MAX_IOVECS = 1024
+
+# Bytes read from the debuggee and bytes handed to the window since the
+# debugger was started, reported by giw-stats
+_COUNTERS = {'bytes_read': 0, 'bytes_displayed': 0}
+
+# Debuggees whose memory can't be read with process_vm_readv (e.g. because of
+# the ptrace access checks of the kernel)
+_UNREADABLE_PIDS = set()
+
+_PROCESS_VM_READV = None
+
+
+class _IoVec(ctypes.Structure):
+    _fields_ = [('iov_base', ctypes.c_void_p),
+                ('iov_len', ctypes.c_size_t)]
+
+
+def _get_process_vm_readv():
+    """
+    Load process_vm_readv from the C library. Returns None if the function is
+    not available.
+    """
+    global _PROCESS_VM_READV
+
+    if _PROCESS_VM_READV is None:
+        try:
+            function = ctypes.CDLL(None, use_errno=True).process_vm_readv
+        except (AttributeError, OSError):
+            function = False
+        else:
+            function.argtypes = [ctypes.c_int,
+                                 ctypes.POINTER(_IoVec),
+                                 ctypes.c_ulong,
+                                 ctypes.POINTER(_IoVec),
+                                 ctypes.c_ulong,
+                                 ctypes.c_ulong]
+            function.restype = ctypes.c_ssize_t
+        _PROCESS_VM_READV = function
+
+    return _PROCESS_VM_READV or None
+
+
+def _read_rows_local(pid, row_addresses, read_size, destination, offset):
+    """
+    Read the rows with process_vm_readv, MAX_IOVECS rows per call. Returns
+    False if any of the rows couldn't be read this way.
+    """
+    process_vm_readv = _get_process_vm_readv()
+    if process_vm_readv is None or pid in _UNREADABLE_PIDS:
+        return False
+
+    destination_address = ctypes.addressof(
+        ctypes.c_char.from_buffer(destination, offset))
+
+    for first_row in range(0, len(row_addresses), MAX_IOVECS):
+        batch = row_addresses[first_row:first_row + MAX_IOVECS]
+        batch_size = len(batch) * read_size
+
+        # The rows are scattered in the debuggee, but packed in destination
+        local_iov = _IoVec(destination_address + first_row * read_size,
+                           batch_size)
+        remote_iov = (_IoVec * len(batch))()
+        for row, address in enumerate(batch):
+            remote_iov[row].iov_base = address
+            remote_iov[row].iov_len = read_size
+
+        bytes_read = process_vm_readv(pid,
+                                      ctypes.byref(local_iov),
+                                      1,
+                                      remote_iov,
+                                      len(batch),
+                                      0)
+        if bytes_read != batch_size:
+            if (bytes_read < 0 and
+                    ctypes.get_errno() in (errno.EPERM, errno.ENOSYS)):
+                _UNREADABLE_PIDS.add(pid)
+            return False
+
+    return True
+
+
+def read_rows(inferior, executable, row_addresses, read_size, destination,
+              offset=0):
+    """
+    Read 'read_size' bytes at each address of 'row_addresses' from
+    'inferior', whose program is 'executable', into the bytearray
+    'destination', one row after the other starting at byte 'offset'
+    """
+    if (changetracker.is_local_process(inferior.pid, executable) and
+            _read_rows_local(inferior.pid, row_addresses, read_size,
+                             destination, offset)):
+        return
+
+    for address in row_addresses:
+        destination[offset:offset + read_size] = memoryview(
+            inferior.read_memory(address, read_size))
+        offset += read_size
+
+
+def record_read(bytes_read, bytes_displayed):
+    """
+    Account for a read of 'bytes_read' bytes from the debuggee, from which a
+    buffer of 'bytes_displayed' bytes was built
+    """
+    _COUNTERS['bytes_read'] += bytes_read
+    _COUNTERS['bytes_displayed'] += bytes_displayed
+
+
+def get_counters():
+    """
+    Return a dict with the number of bytes read from the debuggee and the
+    number of bytes of the buffers built from them
+    """
+    return dict(_COUNTERS)
@@ -6,15 +6,44 @@ Classes related to exposing an interface to the ImageWatch window
 
 import ctypes
 import ctypes.util
+import importlib.machinery
+import importlib.util
 import signal
+import sys
 import threading
 
+from giwscripts import tracer
 from giwscripts.thirdparty.pysigset import pysigset
 
 
 FETCH_BUFFER_CBK_TYPE = ctypes.CFUNCTYPE(ctypes.c_int,
                                          ctypes.c_char_p)
 
+FETCH_REGION_CBK_TYPE = ctypes.CFUNCTYPE(ctypes.c_int,
+                                         ctypes.c_char_p,
+                                         ctypes.c_int,
+                                         ctypes.c_int,
+                                         ctypes.c_int,
+                                         ctypes.c_int,
+                                         ctypes.c_int)
+
+
+def _load_native_module(library_path):
+    """
+    Import the giwnative extension module exported by libgiwwindow. Returns
+    None if it is not available (e.g. the library was built against Python
+    headers older than 3.7, or against a different Python version).
+    """
+    try:
+        loader = importlib.machinery.ExtensionFileLoader('giwnative',
+                                                         library_path)
+        spec = importlib.util.spec_from_loader('giwnative', loader)
+        module = importlib.util.module_from_spec(spec)
+        loader.exec_module(module)
+        return module
+    except (ImportError, OSError):
+        return None
+
 
 class GdbImageWatchWindow():
     """
@@ -50,6 +79,12 @@ class GdbImageWatchWindow():
         self._lib.giw_create_window.argtypes = [FETCH_BUFFER_CBK_TYPE]
         self._lib.giw_create_window.restype = ctypes.c_void_p
 
+        self._lib.giw_set_region_callback.argtypes = [
+            ctypes.c_void_p,
+            FETCH_REGION_CBK_TYPE
+        ]
+        self._lib.giw_set_region_callback.restype = None
+
         self._lib.giw_destroy_window.argtypes = [ctypes.c_void_p]
         self._lib.giw_destroy_window.restype = ctypes.c_int
 
@@ -59,20 +94,130 @@ class GdbImageWatchWindow():
         self._lib.giw_get_observed_buffers.argtypes = [ctypes.c_void_p]
         self._lib.giw_get_observed_buffers.restype = ctypes.py_object
 
+        self._lib.giw_get_buffers_to_refresh.argtypes = [ctypes.c_void_p]
+        self._lib.giw_get_buffers_to_refresh.restype = ctypes.py_object
+
         self._lib.giw_set_available_symbols.argtypes = [
             ctypes.c_void_p,
             ctypes.py_object
         ]
         self._lib.giw_set_available_symbols.restype = None
 
+        self._lib.giw_update_available_symbols.argtypes = [
+            ctypes.c_void_p,
+            ctypes.py_object,
+            ctypes.py_object
+        ]
+        self._lib.giw_update_available_symbols.restype = None
+
         self._lib.giw_plot_buffer.argtypes = [
             ctypes.c_void_p,
             ctypes.py_object
         ]
         self._lib.giw_plot_buffer.restype = None
 
+        self._lib.giw_start_interaction_benchmark.argtypes = [
+            ctypes.c_void_p,
+            ctypes.c_char_p
+        ]
+        self._lib.giw_start_interaction_benchmark.restype = None
+
+        self._lib.giw_is_interaction_benchmark_running.argtypes = [
+            ctypes.c_void_p
+        ]
+        self._lib.giw_is_interaction_benchmark_running.restype = ctypes.c_int
+
+        self._lib.giw_capture_start.argtypes = [ctypes.c_char_p]
+        self._lib.giw_capture_start.restype = ctypes.c_int
+
+        self._lib.giw_capture_stop.argtypes = []
+        self._lib.giw_capture_stop.restype = None
+
+        self._lib.giw_replay_capture.argtypes = [
+            ctypes.c_void_p,
+            ctypes.c_char_p,
+            ctypes.c_int
+        ]
+        self._lib.giw_replay_capture.restype = ctypes.c_int
+
+        self._lib.giw_is_buffer_condition_valid.argtypes = [ctypes.c_char_p]
+        self._lib.giw_is_buffer_condition_valid.restype = ctypes.c_int
+
+        self._lib.giw_evaluate_buffer_condition.argtypes = [
+            ctypes.py_object,
+            ctypes.c_char_p
+        ]
+        self._lib.giw_evaluate_buffer_condition.restype = ctypes.c_int
+
+        self._lib.giw_compute_stats.argtypes = [
+            ctypes.py_object,
+            ctypes.c_int
+        ]
+        self._lib.giw_compute_stats.restype = ctypes.py_object
+
+        self._lib.giw_get_metrics.argtypes = [ctypes.c_void_p]
+        self._lib.giw_get_metrics.restype = ctypes.py_object
+
+        self._lib.giw_trace_set_enabled.argtypes = [ctypes.c_int]
+        self._lib.giw_trace_set_enabled.restype = None
+
+        self._lib.giw_trace_record_span.argtypes = [
+            ctypes.c_char_p,
+            ctypes.c_ulonglong,
+            ctypes.c_ulonglong
+        ]
+        self._lib.giw_trace_record_span.restype = None
+
+        self._lib.giw_trace_set_thread_name.argtypes = [ctypes.c_char_p]
+        self._lib.giw_trace_set_thread_name.restype = None
+
+        self._lib.giw_trace_flush.argtypes = [ctypes.c_char_p]
+        self._lib.giw_trace_flush.restype = ctypes.c_int
+
+        tracer.set_native_library(self._lib)
+
+        # Typed entry points for the calls made at every stop. The ctypes API
+        # above is still used for the window lifecycle, and as a fallback if
+        # the extension module is not available
+        self._native = _load_native_module(script_path + '/libgiwwindow.so')
+        self._use_native = self._native is not None
+
         # UI handler
         self._window_handler = None
+        # Symbols last given to the window, whose changes are the only ones
+        # sent to it by set_available_symbols
+        self._available_symbols = set()
+
+    def set_native_module_enabled(self, enabled):
+        """
+        Choose between the CPython extension module (if available) and the
+        ctypes API for the calls made at every stop. Returns True if the
+        extension module is in use.
+        """
+        self._use_native = enabled and self._native is not None
+        return self._use_native
+
+    def _plot_buffer(self, buffer_metadata):
+        # Overviews and regions of buffers too large to be fetched at once, as
+        # well as buffer slices, go through the dict API, which accepts their
+        # additional fields
+        if (self._use_native and 'downsample' not in buffer_metadata and
+                'region' not in buffer_metadata and
+                'slice' not in buffer_metadata):
+            self._native.plot_buffer(self._window_handler,
+                                     buffer_metadata['pointer'],
+                                     buffer_metadata['variable_name'],
+                                     buffer_metadata['display_name'],
+                                     buffer_metadata['width'],
+                                     buffer_metadata['height'],
+                                     buffer_metadata['channels'],
+                                     buffer_metadata['type'],
+                                     buffer_metadata['row_stride'],
+                                     buffer_metadata['pixel_layout'],
+                                     buffer_metadata['transpose_buffer'],
+                                     buffer_metadata.get('dirty_rows'))
+        else:
+            self._lib.giw_plot_buffer(self._window_handler, buffer_metadata)
 
     def plot_variable(self, requested_symbol):
         """
@@ -95,9 +240,8 @@ class GdbImageWatchWindow():
                 variable = requested_symbol
 
             plot_callable = DeferredVariablePlotter(variable,
-                                                    self._lib,
-                                                    self._bridge,
-                                                    self._window_handler)
+                                                    self._plot_buffer,
+                                                    self._bridge)
             self._bridge.queue_request(plot_callable)
             return 1
         except Exception as err:
@@ -106,6 +250,30 @@ class GdbImageWatchWindow():
 
         return 0
 
+    def request_region(self, requested_symbol, x, y, width, height, step):
+        """
+        Fetch the region [x, x + width) x [y, y + height) of the buffer
+        'requested_symbol', sampled every 'step' pixels, to refine its
+        overview in the window. The region is read in the debugger thread
+        (see DeferredRegionPlotter).
+        """
+        if self._bridge is None:
+            return 0
+
+        try:
+            variable = requested_symbol.decode('utf-8')
+            plot_callable = DeferredRegionPlotter(variable,
+                                                  (x, y, width, height, step),
+                                                  self._plot_buffer,
+                                                  self._bridge)
+            self._bridge.queue_request(plot_callable)
+            return 1
+        except Exception as err:
+            print('[gdb-imagewatch] Error: Could not fetch buffer region')
+            print(err)
+
+        return 0
+
     def is_ready(self):
         """
         Returns True if the ImageWatch window has been loaded; False otherwise.
@@ -113,6 +281,9 @@ class GdbImageWatchWindow():
         if self._window_handler is None:
             return False
 
+        if self._use_native:
+            return self._native.is_window_ready(self._window_handler)
+
         return self._lib.giw_is_window_ready(self._window_handler)
 
     def terminate(self):
@@ -124,22 +295,144 @@ class GdbImageWatchWindow():
     def set_available_symbols(self, observable_symbols):
         """
         Set the autocomplete list of symbols with the list of string
-        'observable_symbols'
+        'observable_symbols'. Only the symbols that appeared or disappeared
+        since the previous call are sent to the window.
         """
-        self._lib.giw_set_available_symbols(
-            self._window_handler,
-            observable_symbols)
+        # The names are interned, so that the symbols that stay in scope
+        # across stops are compared by identity and stored once
+        available_symbols = set(map(sys.intern, observable_symbols))
+        added_symbols = list(available_symbols - self._available_symbols)
+        removed_symbols = list(self._available_symbols - available_symbols)
+        self._available_symbols = available_symbols
+
+        if added_symbols or removed_symbols:
+            self.update_available_symbols(added_symbols, removed_symbols)
+
+    def update_available_symbols(self, added_symbols, removed_symbols):
+        """
+        Add the list of strings 'added_symbols' to the autocomplete list of
+        symbols, and remove 'removed_symbols' from it
+        """
+        if self._use_native:
+            self._native.update_available_symbols(self._window_handler,
+                                                  added_symbols,
+                                                  removed_symbols)
+            return
+
+        self._lib.giw_update_available_symbols(self._window_handler,
+                                               added_symbols,
+                                               removed_symbols)
 
     def get_observed_buffers(self):
         """
         Get a list with the currently observed symbols in the giw window
         """
+        if self._use_native:
+            return self._native.get_observed_buffers(self._window_handler)
+
         return self._lib.giw_get_observed_buffers(self._window_handler)
 
-    def _ui_thread(self, plot_callback):
+    def get_buffers_to_refresh(self):
+        """
+        Get a list with the observed symbols that must be fetched again at
+        this stop, according to their refresh policies. Must be called once
+        per stop.
+        """
+        if self._use_native:
+            return self._native.get_buffers_to_refresh(self._window_handler)
+
+        return self._lib.giw_get_buffers_to_refresh(self._window_handler)
+
+    def start_interaction_benchmark(self, report_path):
+        """
+        Replay synthetic pan/zoom input on the plotted buffers, writing the
+        latency measurements to report_path
+        """
+        self._lib.giw_start_interaction_benchmark(
+            self._window_handler, report_path.encode('utf-8'))
+
+    def is_interaction_benchmark_running(self):
+        """
+        Returns True while the interaction benchmark is running
+        """
+        return self._lib.giw_is_interaction_benchmark_running(
+            self._window_handler) == 1
+
+    def start_capture(self, capture_path):
+        """
+        Record every plotted buffer to capture_path, so that the session can
+        be reproduced later with replay_capture(). Returns True on success.
+        """
+        return self._lib.giw_capture_start(capture_path.encode('utf-8')) == 1
+
+    def stop_capture(self):
+        """
+        Stop recording plotted buffers
+        """
+        self._lib.giw_capture_stop()
+
+    def replay_capture(self, capture_path, max_speed):
+        """
+        Feed the buffers recorded in capture_path to the window, either with
+        their original timing or, if max_speed is True, as fast as the window
+        can process them. Blocks until the replay is finished and returns the
+        number of replayed buffers, or -1 if the file could not be read.
+        """
+        return self._lib.giw_replay_capture(self._window_handler,
+                                            capture_path.encode('utf-8'),
+                                            1 if max_speed else 0)
+
+    def is_buffer_condition_valid(self, condition):
+        """
+        Returns True if 'condition' is a valid buffer condition expression
+        (e.g. "max > 10" or "nan")
+        """
+        return self._lib.giw_is_buffer_condition_valid(
+            condition.encode('utf-8')) == 1
+
+    def evaluate_buffer_condition(self, buffer_metadata, condition):
+        """
+        Returns True if 'condition' holds for the buffer described by
+        buffer_metadata (as returned by the debugger bridge). Does not require
+        the window to be running.
+        """
+        if self._use_native:
+            return self._native.evaluate_buffer_condition(buffer_metadata,
+                                                          condition)
+
+        result = self._lib.giw_evaluate_buffer_condition(
+            buffer_metadata, condition.encode('utf-8'))
+        if result < 0:
+            raise Exception('Could not evaluate condition "%s"' % condition)
+
+        return result == 1
+
+    def compute_stats(self, buffer_metadata, histogram_bins=0):
+        """
+        Get a dict with the per-channel min, max, mean, count, nan_count and
+        inf_count (and, if histogram_bins is positive, histogram) of the buffer
+        described by buffer_metadata. Does not require the window to be
+        running.
+        """
+        if self._use_native:
+            return self._native.compute_stats(buffer_metadata, histogram_bins)
+
+        return self._lib.giw_compute_stats(buffer_metadata, histogram_bins)
+
+    def get_metrics(self):
+        """
+        Get a dict with the performance metrics collected by the giw window
+        """
+        return self._lib.giw_get_metrics(self._window_handler)
+
+    def _ui_thread(self, plot_callback, region_callback):
         # Initialize GIW lib
         app_handler = self._lib.giw_initialize()
+        # A new window starts without symbols
+        self._available_symbols = set()
         self._window_handler = self._lib.giw_create_window(plot_callback)
+        self._lib.giw_set_region_callback(self._window_handler,
+                                          region_callback)
         # Run UI loop
         self._lib.giw_exec(app_handler)
         # Cleanup GIW lib
@@ -161,7 +454,8 @@ class GdbImageWatchWindow():
             # is done by pysigset.
             wnd_thread_instance = threading.Thread(
                 target=self._ui_thread,
-                args=(FETCH_BUFFER_CBK_TYPE(self.plot_variable),)
+                args=(FETCH_BUFFER_CBK_TYPE(self.plot_variable),
+                      FETCH_REGION_CBK_TYPE(self.request_region))
             )
             wnd_thread_instance.daemon = True
             wnd_thread_instance.start()
@@ -173,22 +467,42 @@ class DeferredVariablePlotter():
     a buffer plot command. Useful for deferring the plot command to a safe
     thread.
     """
-    def __init__(self, variable, lib, bridge, window_handler):
+    def __init__(self, variable, plot_buffer, bridge):
         self._variable = variable
-        self._lib = lib
+        self._plot_buffer = plot_buffer
         self._bridge = bridge
-        self._window_handler = window_handler
 
     def __call__(self):
         try:
-            buffer_metadata = self._bridge.get_buffer_metadata(self._variable)
+            buffer_metadata = self._bridge.get_buffer_metadata(
+                self._variable, allow_overview=True)
 
             if buffer_metadata is not None:
-                self._lib.giw_plot_buffer(
-                    self._window_handler,
-                    buffer_metadata)
+                self._plot_buffer(buffer_metadata)
         except Exception as err:
             import traceback
             print('[gdb-imagewatch] Error: Could not plot variable')
             print(err)
             traceback.print_exc()
+
+
+class DeferredRegionPlotter():
+    """
+    Callable object that fetches a region of a buffer and sends it to the
+    window, like DeferredVariablePlotter does for whole buffers.
+    """
+    def __init__(self, variable, region, plot_buffer, bridge):
+        self._variable = variable
+        self._region = region
+        self._plot_buffer = plot_buffer
+        self._bridge = bridge
+
+    def __call__(self):
+        try:
+            buffer_metadata = self._bridge.get_buffer_region(self._variable,
+                                                             *self._region)
+            self._plot_buffer(buffer_metadata)
+        except Exception as err:
+            print('[gdb-imagewatch] Error: Could not fetch region of %s' %
+                  self._variable)
+            print(err)
@@ -0,0 +1,79 @@
+# -*- coding: utf-8 -*-
+
+"""
+Human readable formatting of the metrics dict returned by giw_get_metrics()
+"""
+
+# Names of the instruction sets of the pixel kernels (see simd_dispatch.h)
+_SIMD_LEVEL_NAMES = {0: 'generic', 1: 'sse2', 2: 'avx2', 3: 'avx512'}
+
+
+def format_bytes(num_bytes):
+    """
+    Format a number of bytes with a binary unit, e.g. '1.5 MiB'
+    """
+    for unit in ['B', 'KiB', 'MiB']:
+        if num_bytes < 1024:
+            return '%.1f %s' % (num_bytes, unit)
+        num_bytes /= 1024.0
+    return '%.1f GiB' % num_bytes
+
+
+def _format_histogram(name, histogram):
+    return ('  %-24s n=%-7d mean=%-10.1f p50=%-8d p90=%-8d p99=%-8d '
+            'max=%d' % (name,
+                        histogram['count'],
+                        histogram['mean'],
+                        histogram['p50'],
+                        histogram['p90'],
+                        histogram['p99'],
+                        histogram['max']))
+
+
+def format_metrics(metrics):
+    """
+    Render the metrics dict as a multi-line report
+    """
+    lines = ['Counters:']
+    for name, value in sorted(metrics['counters'].items()):
+        if name.startswith('bytes_'):
+            value = format_bytes(value)
+        lines.append('  %-24s %s' % (name, value))
+
+    lines.append('Gauges:')
+    for name, value in sorted(metrics['gauges'].items()):
+        if name == 'simd_level':
+            value = _SIMD_LEVEL_NAMES.get(value, value)
+        lines.append('  %-24s %s' % (name, value))
+
+    lines.append('Stage latencies (us):')
+    for name, histogram in sorted(metrics['latencies_us'].items()):
+        lines.append(_format_histogram(name, histogram))
+
+    lines.append('Histograms:')
+    for name, histogram in sorted(metrics['histograms'].items()):
+        lines.append(_format_histogram(name, histogram))
+
+    lines.append('Caches:')
+    for name, cache in sorted(metrics['caches'].items()):
+        lines.append('  %-24s hits=%-7d misses=%-7d hit rate=%.1f%%' %
+                     (name,
+                      cache['hits'],
+                      cache['misses'],
+                      100.0 * cache['hit_rate']))
+
+    lines.append('Buffers:')
+    total_host = 0
+    total_gpu = 0
+    for name, memory in sorted(metrics['buffers'].items()):
+        total_host += memory['host_bytes']
+        total_gpu += memory['gpu_bytes']
+        lines.append('  %-24s host=%-12s gpu=%s' %
+                     (name,
+                      format_bytes(memory['host_bytes']),
+                      format_bytes(memory['gpu_bytes'])))
+    lines.append('  %-24s host=%-12s gpu=%s' %
+                 ('(total)', format_bytes(total_host),
+                  format_bytes(total_gpu)))
+
+    return '\n'.join(lines)
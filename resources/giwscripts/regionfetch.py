@@ -0,0 +1,169 @@
+# -*- coding: utf-8 -*-
+
+"""
+Reads of buffers too large to be fetched from the debuggee at full
+resolution. Such buffers are first shown as an overview, made of every n-th
+pixel of every n-th row; as the window zooms in, the visible regions are read
+again with a finer sampling step. Buffers whose rows are padded (e.g. OpenCV
+ROIs, whose row stride is the width of their parent) are read the same way,
+so that the padding is never read, and so are the slices of buffers requested
+with a Python-style slice expression (e.g. 'img[100:612, ::2]').
+"""
+
+from giwscripts import gatherread
+
+# Buffers larger than this are fetched as an overview of at most this size
+MAX_FULL_FETCH_BYTES = 64 * 1024 * 1024
+# Rows of a sampled region are read in batches of at most this size
+MAX_BATCH_BYTES = 16 * 1024 * 1024
+
+
+def num_samples(size, step):
+    """
+    Number of pixels sampled along an axis of 'size' pixels, one every 'step'
+    """
+    return (size + step - 1) // step
+
+
+def parse_slice(expression):
+    """
+    Split an expression ending in a Python-style slice, such as
+    'img[100:612, 200:712]' or 'img[::4, ::4]', into the expression of the
+    buffer and a list with the slice of its rows and, optionally, the slice of
+    its columns. Expressions without a slice (including C++ subscripts, such
+    as 'images[2]') are returned with a None slice.
+    """
+    expression = expression.strip()
+    if not expression.endswith(']'):
+        return expression, None
+
+    # Find the bracket that opens the last subscript
+    depth = 0
+    for begin in range(len(expression) - 1, -1, -1):
+        if expression[begin] == ']':
+            depth += 1
+        elif expression[begin] == '[':
+            depth -= 1
+            if depth == 0:
+                break
+
+    subscript = expression[begin + 1:-1]
+    if depth != 0 or ':' not in subscript or begin == 0:
+        return expression, None
+
+    slices = []
+    for axis_slice in subscript.split(','):
+        bounds = [bound.strip() for bound in axis_slice.split(':')]
+        # Subscripts whose bounds are not all integer literals are C++
+        # expressions (e.g. 'imgs[ns::k]' or 'imgs[c ? 0 : 1]'), which are
+        # left to the debugger
+        try:
+            bounds = [int(bound, 0) if bound else None for bound in bounds]
+        except ValueError:
+            return expression, None
+        if len(bounds) > 3:
+            raise Exception('Invalid slice %s' % axis_slice.strip())
+        if len(bounds) == 1:
+            # A single index selects a single row or column
+            bounds = [bounds[0], bounds[0] + 1 if bounds[0] != -1 else None]
+        slices.append(slice(*bounds))
+
+    if len(slices) > 2:
+        raise Exception('Buffers can only be sliced along two axes')
+
+    return expression[:begin].strip(), slices
+
+
+def get_slice_region(slices, width, height):
+    """
+    Region of a buffer of 'width' x 'height' pixels selected by the slices
+    returned by parse_slice, as a tuple (x, y, width, height, step): every
+    'step'-th pixel of every 'step'-th row of [x, x + width) x
+    [y, y + height) is selected.
+    """
+    if slices is None:
+        return 0, 0, width, height, 1
+
+    rows = slices[0]
+    columns = slices[1] if len(slices) > 1 else slice(None)
+
+    first_row, last_row, row_step = rows.indices(height)
+    first_column, last_column, column_step = columns.indices(width)
+    if row_step != column_step:
+        raise Exception('Rows and columns must be sliced with the same step')
+    if row_step <= 0:
+        raise Exception('Slice steps must be positive')
+    if last_row <= first_row or last_column <= first_column:
+        raise Exception('Empty buffer slice')
+
+    return (first_column,
+            first_row,
+            last_column - first_column,
+            last_row - first_row,
+            row_step)
+
+
+def get_overview_step(width, height, row_size, pixel_size,
+                      max_fetch_bytes=MAX_FULL_FETCH_BYTES):
+    """
+    Sampling step of the overview of a buffer, whose rows are 'row_size'
+    bytes apart. Returns 1 if the whole buffer can be fetched; otherwise, the
+    smallest power of two step whose samples fit in 'max_fetch_bytes'.
+    """
+    step = 1
+
+    if height * row_size <= max_fetch_bytes:
+        return step
+
+    while (num_samples(width, step) * num_samples(height, step) *
+           pixel_size > max_fetch_bytes):
+        step *= 2
+
+    return step
+
+
+def read_region(inferior, executable, address, row_size, pixel_size,
+                x, y, width, height, step):
+    """
+    Read every 'step'-th pixel of every 'step'-th row of the region
+    [x, x + width) x [y, y + height) of the buffer at 'address', whose rows
+    are 'row_size' bytes apart. Only the sampled rows are read, and only up
+    to their last sampled pixel. Returns a bytearray with the samples, with
+    num_samples(width, step) pixels per row.
+    """
+    sampled_width = num_samples(width, step)
+    sampled_height = num_samples(height, step)
+    sampled_row_size = sampled_width * pixel_size
+    read_size = ((sampled_width - 1) * step + 1) * pixel_size
+
+    contents = bytearray(sampled_row_size * sampled_height)
+    row_addresses = [address + (y + row * step) * row_size + x * pixel_size
+                     for row in range(sampled_height)]
+
+    if step == 1:
+        # Rows are packed right into the result
+        gatherread.read_rows(inferior, executable, row_addresses, read_size,
+                             contents)
+        gatherread.record_read(len(contents), len(contents))
+        return contents
+
+    rows_per_batch = max(1, MAX_BATCH_BYTES // read_size)
+    batch = bytearray(min(rows_per_batch, sampled_height) * read_size)
+
+    for first_row in range(0, sampled_height, rows_per_batch):
+        batch_addresses = row_addresses[first_row:first_row + rows_per_batch]
+        gatherread.read_rows(inferior, executable, batch_addresses,
+                             read_size, batch)
+
+        for row in range(len(batch_addresses)):
+            row_contents = batch[row * read_size:(row + 1) * read_size]
+            row_begin = (first_row + row) * sampled_row_size
+
+            # Copy one byte of each sampled pixel at a time
+            for byte in range(pixel_size):
+                contents[row_begin + byte:row_begin + sampled_row_size:
+                         pixel_size] = row_contents[byte::step * pixel_size]
+
+    gatherread.record_read(sampled_height * read_size, len(contents))
+
+    return contents
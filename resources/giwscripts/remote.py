@@ -0,0 +1,745 @@
+# -*- coding: utf-8 -*-
+
+"""
+Split mode for debugging on a remote host. A headless agent runs inside the
+debugger (see the giw-agent command) and serves buffers over a socket to a
+viewer running on the local machine (gdb-imagewatch.py --connect), so that
+only the pixels being looked at cross the network, instead of the frames of a
+forwarded window.
+
+The agent reads buffers too large for the link as an overview (see
+regionfetch), whose tiles are requested by the viewer as the user zooms in.
+Every buffer and tile is sent losslessly compressed with zlib; when the
+viewer already holds a previous version of it (e.g. at the next stop), only
+its XOR against that version is compressed, which reduces the unchanged
+pixels to runs of zeros.
+
+Both ends can throttle their socket to a given number of bytes per second,
+which allows testing the protocol over the loopback interface with the
+bandwidth of a real link.
+"""
+
+import collections
+import json
+import queue
+import signal
+import socket
+import struct
+import threading
+import time
+import zlib
+
+from giwscripts import giwwindow
+from giwscripts import metrics_report
+from giwscripts.debuggers.interfaces import BridgeInterface
+from giwscripts.thirdparty.pysigset import pysigset
+
+PROTOCOL_VERSION = 1
+DEFAULT_PORT = 9510
+# Buffers larger than this are sent as an overview, whose tiles are fetched
+# on demand
+REMOTE_MAX_FULL_FETCH_BYTES = 4 * 1024 * 1024
+# Previous versions of buffers and tiles kept by each end for delta encoding
+VERSION_CACHE_BYTES = 256 * 1024 * 1024
+# zlib level: the faster levels already remove most of the redundancy of the
+# XOR deltas
+COMPRESSION_LEVEL = 1
+# Throttled sockets are written and read in chunks of at most this size
+THROTTLE_CHUNK_BYTES = 16 * 1024
+# Maximum time waited for the response of the agent
+RESPONSE_TIMEOUT_SECONDS = 300
+
+# Message frame: length of the JSON header and length of the payload
+_FRAME = struct.Struct('!II')
+# Suffixes accepted by parse_bandwidth
+_BANDWIDTH_UNITS = {'': 1, 'K': 1024, 'M': 1024 * 1024, 'G': 1024 ** 3}
+
+
+def parse_address(address):
+    """
+    Split a '[host:]port' string into a (host, port) tuple. The host defaults
+    to the loopback interface, so that the agent is only reachable through an
+    SSH tunnel unless explicitly requested otherwise.
+    """
+    host, _, port = address.rpartition(':')
+    return host or '127.0.0.1', int(port)
+
+
+def parse_bandwidth(rate):
+    """
+    Convert a rate such as '500K' or '2M' (bytes per second) into a number of
+    bytes per second. Returns None for a None rate (no limit).
+    """
+    if rate is None:
+        return None
+
+    rate = rate.strip().upper()
+    unit = rate[-1:] if rate[-1:] in _BANDWIDTH_UNITS else ''
+    value = float(rate[:len(rate) - len(unit)]) * _BANDWIDTH_UNITS[unit]
+    if value <= 0:
+        raise ValueError('Bandwidth limit must be positive')
+
+    return value
+
+
+class _TokenBucket():
+    """
+    Limits the throughput of a socket to 'rate' bytes per second, allowing
+    bursts of up to a tenth of a second of traffic
+    """
+    def __init__(self, rate):
+        self._rate = rate
+        self._capacity = max(rate / 10, THROTTLE_CHUNK_BYTES)
+        self._tokens = self._capacity
+        self._last_refill = time.monotonic()
+
+    def consume(self, size):
+        """
+        Block until 'size' bytes can go through the socket
+        """
+        while True:
+            now = time.monotonic()
+            self._tokens = min(self._capacity,
+                               self._tokens +
+                               (now - self._last_refill) * self._rate)
+            self._last_refill = now
+
+            if self._tokens >= size:
+                self._tokens -= size
+                return
+
+            time.sleep((size - self._tokens) / self._rate)
+
+
+class _Connection():
+    """
+    Sends and receives framed messages, made of a JSON header and a binary
+    payload, optionally throttled to a given bandwidth in each direction
+    """
+    def __init__(self, sock, bandwidth_limit=None):
+        self._socket = sock
+        self._socket.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self._send_lock = threading.Lock()
+        self._send_bucket = None
+        self._recv_bucket = None
+        if bandwidth_limit is not None:
+            self._send_bucket = _TokenBucket(bandwidth_limit)
+            self._recv_bucket = _TokenBucket(bandwidth_limit)
+        # Bytes that went through the socket, for giw-agent status
+        self.bytes_sent = 0
+        self.bytes_received = 0
+
+    def send(self, header, payload=b''):
+        """
+        Send a message. Can be called from any thread.
+        """
+        header = json.dumps(header).encode('utf-8')
+
+        with self._send_lock:
+            self._send_all(_FRAME.pack(len(header), len(payload)))
+            self._send_all(header)
+            self._send_all(payload)
+
+    def receive(self):
+        """
+        Block until a message arrives, and return its header and payload.
+        Raises EOFError if the other end closed the connection.
+        """
+        header_size, payload_size = _FRAME.unpack(
+            self._receive_exactly(_FRAME.size))
+        header = json.loads(self._receive_exactly(header_size).decode('utf-8'))
+        return header, self._receive_exactly(payload_size)
+
+    def close(self):
+        """
+        Close the socket, interrupting any thread blocked on it
+        """
+        try:
+            self._socket.shutdown(socket.SHUT_RDWR)
+        except OSError:
+            pass
+        self._socket.close()
+
+    def _send_all(self, data):
+        data = memoryview(data).cast('B')
+
+        if self._send_bucket is None:
+            self._socket.sendall(data)
+        else:
+            for begin in range(0, len(data), THROTTLE_CHUNK_BYTES):
+                chunk = data[begin:begin + THROTTLE_CHUNK_BYTES]
+                self._send_bucket.consume(len(chunk))
+                self._socket.sendall(chunk)
+
+        self.bytes_sent += len(data)
+
+    def _receive_exactly(self, size):
+        contents = bytearray(size)
+        view = memoryview(contents)
+        received = 0
+
+        while received < size:
+            chunk_size = size - received
+            if self._recv_bucket is not None:
+                chunk_size = min(chunk_size, THROTTLE_CHUNK_BYTES)
+                self._recv_bucket.consume(chunk_size)
+
+            chunk_received = self._socket.recv_into(view[received:],
+                                                    chunk_size)
+            if chunk_received == 0:
+                raise EOFError('Connection closed by the other end')
+            received += chunk_received
+
+        self.bytes_received += size
+        return contents
+
+
+class _VersionCache():
+    """
+    Last version of each buffer and tile sent through a connection. The agent
+    and the viewer perform the same sequence of operations on their caches,
+    so that both always agree on the base of the deltas without having to
+    negotiate it.
+    """
+    def __init__(self, max_bytes=VERSION_CACHE_BYTES):
+        self._max_bytes = max_bytes
+        self._size = 0
+        self._versions = collections.OrderedDict()
+
+    def get(self, key):
+        """
+        Previous version stored under 'key', or None
+        """
+        contents = self._versions.get(key)
+        if contents is not None:
+            self._versions.move_to_end(key)
+        return contents
+
+    def put(self, key, contents):
+        """
+        Store 'contents' as the current version of 'key', evicting the least
+        recently used versions if the cache is full
+        """
+        previous = self._versions.pop(key, None)
+        if previous is not None:
+            self._size -= len(previous)
+
+        if len(contents) > self._max_bytes:
+            return
+
+        self._versions[key] = contents
+        self._size += len(contents)
+        while self._size > self._max_bytes:
+            _, evicted = self._versions.popitem(last=False)
+            self._size -= len(evicted)
+
+
+def _xor_bytes(contents, base):
+    """
+    Byte-wise XOR of two buffers of the same size
+    """
+    return (int.from_bytes(contents, 'little') ^
+            int.from_bytes(base, 'little')).to_bytes(len(contents), 'little')
+
+
+def _version_key(request):
+    """
+    Key under which the versions of the buffer or tile fetched by 'request'
+    are stored
+    """
+    return json.dumps([request['variable'], request.get('region')])
+
+
+def _encode_contents(contents, base):
+    """
+    Compress 'contents', as a delta against 'base' if both have the same
+    size. Returns the payload and the header fields describing its encoding.
+    """
+    delta = base is not None and len(base) == len(contents)
+    payload = zlib.compress(_xor_bytes(contents, base) if delta else contents,
+                            COMPRESSION_LEVEL)
+
+    # Random data does not compress; it is cheaper to send it as is
+    if len(payload) >= len(contents):
+        return contents, dict(encoding='raw', delta=False)
+
+    return payload, dict(encoding='zlib', delta=delta)
+
+
+def _decode_contents(header, payload, base):
+    """
+    Inverse of _encode_contents
+    """
+    if header['encoding'] == 'raw':
+        return payload
+
+    contents = zlib.decompress(payload)
+    if header['delta']:
+        contents = _xor_bytes(contents, base)
+
+    return bytearray(contents)
+
+
+class TileAgent():
+    """
+    Serves the buffers of the debugger to a remote viewer. It stands in for
+    the window in the debugger event handlers: the UI requests (stops, plot
+    commands, symbol lists) are forwarded to the viewer, while the buffer
+    statistics and conditions are still evaluated by the local library.
+    """
+    def __init__(self, local_window, bridge, address, bandwidth_limit=None):
+        self._local_window = local_window
+        self._bridge = bridge
+        self._bandwidth_limit = bandwidth_limit
+        self._lock = threading.Lock()
+        self._connection = None
+        self._send_queue = None
+        self._symbols = set()
+        self._counters = collections.Counter(dict.fromkeys(
+            ['buffers_sent', 'deltas_sent', 'bytes_uncompressed',
+             'bytes_compressed', 'bytes_sent', 'bytes_received'], 0))
+
+        self._server = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        self._server.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        self._server.bind(parse_address(address))
+        self._server.listen(1)
+        self.address = '%s:%d' % self._server.getsockname()
+
+        # Overviews are much cheaper than whole buffers on a slow link
+        self._bridge.set_max_fetch_bytes(REMOTE_MAX_FULL_FETCH_BYTES)
+
+        # Our threads must not receive the signals meant for GDB (see
+        # GdbImageWatchWindow.initialize_window)
+        with pysigset.suspended_signals(signal.SIGCHLD):
+            listener = threading.Thread(target=self._accept_viewers,
+                                        daemon=True)
+            listener.start()
+
+    def close(self):
+        """
+        Stop listening and disconnect the viewer
+        """
+        self._bridge.set_max_fetch_bytes(None)
+        self._server.close()
+        with self._lock:
+            self._disconnect()
+
+    def get_counters(self):
+        """
+        Return a dict with the traffic of the agent since it was started
+        """
+        with self._lock:
+            counters = collections.Counter(self._counters)
+            if self._connection is not None:
+                counters['bytes_sent'] += self._connection.bytes_sent
+                counters['bytes_received'] += self._connection.bytes_received
+            counters['viewer_connected'] = self._connection is not None
+        return dict(counters)
+
+    def _accept_viewers(self):
+        while True:
+            try:
+                sock, _ = self._server.accept()
+            except OSError:
+                # The server socket was closed
+                return
+
+            connection = _Connection(sock, self._bandwidth_limit)
+            send_queue = queue.Queue()
+
+            # A new viewer replaces the previous one. It receives the whole
+            # symbol list, and then its changes at every stop
+            with self._lock:
+                self._disconnect()
+                self._connection = connection
+                self._send_queue = send_queue
+                send_queue.put((dict(type='hello',
+                                     version=PROTOCOL_VERSION,
+                                     symbols=list(self._symbols)), None))
+
+            with pysigset.suspended_signals(signal.SIGCHLD):
+                for target in (self._serve_viewer, self._send_messages):
+                    threading.Thread(target=target,
+                                     args=(connection, send_queue),
+                                     daemon=True).start()
+
+    def _disconnect(self):
+        """
+        Must be called with self._lock held
+        """
+        if self._connection is None:
+            return
+
+        self._counters['bytes_sent'] += self._connection.bytes_sent
+        self._counters['bytes_received'] += self._connection.bytes_received
+        self._connection.close()
+        # Wake the sender thread up, so that it can exit
+        self._send_queue.put(None)
+        self._connection = None
+        self._send_queue = None
+
+    def _serve_viewer(self, connection, send_queue):
+        """
+        Read the requests of the viewer, and read the requested buffers in
+        the debugger thread
+        """
+        try:
+            while True:
+                request, _ = connection.receive()
+                self._bridge.queue_request(_DeferredTileRead(request,
+                                                             self._bridge,
+                                                             send_queue))
+        except (EOFError, OSError, ValueError):
+            with self._lock:
+                if self._connection is connection:
+                    self._disconnect()
+
+    def _send_messages(self, connection, send_queue):
+        """
+        Encode and send the messages queued for the viewer, in order. The
+        compression happens here, so that the debugger thread never waits for
+        the link.
+        """
+        versions = _VersionCache()
+
+        while True:
+            message = send_queue.get()
+            if message is None:
+                return
+
+            header, buffer_metadata = message
+            payload = b''
+
+            if buffer_metadata is not None:
+                contents = bytes(buffer_metadata['pointer'])
+                key = _version_key(header)
+                payload, encoding = _encode_contents(contents,
+                                                     versions.get(key))
+                versions.put(key, contents)
+
+                # The modified rows are relative to the previous read of the
+                # change tracker, which the viewer may never have plotted
+                # (e.g. if its request timed out, or if it was made for the
+                # local window), so they are not sent
+                header.update(encoding)
+                header['metadata'] = {name: value for name, value
+                                      in buffer_metadata.items()
+                                      if name not in ('pointer', 'dirty_rows')}
+                with self._lock:
+                    self._counters['buffers_sent'] += 1
+                    self._counters['deltas_sent'] += int(encoding['delta'])
+                    self._counters['bytes_uncompressed'] += len(contents)
+                    self._counters['bytes_compressed'] += len(payload)
+
+            try:
+                connection.send(header, payload)
+            except OSError:
+                return
+
+    def _notify(self, header):
+        with self._lock:
+            if self._send_queue is not None:
+                self._send_queue.put((header, None))
+
+    # The methods below are called by the debugger event handlers, in place
+    # of the GdbImageWatchWindow ones
+
+    def is_ready(self):
+        """
+        The agent is always ready; messages are dropped while no viewer is
+        connected
+        """
+        return True
+
+    def initialize_window(self):
+        """
+        The window is created by the viewer
+        """
+        pass
+
+    def terminate(self):
+        """
+        Request the viewer to close its window
+        """
+        self._notify(dict(type='exit'))
+
+    def set_available_symbols(self, observable_symbols):
+        """
+        Forward the changes of the autocomplete list to the viewer
+        """
+        available_symbols = set(observable_symbols)
+
+        with self._lock:
+            added_symbols = list(available_symbols - self._symbols)
+            removed_symbols = list(self._symbols - available_symbols)
+            self._symbols = available_symbols
+
+            if self._send_queue is not None and (added_symbols or
+                                                 removed_symbols):
+                self._send_queue.put((dict(type='symbols',
+                                           added=added_symbols,
+                                           removed=removed_symbols), None))
+
+    def get_buffers_to_refresh(self):
+        """
+        Called once per stop. The refresh policies of the buffers are known by
+        the viewer, which requests the ones to be refreshed itself.
+        """
+        self._notify(dict(type='stop'))
+        return []
+
+    def plot_variable(self, requested_symbol):
+        """
+        Request the viewer to plot 'requested_symbol'
+        """
+        self._notify(dict(type='plot', variable=requested_symbol))
+        return 1
+
+    def get_metrics(self):
+        """
+        The metrics are collected by the viewer's window
+        """
+        return None
+
+    def start_capture(self, capture_path):
+        """
+        Captures are recorded by the window, which is not available here
+        """
+        return False
+
+    def stop_capture(self):
+        """
+        See start_capture
+        """
+        pass
+
+    def is_buffer_condition_valid(self, condition):
+        """
+        See GdbImageWatchWindow.is_buffer_condition_valid
+        """
+        return self._local_window.is_buffer_condition_valid(condition)
+
+    def evaluate_buffer_condition(self, buffer_metadata, condition):
+        """
+        See GdbImageWatchWindow.evaluate_buffer_condition
+        """
+        return self._local_window.evaluate_buffer_condition(buffer_metadata,
+                                                            condition)
+
+    def compute_stats(self, buffer_metadata, histogram_bins=0):
+        """
+        See GdbImageWatchWindow.compute_stats
+        """
+        return self._local_window.compute_stats(buffer_metadata,
+                                                histogram_bins)
+
+
+class _DeferredTileRead():
+    """
+    Callable object that reads the buffer or tile requested by the viewer in
+    the debugger thread, and queues it to be sent
+    """
+    def __init__(self, request, bridge, send_queue):
+        self._request = request
+        self._bridge = bridge
+        self._send_queue = send_queue
+
+    def __call__(self):
+        header = dict(type='buffer',
+                      id=self._request['id'],
+                      variable=self._request['variable'],
+                      region=self._request.get('region'))
+
+        try:
+            if header['region'] is None:
+                buffer_metadata = self._bridge.get_buffer_metadata(
+                    header['variable'],
+                    self._request.get('allow_overview', False))
+            else:
+                buffer_metadata = self._bridge.get_buffer_region(
+                    header['variable'], *header['region'])
+        except Exception as err:
+            self._send_queue.put((dict(type='error',
+                                       id=header['id'],
+                                       message=str(err)), None))
+            return
+
+        if buffer_metadata is None:
+            header['type'] = 'missing'
+        self._send_queue.put((header, buffer_metadata))
+
+
+class RemoteBridge(BridgeInterface):
+    """
+    Debugger bridge of the viewer: buffers are requested from the agent, one
+    at a time, in a worker thread
+    """
+    def __init__(self, connection):
+        self._connection = connection
+        self._versions = _VersionCache()
+        self._responses = queue.Queue()
+        self._next_request_id = 0
+        self._symbols = set()
+
+        self._request_queue = queue.Queue()
+        threading.Thread(target=self._request_consumer, daemon=True).start()
+
+    def _request_consumer(self):
+        while True:
+            self._request_queue.get()()
+
+    def queue_request(self, callable_request):
+        self._request_queue.put(callable_request)
+
+    def get_buffer_metadata(self, variable, allow_overview=False):
+        return self._fetch(dict(variable=variable,
+                                allow_overview=allow_overview))
+
+    def get_buffer_region(self, variable, x, y, width, height, step):
+        return self._fetch(dict(variable=variable,
+                                region=[x, y, width, height, step]))
+
+    def _fetch(self, request):
+        request.update(type='fetch', id=self._next_request_id)
+        self._next_request_id += 1
+        self._connection.send(request)
+
+        # Responses to requests that timed out are discarded
+        while True:
+            try:
+                header, buffer_metadata = self._responses.get(
+                    timeout=RESPONSE_TIMEOUT_SECONDS)
+            except queue.Empty:
+                raise Exception('Timed out waiting for the agent')
+
+            if header['id'] == request['id']:
+                break
+
+        if header['type'] == 'error':
+            raise Exception(header['message'])
+
+        return buffer_metadata
+
+    def on_response(self, header, payload):
+        """
+        Called by the receiver thread with the responses to the requests.
+        Every buffer is decoded, even if its request timed out, so that the
+        version cache stays in sync with the one of the agent.
+        """
+        buffer_metadata = None
+
+        if header['type'] == 'buffer':
+            key = _version_key(header)
+            contents = _decode_contents(header, payload,
+                                        self._versions.get(key))
+            self._versions.put(key, contents)
+
+            buffer_metadata = header['metadata']
+            buffer_metadata['pointer'] = memoryview(contents)
+            # JSON turned the tuple fields into lists
+            for field in ('region', 'slice'):
+                if field in buffer_metadata:
+                    buffer_metadata[field] = tuple(buffer_metadata[field])
+
+        self._responses.put((header, buffer_metadata))
+
+    def update_available_symbols(self, added_symbols, removed_symbols):
+        """
+        Called by the receiver thread with the changes to the symbol list of
+        the agent
+        """
+        self._symbols.difference_update(removed_symbols)
+        self._symbols.update(added_symbols)
+
+    def get_available_symbols(self):
+        return list(self._symbols)
+
+    def get_casted_pointer(self, typename, debugger_object):
+        raise NotImplementedError('Not available in the viewer')
+
+    def register_event_handlers(self, events):
+        pass
+
+    def is_resumable_stop(self, event):
+        return False
+
+    def resume(self):
+        pass
+
+    def set_max_fetch_bytes(self, max_fetch_bytes):
+        pass
+
+
+def giwviewer(script_path, address, bandwidth_limit):
+    """
+    Entry point for the viewer mode: connect to the agent started with
+    giw-agent listen at 'address', and show its buffers
+    """
+    try:
+        sock = socket.create_connection(parse_address(address))
+    except OSError as err:
+        print('[gdb-imagewatch] Error: Could not connect to %s: %s' %
+              (address, err))
+        return
+
+    connection = _Connection(sock, bandwidth_limit)
+    header, _ = connection.receive()
+    if header.get('version') != PROTOCOL_VERSION:
+        print('[gdb-imagewatch] Error: Incompatible agent protocol version %s'
+              % header.get('version'))
+        connection.close()
+        return
+
+    bridge = RemoteBridge(connection)
+    bridge.update_available_symbols(header['symbols'], [])
+
+    window = giwwindow.GdbImageWatchWindow(script_path, bridge)
+    window.initialize_window()
+
+    try:
+        while not window.is_ready():
+            time.sleep(0.1)
+        window.set_available_symbols(bridge.get_available_symbols())
+
+        receiver = threading.Thread(target=_receive_messages,
+                                    args=(connection, bridge, window),
+                                    daemon=True)
+        receiver.start()
+
+        while window.is_ready() and receiver.is_alive():
+            time.sleep(0.5)
+    except KeyboardInterrupt:
+        pass
+
+    print('[gdb-imagewatch] Received %s from the agent' %
+          metrics_report.format_bytes(connection.bytes_received))
+    connection.close()
+    window.terminate()
+
+
+def _receive_messages(connection, bridge, window):
+    """
+    Dispatch the messages of the agent, until the connection is closed
+    """
+    while True:
+        try:
+            header, payload = connection.receive()
+        except (EOFError, OSError):
+            print('[gdb-imagewatch] Connection to the agent was closed')
+            return
+
+        message_type = header['type']
+        if message_type in ('buffer', 'missing', 'error'):
+            bridge.on_response(header, payload)
+        elif message_type == 'symbols':
+            bridge.update_available_symbols(header['added'],
+                                            header['removed'])
+            window.set_available_symbols(bridge.get_available_symbols())
+        elif message_type == 'stop':
+            for buffer_name in window.get_buffers_to_refresh():
+                window.plot_variable(buffer_name)
+        elif message_type == 'plot':
+            window.plot_variable(header['variable'])
+        elif message_type == 'exit':
+            window.terminate()
+            return
@@ -0,0 +1,49 @@
+# -*- coding: utf-8 -*-
+
+"""
+Capture replay: feeds the buffers recorded with the giw-capture command to a
+window, without requiring a debugger session.
+"""
+
+import time
+
+from giwscripts import giwwindow
+from giwscripts import test
+
+
+def giwreplay(script_path, capture_path, max_speed):
+    """
+    Entry point for the capture replay mode. With max_speed, the window is
+    closed as soon as all buffers were processed, so that the mode can be used
+    for timing the plot pipeline.
+    """
+    dummy_debugger = test.DummyDebugger({})
+
+    window = giwwindow.GdbImageWatchWindow(script_path, dummy_debugger)
+    window.initialize_window()
+
+    try:
+        # Wait for window to initialize
+        while not window.is_ready():
+            time.sleep(0.1)
+
+        replay_start = time.monotonic()
+        num_requests = window.replay_capture(capture_path, max_speed)
+        elapsed = time.monotonic() - replay_start
+
+        if num_requests < 0:
+            print('[gdb-imagewatch] Error: Could not read capture %s'
+                  % capture_path)
+        else:
+            print('Replayed %d plot requests in %.3fs' %
+                  (num_requests, elapsed))
+
+        if not max_speed:
+            while window.is_ready():
+                time.sleep(0.1)
+
+    except KeyboardInterrupt:
+        pass
+
+    window.terminate()
+    dummy_debugger.kill()
@@ -138,10 +138,13 @@ class DummyDebugger(BridgeInterface):
     Very simple implementation of a debugger bridge for the sake of the test
     mode.
     """
-    def __init__(self):
-        width = 400
-        height = 200
-        self._buffers = _gen_buffers(width, height)
+    def __init__(self, buffers=None):
+        if buffers is None:
+            width = 400
+            height = 200
+            buffers = _gen_buffers(width, height)
+
+        self._buffers = buffers
         self._buffer_names = [name for name in self._buffers]
 
         self._is_running = True
@@ -180,7 +183,7 @@ class DummyDebugger(BridgeInterface):
         """
         return self._buffer_names
 
-    def get_buffer_metadata(self, var_name):
+    def get_buffer_metadata(self, var_name, allow_overview=False):
         """
         Search in the list of available buffers and return the requested one
         """
@@ -0,0 +1,100 @@
+# -*- coding: utf-8 -*-
+
+"""
+Python side of the pipeline tracer. Spans recorded here are forwarded to the
+native tracer in libgiwwindow, so that a single trace-event file covers the
+debugger thread, the bridge and the GUI thread.
+"""
+
+import atexit
+import os
+import threading
+import time
+
+
+_LIB = None
+_ENABLED = False
+_NAMED_THREADS = set()
+
+
+def set_native_library(lib):
+    """
+    Configure the native library that collects the spans. Called by the
+    giwwindow module once libgiwwindow has been loaded. If the environment
+    variable GIW_TRACE is set to a file path, tracing is enabled right away
+    and the trace is written to that path when the debugger exits.
+    """
+    global _LIB
+    _LIB = lib
+
+    trace_path = os.environ.get('GIW_TRACE')
+    if trace_path:
+        enable()
+        atexit.register(flush, trace_path)
+
+
+def enable():
+    """
+    Start recording spans
+    """
+    global _ENABLED
+    if _LIB is not None:
+        _LIB.giw_trace_set_enabled(1)
+        _ENABLED = True
+
+
+def disable():
+    """
+    Stop recording spans. Spans recorded so far are kept until flushed.
+    """
+    global _ENABLED
+    if _LIB is not None:
+        _LIB.giw_trace_set_enabled(0)
+        _ENABLED = False
+
+
+def flush(path):
+    """
+    Write all spans recorded since the last flush to 'path', in the Chrome
+    trace-event format. Returns True on success.
+    """
+    if _LIB is None:
+        return False
+
+    return _LIB.giw_trace_flush(path.encode('utf-8')) == 1
+
+
+def _now_us():
+    # Same clock as the native tracer (CLOCK_MONOTONIC)
+    return int(time.monotonic() * 1e6)
+
+
+class span():
+    """
+    Context manager that records the execution time of its body:
+
+        with tracer.span('read_memory'):
+            ...
+    """
+    def __init__(self, name):
+        self._name = name.encode('utf-8')
+        self._begin_us = 0
+
+    def __enter__(self):
+        self._begin_us = _now_us()
+        return self
+
+    def __exit__(self, *_):
+        # Spans are forwarded even when tracing is disabled, since they also
+        # feed the stage latency metrics
+        if _LIB is None:
+            return False
+
+        thread_id = threading.get_ident()
+        if _ENABLED and thread_id not in _NAMED_THREADS:
+            _NAMED_THREADS.add(thread_id)
+            _LIB.giw_trace_set_thread_name(
+                threading.current_thread().name.encode('utf-8'))
+
+        _LIB.giw_trace_record_span(self._name, self._begin_us, _now_us())
+        return False
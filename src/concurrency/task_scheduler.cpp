@@ -0,0 +1,301 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <csignal>
+#include <string>
+
+#include <pthread.h>
+
+#include "task_scheduler.h"
+
+#include "profiling/metrics.h"
+#include "profiling/tracer.h"
+
+
+using namespace std;
+
+
+// Index of the worker running in the calling thread, or -1 for other threads
+static thread_local int current_worker_index = -1;
+
+
+/**
+ * Blocks of a TaskScheduler::parallel_for() call, claimed one at a time by
+ * the calling thread and the workers helping it
+ */
+struct ParallelLoop
+{
+    const function<void(int)>* process_block;
+    int num_blocks;
+    atomic<int> next_block;
+
+    mutex done_mutex;
+    condition_variable done_cv;
+    int num_done_blocks;
+};
+
+
+static void run_parallel_blocks(ParallelLoop& loop)
+{
+    int block;
+
+    // Helpers that start after all blocks were claimed don't touch
+    // process_block, which may not exist anymore
+    while ((block = loop.next_block++) < loop.num_blocks) {
+        (*loop.process_block)(block);
+
+        unique_lock<mutex> lock(loop.done_mutex);
+        if (++loop.num_done_blocks == loop.num_blocks) {
+            loop.done_cv.notify_all();
+        }
+    }
+}
+
+
+CancellationToken::CancellationToken()
+    : cancelled_(make_shared<atomic<bool>>(false))
+{
+}
+
+
+void CancellationToken::cancel()
+{
+    *cancelled_ = true;
+}
+
+
+bool CancellationToken::is_cancelled() const
+{
+    return *cancelled_;
+}
+
+
+TaskScheduler& TaskScheduler::instance()
+{
+    // Never destroyed: joining the workers during static destruction would
+    // wait for tasks that may use objects already destroyed, or for a GDB
+    // that is tearing down the Python interpreter. The workers end with the
+    // process
+    static TaskScheduler* scheduler = new TaskScheduler();
+    return *scheduler;
+}
+
+
+TaskScheduler::TaskScheduler()
+    : next_queue_(0)
+    , num_queued_(0)
+{
+    // The thread calling parallel_for() takes part in the loop, so one core
+    // is left for it
+    const int num_threads =
+        static_cast<int>(max(thread::hardware_concurrency(), 2u)) - 1;
+
+    for (int i = 0; i < num_threads; ++i) {
+        queues_.emplace_back(new WorkerQueue());
+    }
+
+    // Threads inherit the signal mask of their creator: the workers are
+    // started with all signals blocked, and the mask of the calling thread
+    // is restored afterwards
+    sigset_t all_signals;
+    sigset_t previous_mask;
+    sigfillset(&all_signals);
+    pthread_sigmask(SIG_BLOCK, &all_signals, &previous_mask);
+
+    for (int i = 0; i < num_threads; ++i) {
+        workers_.emplace_back(&TaskScheduler::run_worker, this, i);
+    }
+
+    pthread_sigmask(SIG_SETMASK, &previous_mask, nullptr);
+
+    Metrics::set_gauge("task_workers", num_threads);
+}
+
+
+void TaskScheduler::submit(Task task,
+                           TaskPriority priority,
+                           const CancellationToken& token,
+                           Task on_complete)
+{
+    // Tasks submitted by a worker go to its own queue, where it is likely to
+    // find their data in its cache
+    const size_t index =
+        current_worker_index >= 0
+            ? static_cast<size_t>(current_worker_index)
+            : next_queue_++ % queues_.size();
+
+    {
+        // The task is queued and counted at once, so that the count is
+        // never decremented before being incremented
+        unique_lock<mutex> idle_lock(idle_mutex_);
+
+        WorkerQueue& queue = *queues_[index];
+        unique_lock<mutex> queue_lock(queue.mutex);
+        queue.tasks[static_cast<int>(priority)].push_back(
+            ScheduledTask{move(task), token, move(on_complete)});
+
+        ++num_queued_;
+        Metrics::set_gauge("queued_tasks", num_queued_);
+    }
+
+    idle_cv_.notify_one();
+}
+
+
+void TaskScheduler::parallel_for(int num_blocks,
+                                 const function<void(int)>& process_block)
+{
+    if (num_blocks <= 1) {
+        if (num_blocks == 1) {
+            process_block(0);
+        }
+        return;
+    }
+
+    // Shared with the helper tasks, which may outlive this call
+    shared_ptr<ParallelLoop> loop = make_shared<ParallelLoop>();
+    loop->process_block   = &process_block;
+    loop->num_blocks      = num_blocks;
+    loop->next_block      = 0;
+    loop->num_done_blocks = 0;
+
+    const int num_helpers = min(num_blocks - 1, num_workers());
+    for (int i = 0; i < num_helpers; ++i) {
+        submit([loop]() { run_parallel_blocks(*loop); }, TaskPriority::High);
+    }
+
+    run_parallel_blocks(*loop);
+
+    unique_lock<mutex> lock(loop->done_mutex);
+    loop->done_cv.wait(
+        lock, [&loop]() { return loop->num_done_blocks == loop->num_blocks; });
+}
+
+
+void TaskScheduler::run_completion_callbacks()
+{
+    deque<ScheduledTask> completions;
+
+    {
+        unique_lock<mutex> lock(completions_mutex_);
+        completions.swap(completions_);
+    }
+
+    for (auto& completion : completions) {
+        if (!completion.token.is_cancelled()) {
+            completion.on_complete();
+        }
+    }
+}
+
+
+int TaskScheduler::num_workers() const
+{
+    return static_cast<int>(workers_.size());
+}
+
+
+void TaskScheduler::run_worker(int index)
+{
+    current_worker_index = index;
+    Tracer::set_thread_name("task worker " + to_string(index));
+
+    while (true) {
+        {
+            unique_lock<mutex> lock(idle_mutex_);
+            idle_cv_.wait(lock, [this]() { return num_queued_ > 0; });
+        }
+
+        ScheduledTask scheduled_task;
+        if (!take_task(index, scheduled_task)) {
+            // Another worker is taking the last queued task
+            this_thread::yield();
+            continue;
+        }
+
+        {
+            unique_lock<mutex> lock(idle_mutex_);
+            --num_queued_;
+            Metrics::set_gauge("queued_tasks", num_queued_);
+        }
+
+        run_task(scheduled_task);
+    }
+}
+
+
+bool TaskScheduler::take_task(int index, ScheduledTask& scheduled_task)
+{
+    const int num_queues = static_cast<int>(queues_.size());
+
+    for (int priority = num_priorities - 1; priority >= 0; --priority) {
+        // Own queue first, newest task first
+        {
+            WorkerQueue& queue = *queues_[index];
+            unique_lock<mutex> lock(queue.mutex);
+            deque<ScheduledTask>& tasks = queue.tasks[priority];
+            if (!tasks.empty()) {
+                scheduled_task = move(tasks.back());
+                tasks.pop_back();
+                return true;
+            }
+        }
+
+        // Then steal the oldest task of another queue
+        for (int i = 1; i < num_queues; ++i) {
+            WorkerQueue& queue = *queues_[(index + i) % num_queues];
+            unique_lock<mutex> lock(queue.mutex);
+            deque<ScheduledTask>& tasks = queue.tasks[priority];
+            if (!tasks.empty()) {
+                scheduled_task = move(tasks.front());
+                tasks.pop_front();
+                Metrics::add_to_counter("stolen_tasks", 1);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+
+void TaskScheduler::run_task(ScheduledTask& scheduled_task)
+{
+    if (scheduled_task.token.is_cancelled()) {
+        Metrics::add_to_counter("cancelled_tasks", 1);
+        return;
+    }
+
+    scheduled_task.task();
+
+    if (scheduled_task.on_complete) {
+        // Whatever the task holds is released by the worker
+        scheduled_task.task = Task();
+
+        unique_lock<mutex> lock(completions_mutex_);
+        completions_.push_back(move(scheduled_task));
+    }
+}
@@ -0,0 +1,161 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef TASK_SCHEDULER_H_
+#define TASK_SCHEDULER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+enum class TaskPriority { Low = 0, Normal = 1, High = 2 };
+
+
+/**
+ * Flag shared by the submitter of tasks and the tasks themselves. Cancelled
+ * tasks that didn't start yet are dropped; running tasks may poll
+ * is_cancelled() to stop early. The completion callbacks of cancelled tasks
+ * are never called. Copies share the same flag.
+ */
+class CancellationToken
+{
+  public:
+    CancellationToken();
+
+    void cancel();
+
+    bool is_cancelled() const;
+
+  private:
+    std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+
+
+/**
+ * Process-wide pool of worker threads, shared by the window pipelines that
+ * would otherwise block the GUI thread (buffer conversion, statistics and
+ * export).
+ *
+ * Each worker has its own queue per priority, to which the tasks it submits
+ * are added; tasks submitted by other threads are spread over the queues.
+ * Workers take the newest task of their own queues, and steal the oldest
+ * task of the other queues when theirs are empty; higher priority tasks are
+ * always taken first.
+ *
+ * Workers block all signals, so that the signals meant for GDB (e.g. the
+ * SIGCHLD of the debuggee, see giw_initialize()) are never handled by them.
+ *
+ * All methods may be called from any thread, except for
+ * run_completion_callbacks().
+ */
+class TaskScheduler
+{
+  public:
+    using Task = std::function<void()>;
+
+    /**
+     * The process-wide scheduler, created on first use. It is deliberately
+     * leaked, so that its workers are never joined during static destruction
+     */
+    static TaskScheduler& instance();
+
+    /**
+     * Run task in a worker thread. If on_complete is given, it is called by
+     * the GUI thread (see run_completion_callbacks()) once the task finished,
+     * unless the token was cancelled by then
+     */
+    void submit(Task task,
+                TaskPriority priority          = TaskPriority::Normal,
+                const CancellationToken& token = CancellationToken(),
+                Task on_complete               = Task());
+
+    /**
+     * Call process_block(i) for each i in [0, num_blocks) in parallel, and
+     * return once all calls returned. The calling thread processes blocks as
+     * well, so this may also be called from a task.
+     */
+    void parallel_for(int num_blocks,
+                      const std::function<void(int)>& process_block);
+
+    /**
+     * Call the completion callbacks of the finished tasks. Called
+     * periodically by the GUI thread (see MainWindow::loop())
+     */
+    void run_completion_callbacks();
+
+    int num_workers() const;
+
+  private:
+    static const int num_priorities = 3;
+
+    struct ScheduledTask
+    {
+        Task task;
+        CancellationToken token;
+        Task on_complete;
+    };
+
+    struct WorkerQueue
+    {
+        std::mutex mutex;
+        std::deque<ScheduledTask> tasks[num_priorities];
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<size_t> next_queue_;
+
+    // Number of queued tasks (guarded by idle_mutex_)
+    std::mutex idle_mutex_;
+    std::condition_variable idle_cv_;
+    size_t num_queued_;
+
+    std::mutex completions_mutex_;
+    std::deque<ScheduledTask> completions_;
+
+    TaskScheduler();
+
+    // Never destroyed, see instance()
+    ~TaskScheduler() = delete;
+
+    TaskScheduler(const TaskScheduler&) = delete;
+
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    void run_worker(int index);
+
+    bool take_task(int index, ScheduledTask& scheduled_task);
+
+    void run_task(ScheduledTask& scheduled_task);
+};
+
+#endif // TASK_SCHEDULER_H_
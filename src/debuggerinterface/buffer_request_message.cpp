@@ -25,6 +25,9 @@
 
 #include "buffer_request_message.h"
 
+#include "managed_pointer.h"
+#include "python_native_interface.h"
+
 
 void copy_py_string(std::string& dst, PyObject* src)
 {
@@ -40,22 +43,6 @@ void copy_py_string(std::string& dst, PyObject* src)
 }
 
 
-BufferRequestMessage::BufferRequestMessage(const BufferRequestMessage& buff)
-    : py_buffer(buff.py_buffer)
-    , variable_name_str(buff.variable_name_str)
-    , display_name_str(buff.display_name_str)
-    , width_i(buff.width_i)
-    , height_i(buff.height_i)
-    , channels(buff.channels)
-    , type(buff.type)
-    , step(buff.step)
-    , pixel_layout(buff.pixel_layout)
-    , transpose_buffer(buff.transpose_buffer)
-{
-    Py_INCREF(py_buffer);
-}
-
-
 BufferRequestMessage::BufferRequestMessage(PyObject* pybuffer,
                                            PyObject* variable_name,
                                            PyObject* display_name,
@@ -66,25 +53,71 @@ BufferRequestMessage::BufferRequestMessage(PyObject* pybuffer,
                                            int step,
                                            PyObject* pixel_layout,
                                            bool transpose)
-    : py_buffer(pybuffer)
+    : managed_buffer(make_shared_py_object(pybuffer))
+    , buffer_ptr(static_cast<uint8_t*>(get_c_ptr_from_py_buffer(pybuffer)))
+    , buffer_size(PyMemoryView_GET_BUFFER(pybuffer)->len)
     , width_i(buffer_width_i)
     , height_i(buffer_height_i)
     , channels(channels)
     , type(static_cast<Buffer::BufferType>(type))
     , step(step)
     , transpose_buffer(transpose)
+    , has_dirty_rows(false)
+    , downsample(1)
+    , full_width_i(buffer_width_i)
+    , full_height_i(buffer_height_i)
+    , is_region(false)
+    , region_x(0)
+    , region_y(0)
+    , region_step(1)
+    , slice_x(0)
+    , slice_y(0)
+    , slice_step(1)
+    , queued_at_us(0)
 {
-    Py_INCREF(py_buffer);
-
     copy_py_string(this->variable_name_str, variable_name);
     copy_py_string(this->display_name_str, display_name);
     copy_py_string(this->pixel_layout, pixel_layout);
 }
 
 
-BufferRequestMessage::~BufferRequestMessage()
+BufferRequestMessage::BufferRequestMessage(
+    const std::shared_ptr<uint8_t>& buffer,
+    size_t buffer_size,
+    const std::string& variable_name,
+    const std::string& display_name,
+    int buffer_width_i,
+    int buffer_height_i,
+    int channels,
+    int type,
+    int step,
+    const std::string& pixel_layout,
+    bool transpose)
+    : managed_buffer(buffer)
+    , buffer_ptr(buffer.get())
+    , buffer_size(buffer_size)
+    , variable_name_str(variable_name)
+    , display_name_str(display_name)
+    , width_i(buffer_width_i)
+    , height_i(buffer_height_i)
+    , channels(channels)
+    , type(static_cast<Buffer::BufferType>(type))
+    , step(step)
+    , pixel_layout(pixel_layout)
+    , transpose_buffer(transpose)
+    , has_dirty_rows(false)
+    , downsample(1)
+    , full_width_i(buffer_width_i)
+    , full_height_i(buffer_height_i)
+    , is_region(false)
+    , region_x(0)
+    , region_y(0)
+    , region_step(1)
+    , slice_x(0)
+    , slice_y(0)
+    , slice_step(1)
+    , queued_at_us(0)
 {
-    Py_DECREF(py_buffer);
 }
 
 
@@ -26,7 +26,11 @@
 #ifndef BUFFER_REQUEST_MESSAGE_H_
 #define BUFFER_REQUEST_MESSAGE_H_
 
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <Python.h>
 
@@ -37,7 +41,11 @@ void copy_py_string(std::string& dst, PyObject* src);
 
 struct BufferRequestMessage
 {
-    PyObject* py_buffer;
+    // Keeps the pixel data alive (either a Python buffer object or a native
+    // copy, e.g. read from a capture file)
+    std::shared_ptr<uint8_t> managed_buffer;
+    uint8_t* buffer_ptr;
+    size_t buffer_size;
     std::string variable_name_str;
     std::string display_name_str;
     int width_i;
@@ -47,8 +55,47 @@ struct BufferRequestMessage
     int step;
     std::string pixel_layout;
     bool transpose_buffer;
+    // Row ranges [first, last) modified since the previous request for the
+    // same buffer. Only meaningful if has_dirty_rows is set; otherwise, the
+    // whole buffer must be considered modified
+    bool has_dirty_rows;
+    std::vector<std::pair<int, int>> dirty_rows;
+    // Buffers too large to be fetched at full resolution are sent as an
+    // overview, made of every downsample-th pixel of every downsample-th row
+    // of a buffer of full_width_i x full_height_i pixels. For other buffers,
+    // downsample is 1
+    int downsample;
+    int full_width_i;
+    int full_height_i;
+    // Set if the request only contains a region of a downsampled buffer,
+    // sampled every region_step pixels from pixel (region_x, region_y) of the
+    // full buffer
+    bool is_region;
+    int region_x;
+    int region_y;
+    int region_step;
+    // Buffers plotted from a slice expression (e.g. img[100:612, ::2])
+    // contain every slice_step-th pixel of every slice_step-th row of the
+    // sliced buffer, from its pixel (slice_x, slice_y). For other buffers,
+    // slice_step is 1
+    int slice_x;
+    int slice_y;
+    int slice_step;
+    // Time at which the request entered the window queue (see Tracer)
+    uint64_t queued_at_us;
 
-    BufferRequestMessage(const BufferRequestMessage& buff);
+    // Float32 copy of Float64 buffers, made by a task worker while the
+    // request waits in the window queue. Requests are handled in order, so
+    // the queue is held until the copy is ready (ready is only accessed by
+    // the GUI thread)
+    struct FloatCopy
+    {
+        std::shared_ptr<uint8_t> data;
+        bool ready;
+    };
+    std::shared_ptr<FloatCopy> float_copy;
+
+    BufferRequestMessage(const BufferRequestMessage& buff) = default;
 
     BufferRequestMessage(PyObject* pybuffer,
                          PyObject* variable_name,
@@ -61,7 +108,17 @@ struct BufferRequestMessage
                          PyObject* pixel_layout,
                          bool transpose);
 
-    ~BufferRequestMessage();
+    BufferRequestMessage(const std::shared_ptr<uint8_t>& buffer,
+                         size_t buffer_size,
+                         const std::string& variable_name,
+                         const std::string& display_name,
+                         int buffer_width_i,
+                         int buffer_height_i,
+                         int channels,
+                         int type,
+                         int step,
+                         const std::string& pixel_layout,
+                         bool transpose);
 
     BufferRequestMessage() = delete;
 
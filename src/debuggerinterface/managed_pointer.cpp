@@ -27,6 +27,9 @@
 
 #include "managed_pointer.h"
 
+#include "math/simd_dispatch.h"
+#include "profiling/tracer.h"
+
 
 using namespace std;
 
@@ -35,23 +38,28 @@ shared_ptr<uint8_t> make_shared_py_object(PyObject* obj)
 {
     Py_INCREF(obj);
 
+    // The last reference may be dropped by a thread that doesn't hold the GIL
+    // (e.g. the GUI thread)
     return shared_ptr<uint8_t>(
-        reinterpret_cast<uint8_t*>(obj),
-        [](uint8_t* obj) { Py_DECREF(reinterpret_cast<PyObject*>(obj)); });
+        reinterpret_cast<uint8_t*>(obj), [](uint8_t* obj) {
+            PyGILState_STATE gil_state = PyGILState_Ensure();
+            Py_DECREF(reinterpret_cast<PyObject*>(obj));
+            PyGILState_Release(gil_state);
+        });
 }
 
 
 shared_ptr<uint8_t> make_float_buffer_from_double(double* buff, int length)
 {
+    GIW_TRACE_SCOPE("double_conversion");
+
     shared_ptr<uint8_t> result(
         reinterpret_cast<uint8_t*>(new float[length]),
         [](uint8_t* buff) { delete[] reinterpret_cast<float*>(buff); });
 
     // Cast from double to float
     float* dst = reinterpret_cast<float*>(result.get());
-    for (int i = 0; i < length; ++i) {
-        dst[i] = static_cast<float>(buff[i]);
-    }
+    get_simd_kernels().double_to_float(buff, static_cast<size_t>(length), dst);
 
     return result;
 }
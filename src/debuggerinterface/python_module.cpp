@@ -0,0 +1,465 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Python.h>
+
+#include "giw_window.h"
+
+#include "debuggerinterface/buffer_request_message.h"
+#include "debuggerinterface/python_native_interface.h"
+#include "math/buffer_statistics.h"
+#include "profiling/tracer.h"
+#include "ui/main_window/main_window.h"
+
+using namespace std;
+
+
+/*
+ * CPython extension module "giwnative", exported by libgiwwindow.so next to
+ * the C API used through ctypes. It provides typed entry points for the calls
+ * made at every debugger stop: arguments are parsed with the vectorcall
+ * convention (METH_FASTCALL), buffers are accepted through the buffer protocol
+ * without copies, and the GIL is released while waiting for the window. The
+ * window is referenced by the same handle returned by giw_create_window().
+ *
+ * METH_FASTCALL is only part of the public API since Python 3.7; with older
+ * versions, the module is not built and giwwindow.py falls back to ctypes.
+ */
+#if PY_VERSION_HEX >= 0x03070000
+
+static bool check_num_args(const char* function_name,
+                           Py_ssize_t nargs,
+                           Py_ssize_t expected_nargs)
+{
+    if (nargs != expected_nargs) {
+        PyErr_Format(PyExc_TypeError,
+                     "%s expected %zd arguments, got %zd",
+                     function_name,
+                     expected_nargs,
+                     nargs);
+        return false;
+    }
+
+    return true;
+}
+
+
+static MainWindow* get_window(PyObject* py_handler)
+{
+    MainWindow* window = static_cast<MainWindow*>(PyLong_AsVoidPtr(py_handler));
+
+    if (window == nullptr && !PyErr_Occurred()) {
+        PyErr_SetString(PyExc_RuntimeError, "Received null window handler");
+    }
+
+    return window;
+}
+
+
+static bool get_int_arg(PyObject* py_value, const char* name, int& value)
+{
+    if (!PyLong_Check(py_value)) {
+        PyErr_Format(PyExc_TypeError, "Argument %s must be an integer", name);
+        return false;
+    }
+
+    value = get_py_int(py_value);
+
+    return true;
+}
+
+
+static PyObject*
+py_is_window_ready(PyObject*, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_num_args("is_window_ready", nargs, 1)) {
+        return nullptr;
+    }
+
+    WindowHandler handler = PyLong_AsVoidPtr(args[0]);
+    if (handler == nullptr && PyErr_Occurred()) {
+        return nullptr;
+    }
+
+    return PyBool_FromLong(giw_is_window_ready(handler));
+}
+
+
+/**
+ * plot_buffer(window, pointer, variable_name, display_name, width, height,
+ *             channels, type, row_stride, pixel_layout, transpose_buffer,
+ *             dirty_rows)
+ *
+ * Same fields as the dict given to giw_plot_buffer(), except that pointer may
+ * be any object supporting the buffer protocol, and that dirty_rows may be
+ * None.
+ */
+static PyObject*
+py_plot_buffer(PyObject*, PyObject* const* args, Py_ssize_t nargs)
+{
+    GIW_TRACE_SCOPE("giw_plot_buffer");
+
+    if (!check_num_args("plot_buffer", nargs, 12)) {
+        return nullptr;
+    }
+
+    MainWindow* window = get_window(args[0]);
+    if (window == nullptr) {
+        return nullptr;
+    }
+
+    PyObject* py_variable_name = args[2];
+    PyObject* py_display_name  = args[3];
+    PyObject* py_pixel_layout  = args[9];
+    if (!check_py_string_type(py_variable_name) ||
+        !check_py_string_type(py_display_name) ||
+        !check_py_string_type(py_pixel_layout)) {
+        PyErr_SetString(PyExc_TypeError,
+                        "Arguments variable_name, display_name and "
+                        "pixel_layout must be strings");
+        return nullptr;
+    }
+
+    int width;
+    int height;
+    int channels;
+    int type;
+    int row_stride;
+    if (!get_int_arg(args[4], "width", width) ||
+        !get_int_arg(args[5], "height", height) ||
+        !get_int_arg(args[6], "channels", channels) ||
+        !get_int_arg(args[7], "type", type) ||
+        !get_int_arg(args[8], "row_stride", row_stride)) {
+        return nullptr;
+    }
+
+    const int transpose_buffer = PyObject_IsTrue(args[10]);
+    if (transpose_buffer < 0) {
+        return nullptr;
+    }
+
+    vector<pair<int, int>> dirty_rows;
+    const bool has_dirty_rows = args[11] != Py_None;
+    if (has_dirty_rows && !get_dirty_rows(args[11], dirty_rows)) {
+        PyErr_SetString(PyExc_TypeError,
+                        "Argument dirty_rows must be a list of (first, last) "
+                        "row pairs");
+        return nullptr;
+    }
+
+    // Any buffer exporter (memoryview, bytearray, numpy array...) is wrapped
+    // in a memoryview, which references the original memory
+    PyObject* py_pointer = PyMemoryView_FromObject(args[1]);
+    if (py_pointer == nullptr) {
+        return nullptr;
+    }
+
+    BufferDescriptor descriptor;
+    descriptor.width    = width;
+    descriptor.height   = height;
+    descriptor.channels = channels;
+    descriptor.type     = static_cast<Buffer::BufferType>(type);
+    descriptor.step     = row_stride;
+    if (!check_py_buffer_size(
+            py_pointer, descriptor.required_size(), "plot_buffer")) {
+        Py_DECREF(py_pointer);
+        return nullptr;
+    }
+
+    BufferRequestMessage request(py_pointer,
+                                 py_variable_name,
+                                 py_display_name,
+                                 width,
+                                 height,
+                                 channels,
+                                 type,
+                                 row_stride,
+                                 py_pixel_layout,
+                                 transpose_buffer != 0);
+    request.has_dirty_rows = has_dirty_rows;
+    request.dirty_rows     = move(dirty_rows);
+
+    // The request holds its own reference to the memoryview
+    Py_DECREF(py_pointer);
+
+    // The GUI thread may call back into Python while holding the window
+    // lock, so the GIL must not be held while waiting for it
+    Py_BEGIN_ALLOW_THREADS;
+    window->plot_buffer(request);
+    Py_END_ALLOW_THREADS;
+
+    Py_RETURN_NONE;
+}
+
+
+// Copy the str or bytes items of the sequence py_symbols into symbols.
+// Returns false, with a Python exception set, on failure
+static bool get_symbol_names(PyObject* py_symbols, deque<string>& symbols)
+{
+    PyObject* py_sequence = PySequence_Fast(
+        py_symbols, "Symbol lists must be sequences");
+    if (py_sequence == nullptr) {
+        return false;
+    }
+
+    const Py_ssize_t num_symbols = PySequence_Fast_GET_SIZE(py_sequence);
+    PyObject** py_items          = PySequence_Fast_ITEMS(py_sequence);
+
+    for (Py_ssize_t i = 0; i < num_symbols; ++i) {
+        if (!check_py_string_type(py_items[i])) {
+            Py_DECREF(py_sequence);
+            PyErr_SetString(PyExc_TypeError, "Symbol names must be strings");
+            return false;
+        }
+
+        symbols.emplace_back();
+        copy_py_string(symbols.back(), py_items[i]);
+    }
+    Py_DECREF(py_sequence);
+
+    return true;
+}
+
+
+static PyObject*
+py_set_available_symbols(PyObject*, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_num_args("set_available_symbols", nargs, 2)) {
+        return nullptr;
+    }
+
+    MainWindow* window = get_window(args[0]);
+    if (window == nullptr) {
+        return nullptr;
+    }
+
+    deque<string> available_symbols;
+    if (!get_symbol_names(args[1], available_symbols)) {
+        return nullptr;
+    }
+
+    Py_BEGIN_ALLOW_THREADS;
+    window->set_available_symbols(available_symbols);
+    Py_END_ALLOW_THREADS;
+
+    Py_RETURN_NONE;
+}
+
+
+static PyObject* py_update_available_symbols(PyObject*,
+                                             PyObject* const* args,
+                                             Py_ssize_t nargs)
+{
+    if (!check_num_args("update_available_symbols", nargs, 3)) {
+        return nullptr;
+    }
+
+    MainWindow* window = get_window(args[0]);
+    if (window == nullptr) {
+        return nullptr;
+    }
+
+    deque<string> added_symbols;
+    deque<string> removed_symbols;
+    if (!get_symbol_names(args[1], added_symbols) ||
+        !get_symbol_names(args[2], removed_symbols)) {
+        return nullptr;
+    }
+
+    Py_BEGIN_ALLOW_THREADS;
+    window->update_available_symbols(added_symbols, removed_symbols);
+    Py_END_ALLOW_THREADS;
+
+    Py_RETURN_NONE;
+}
+
+
+static PyObject* build_py_symbol_list(const deque<string>& symbols)
+{
+    PyObject* py_symbols = PyList_New(symbols.size());
+    for (size_t i = 0; py_symbols != nullptr && i < symbols.size(); ++i) {
+        PyObject* py_symbol_name =
+            PyBytes_FromStringAndSize(symbols[i].data(), symbols[i].size());
+        if (py_symbol_name == nullptr) {
+            Py_CLEAR(py_symbols);
+            break;
+        }
+
+        PyList_SET_ITEM(py_symbols, i, py_symbol_name);
+    }
+
+    return py_symbols;
+}
+
+
+static PyObject*
+py_get_observed_buffers(PyObject*, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_num_args("get_observed_buffers", nargs, 1)) {
+        return nullptr;
+    }
+
+    MainWindow* window = get_window(args[0]);
+    if (window == nullptr) {
+        return nullptr;
+    }
+
+    deque<string> observed_symbols;
+    Py_BEGIN_ALLOW_THREADS;
+    observed_symbols = window->get_observed_symbols();
+    Py_END_ALLOW_THREADS;
+
+    return build_py_symbol_list(observed_symbols);
+}
+
+
+static PyObject*
+py_get_buffers_to_refresh(PyObject*, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (!check_num_args("get_buffers_to_refresh", nargs, 1)) {
+        return nullptr;
+    }
+
+    MainWindow* window = get_window(args[0]);
+    if (window == nullptr) {
+        return nullptr;
+    }
+
+    deque<string> refreshed_symbols;
+    Py_BEGIN_ALLOW_THREADS;
+    refreshed_symbols = window->get_buffers_to_refresh();
+    Py_END_ALLOW_THREADS;
+
+    return build_py_symbol_list(refreshed_symbols);
+}
+
+
+static PyObject*
+py_compute_stats(PyObject*, PyObject* const* args, Py_ssize_t nargs)
+{
+    int histogram_bins;
+    if (!check_num_args("compute_stats", nargs, 2) ||
+        !get_int_arg(args[1], "histogram_bins", histogram_bins)) {
+        return nullptr;
+    }
+
+    // giw_compute_stats() acquires the GIL only while it touches Python
+    // objects
+    PyObject* py_stats;
+    Py_BEGIN_ALLOW_THREADS;
+    py_stats = giw_compute_stats(args[0], histogram_bins);
+    Py_END_ALLOW_THREADS;
+
+    return py_stats;
+}
+
+
+static PyObject* py_evaluate_buffer_condition(PyObject*,
+                                              PyObject* const* args,
+                                              Py_ssize_t nargs)
+{
+    if (!check_num_args("evaluate_buffer_condition", nargs, 2)) {
+        return nullptr;
+    }
+
+    const char* condition = PyUnicode_AsUTF8(args[1]);
+    if (condition == nullptr) {
+        return nullptr;
+    }
+
+    int result;
+    Py_BEGIN_ALLOW_THREADS;
+    result = giw_evaluate_buffer_condition(args[0], condition);
+    Py_END_ALLOW_THREADS;
+
+    if (result < 0) {
+        return nullptr;
+    }
+
+    return PyBool_FromLong(result);
+}
+
+
+#define GIW_FASTCALL_METHOD(name, doc)                                     \
+    {                                                                      \
+        #name,                                                             \
+            reinterpret_cast<PyCFunction>(                                 \
+                reinterpret_cast<void (*)(void)>(py_##name)),              \
+            METH_FASTCALL, doc                                             \
+    }
+
+static PyMethodDef giwnative_methods[] = {
+    GIW_FASTCALL_METHOD(is_window_ready,
+                        "is_window_ready(window) -> bool"),
+    GIW_FASTCALL_METHOD(plot_buffer,
+                        "plot_buffer(window, pointer, variable_name, "
+                        "display_name, width, height, channels, type, "
+                        "row_stride, pixel_layout, transpose_buffer, "
+                        "dirty_rows) -> None"),
+    GIW_FASTCALL_METHOD(set_available_symbols,
+                        "set_available_symbols(window, symbols) -> None"),
+    GIW_FASTCALL_METHOD(update_available_symbols,
+                        "update_available_symbols(window, added, removed) "
+                        "-> None"),
+    GIW_FASTCALL_METHOD(get_observed_buffers,
+                        "get_observed_buffers(window) -> list of bytes"),
+    GIW_FASTCALL_METHOD(get_buffers_to_refresh,
+                        "get_buffers_to_refresh(window) -> list of bytes"),
+    GIW_FASTCALL_METHOD(compute_stats,
+                        "compute_stats(buffer_metadata, histogram_bins) -> "
+                        "dict"),
+    GIW_FASTCALL_METHOD(evaluate_buffer_condition,
+                        "evaluate_buffer_condition(buffer_metadata, "
+                        "condition) -> bool"),
+    {nullptr, nullptr, 0, nullptr}};
+
+#undef GIW_FASTCALL_METHOD
+
+
+static PyModuleDef giwnative_module = {PyModuleDef_HEAD_INIT,
+                                       "giwnative",
+                                       "Typed entry points of libgiwwindow",
+                                       -1,
+                                       giwnative_methods,
+                                       nullptr,
+                                       nullptr,
+                                       nullptr,
+                                       nullptr};
+
+
+extern "C" GIW_API PyObject* PyInit_giwnative();
+
+
+PyObject* PyInit_giwnative()
+{
+    return PyModule_Create(&giwnative_module);
+}
+
+#endif
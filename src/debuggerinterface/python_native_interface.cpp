@@ -43,3 +43,68 @@ void* get_c_ptr_from_py_buffer(PyObject* obj)
     assert(PyMemoryView_Check(obj));
     return PyMemoryView_GET_BUFFER(obj)->buf;
 }
+
+
+bool get_dirty_rows(PyObject* py_dirty_rows,
+                    std::vector<std::pair<int, int>>& dirty_rows)
+{
+    if (!PyList_Check(py_dirty_rows)) {
+        return false;
+    }
+
+    const Py_ssize_t num_ranges = PyList_Size(py_dirty_rows);
+    dirty_rows.reserve(num_ranges);
+
+    for (Py_ssize_t i = 0; i < num_ranges; ++i) {
+        PyObject* py_range = PyList_GetItem(py_dirty_rows, i);
+        if (!PySequence_Check(py_range) || PySequence_Size(py_range) != 2) {
+            return false;
+        }
+
+        PyObject* py_first = PySequence_GetItem(py_range, 0);
+        PyObject* py_last  = PySequence_GetItem(py_range, 1);
+        const bool valid_range =
+            PyLong_Check(py_first) && PyLong_Check(py_last);
+        if (valid_range) {
+            dirty_rows.emplace_back(get_py_int(py_first),
+                                    get_py_int(py_last));
+        }
+        Py_DECREF(py_first);
+        Py_DECREF(py_last);
+
+        if (!valid_range) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+bool check_py_buffer_size(PyObject* py_buffer,
+                          size_t required_size,
+                          const char* context)
+{
+    const Py_buffer* view = PyMemoryView_GET_BUFFER(py_buffer);
+
+    // Buffers are read as a single block of rows, which strided or
+    // Fortran-ordered views do not provide
+    if (!PyBuffer_IsContiguous(view, 'C')) {
+        PyErr_Format(PyExc_ValueError,
+                     "Buffer given to %s must be C-contiguous",
+                     context);
+        return false;
+    }
+
+    if (static_cast<size_t>(view->len) < required_size) {
+        PyErr_Format(PyExc_ValueError,
+                     "Buffer given to %s is smaller than its dimensions "
+                     "(%zu bytes, expected %zu)",
+                     context,
+                     static_cast<size_t>(view->len),
+                     required_size);
+        return false;
+    }
+
+    return true;
+}
@@ -26,6 +26,10 @@
 #ifndef PYTHON_NATIVE_INTERFACE_H_
 #define PYTHON_NATIVE_INTERFACE_H_
 
+#include <cstddef>
+#include <utility>
+#include <vector>
+
 #include <Python.h>
 
 
@@ -37,4 +41,22 @@ int check_py_string_type(PyObject* obj);
 
 void* get_c_ptr_from_py_buffer(PyObject* obj);
 
+
+/**
+ * Convert a list of [first, last) row pairs (the "dirty_rows" field of a plot
+ * request). Returns false if the list is malformed.
+ */
+bool get_dirty_rows(PyObject* py_dirty_rows,
+                    std::vector<std::pair<int, int>>& dirty_rows);
+
+
+/**
+ * Check that the memoryview py_buffer is C-contiguous and spans at least
+ * required_size bytes. Otherwise, sets a ValueError mentioning the calling
+ * function and returns false.
+ */
+bool check_py_buffer_size(PyObject* py_buffer,
+                          size_t required_size,
+                          const char* context);
+
 #endif // PYTHON_NATIVE_INTERFACE_H_
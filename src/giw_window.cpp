@@ -23,16 +23,27 @@
  * IN THE SOFTWARE.
  */
 
+#include <chrono>
 #include <csignal>
+#include <deque>
 
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <QApplication>
 
 #include "giw_window.h"
 
+#include "concurrency/task_scheduler.h"
 #include "debuggerinterface/preprocessor_directives.h"
 #include "debuggerinterface/python_native_interface.h"
+#include "io/plot_capture.h"
+#include "math/buffer_statistics.h"
+#include "math/simd_dispatch.h"
+#include "profiling/metrics.h"
+#include "profiling/tracer.h"
 #include "ui/main_window/main_window.h"
 
 using namespace std;
@@ -43,6 +54,9 @@ static char giw_app_argv1[] = "-style=fusion";
 static char* giw_app_argv[] = {giw_app_argv0, giw_app_argv1};
 static int giw_app_argc     = 1;
 
+// Maximum number of requests queued in the window during a max speed replay
+static const size_t max_queued_replay_requests = 4;
+
 
 void dummy_sgn_handler(int signum)
 {
@@ -61,6 +75,14 @@ AppHandler giw_initialize()
     // Restore GDB SIGCHLD handler
     std::signal(SIGCHLD, gdb_sigchld_handler);
 
+    // Select the pixel kernels now, so that simd_level is reported from the
+    // start
+    get_simd_level();
+
+    // The task workers are started once GDB's SIGCHLD handler is back, and
+    // block all signals, which are thus left to GDB's threads
+    TaskScheduler::instance();
+
     return static_cast<AppHandler>(app);
 }
 
@@ -96,12 +118,16 @@ void giw_exec(AppHandler handler)
         return;
     }
 
+    Tracer::set_thread_name("GUI thread");
+
     app->exec();
 }
 
 
 WindowHandler giw_create_window(int (*plot_callback)(const char*))
 {
+    GIW_TRACE_SCOPE("window_creation");
+
     MainWindow* window = new MainWindow();
     window->show();
     window->set_plot_callback(plot_callback);
@@ -110,6 +136,27 @@ WindowHandler giw_create_window(int (*plot_callback)(const char*))
 }
 
 
+void giw_set_region_callback(WindowHandler handler,
+                             int (*region_callback)(const char*,
+                                                    int,
+                                                    int,
+                                                    int,
+                                                    int,
+                                                    int))
+{
+    MainWindow* window = static_cast<MainWindow*>(handler);
+
+    if (window == nullptr) {
+        RAISE_PY_EXCEPTION(PyExc_RuntimeError,
+                           "giw_set_region_callback received null window "
+                           "handler");
+        return;
+    }
+
+    window->set_region_callback(region_callback);
+}
+
+
 int giw_is_window_ready(WindowHandler handler)
 {
     MainWindow* window = static_cast<MainWindow*>(handler);
@@ -133,6 +180,26 @@ void giw_destroy_window(WindowHandler handler)
 }
 
 
+static PyObject* build_py_symbol_list(const deque<string>& symbols)
+{
+    PyObject* py_symbols = PyList_New(symbols.size());
+
+    int symbols_sentinel = static_cast<int>(symbols.size());
+    for (int i = 0; py_symbols != nullptr && i < symbols_sentinel; ++i) {
+        PyObject* py_symbol_name = PyBytes_FromString(symbols[i].c_str());
+
+        if (py_symbol_name == nullptr) {
+            Py_DECREF(py_symbols);
+            return nullptr;
+        }
+
+        PyList_SetItem(py_symbols, i, py_symbol_name);
+    }
+
+    return py_symbols;
+}
+
+
 PyObject* giw_get_observed_buffers(WindowHandler handler)
 {
     MainWindow* window = static_cast<MainWindow*>(handler);
@@ -144,23 +211,32 @@ PyObject* giw_get_observed_buffers(WindowHandler handler)
         return nullptr;
     }
 
-    auto observed_symbols         = window->get_observed_symbols();
-    PyObject* py_observed_symbols = PyList_New(observed_symbols.size());
+    return build_py_symbol_list(window->get_observed_symbols());
+}
 
-    int observed_symbols_sentinel = static_cast<int>(observed_symbols.size());
-    for (int i = 0; i < observed_symbols_sentinel; ++i) {
-        string symbol_name       = observed_symbols[i];
-        PyObject* py_symbol_name = PyBytes_FromString(symbol_name.c_str());
 
-        if (py_symbol_name == nullptr) {
-            Py_DECREF(py_observed_symbols);
-            return nullptr;
-        }
+PyObject* giw_get_buffers_to_refresh(WindowHandler handler)
+{
+    MainWindow* window = static_cast<MainWindow*>(handler);
 
-        PyList_SetItem(py_observed_symbols, i, py_symbol_name);
+    if (window == nullptr) {
+        RAISE_PY_EXCEPTION(PyExc_Exception,
+                           "giw_get_buffers_to_refresh received null window "
+                           "handler");
+        return nullptr;
     }
 
-    return py_observed_symbols;
+    return build_py_symbol_list(window->get_buffers_to_refresh());
+}
+
+
+// Copy the names in the Python list py_names into names
+static void get_py_string_list(PyObject* py_names, deque<string>& names)
+{
+    for (Py_ssize_t pos = 0; pos < PyList_Size(py_names); ++pos) {
+        names.emplace_back();
+        copy_py_string(names.back(), PyList_GetItem(py_names, pos));
+    }
 }
 
 
@@ -179,19 +255,51 @@ void giw_set_available_symbols(WindowHandler handler,
     }
 
     deque<string> available_vars_stl;
-    for (Py_ssize_t pos = 0; pos < PyList_Size(available_vars_py); ++pos) {
-        string var_name_str;
-        PyObject* listItem = PyList_GetItem(available_vars_py, pos);
-        copy_py_string(var_name_str, listItem);
-        available_vars_stl.push_back(var_name_str);
-    }
+    get_py_string_list(available_vars_py, available_vars_stl);
 
     window->set_available_symbols(available_vars_stl);
 }
 
 
+void giw_update_available_symbols(WindowHandler handler,
+                                  PyObject* added_vars_py,
+                                  PyObject* removed_vars_py)
+{
+    assert(PyList_Check(added_vars_py));
+    assert(PyList_Check(removed_vars_py));
+
+    MainWindow* window = static_cast<MainWindow*>(handler);
+
+    if (window == nullptr) {
+        RAISE_PY_EXCEPTION(PyExc_RuntimeError,
+                           "giw_update_available_symbols received null "
+                           "window handler");
+        return;
+    }
+
+    deque<string> added_vars_stl;
+    deque<string> removed_vars_stl;
+    get_py_string_list(added_vars_py, added_vars_stl);
+    get_py_string_list(removed_vars_py, removed_vars_stl);
+
+    window->update_available_symbols(added_vars_stl, removed_vars_stl);
+}
+
+
+// Check that obj is a tuple of three ints, such as (x, y, step)
+static bool is_py_int_triple(PyObject* obj)
+{
+    return PyTuple_Check(obj) && PyTuple_Size(obj) == 3 &&
+           PyLong_Check(PyTuple_GetItem(obj, 0)) &&
+           PyLong_Check(PyTuple_GetItem(obj, 1)) &&
+           PyLong_Check(PyTuple_GetItem(obj, 2));
+}
+
+
 void giw_plot_buffer(WindowHandler handler, PyObject* buffer_metadata)
 {
+    GIW_TRACE_SCOPE("giw_plot_buffer");
+
     MainWindow* window = static_cast<MainWindow*>(handler);
 
     if (window == nullptr) {
@@ -235,6 +343,61 @@ void giw_plot_buffer(WindowHandler handler, PyObject* buffer_metadata)
         transpose_buffer = PyObject_IsTrue(py_transpose_buffer);
     }
 
+    PyObject* py_dirty_rows =
+        PyDict_GetItemString(buffer_metadata, "dirty_rows");
+    bool has_dirty_rows = false;
+    vector<pair<int, int>> dirty_rows;
+    if (py_dirty_rows != nullptr && py_dirty_rows != Py_None) {
+        if (!get_dirty_rows(py_dirty_rows, dirty_rows)) {
+            RAISE_PY_EXCEPTION(PyExc_TypeError,
+                               "Key dirty_rows provided to plot_buffer must "
+                               "be a list of (first, last) row pairs");
+            return;
+        }
+        has_dirty_rows = true;
+    }
+
+    PyObject* py_downsample =
+        PyDict_GetItemString(buffer_metadata, "downsample");
+    int downsample    = 1;
+    int full_width_i  = 0;
+    int full_height_i = 0;
+    if (py_downsample != nullptr) {
+        PyObject* py_full_width =
+            PyDict_GetItemString(buffer_metadata, "full_width");
+        PyObject* py_full_height =
+            PyDict_GetItemString(buffer_metadata, "full_height");
+        if (!PyLong_Check(py_downsample) || py_full_width == nullptr ||
+            !PyLong_Check(py_full_width) || py_full_height == nullptr ||
+            !PyLong_Check(py_full_height)) {
+            RAISE_PY_EXCEPTION(PyExc_TypeError,
+                               "Keys downsample, full_width and full_height "
+                               "provided to plot_buffer must be integers");
+            return;
+        }
+        downsample    = get_py_int(py_downsample);
+        full_width_i  = get_py_int(py_full_width);
+        full_height_i = get_py_int(py_full_height);
+    }
+
+    PyObject* py_region = PyDict_GetItemString(buffer_metadata, "region");
+    if (py_region != nullptr && !is_py_int_triple(py_region)) {
+        RAISE_PY_EXCEPTION(PyExc_TypeError,
+                           "Key region provided to plot_buffer must be a "
+                           "(x, y, step) tuple");
+        return;
+    }
+
+    PyObject* py_slice = PyDict_GetItemString(buffer_metadata, "slice");
+    if (py_slice != nullptr &&
+        (!is_py_int_triple(py_slice) ||
+         get_py_int(PyTuple_GetItem(py_slice, 2)) < 1)) {
+        RAISE_PY_EXCEPTION(PyExc_TypeError,
+                           "Key slice provided to plot_buffer must be a "
+                           "(x, y, step) tuple");
+        return;
+    }
+
     /*
      * Check if expected fields were provided
      */
@@ -261,6 +424,25 @@ void giw_plot_buffer(WindowHandler handler, PyObject* buffer_metadata)
     CHECK_FIELD_TYPE(row_stride, PyLong_Check, "plot_buffer");
     CHECK_FIELD_TYPE(pixel_layout, check_py_string_type, "plot_buffer");
 
+    /*
+     * Check that the buffer spans all the pixels it is said to have
+     */
+    BufferDescriptor descriptor;
+    descriptor.width    = get_py_int(py_width);
+    descriptor.height   = get_py_int(py_height);
+    descriptor.channels = get_py_int(py_channels);
+    descriptor.type     = static_cast<Buffer::BufferType>(get_py_int(py_type));
+    descriptor.step     = get_py_int(py_row_stride);
+
+    PyGILState_STATE gil_state = PyGILState_Ensure();
+    const bool valid_buffer    = check_py_buffer_size(
+        py_pointer, descriptor.required_size(), "plot_buffer");
+    PyGILState_Release(gil_state);
+
+    if (!valid_buffer) {
+        return;
+    }
+
     /*
      * Enqueue provided fields so the request can be processed in the main
      * thread
@@ -275,6 +457,639 @@ void giw_plot_buffer(WindowHandler handler, PyObject* buffer_metadata)
                                  get_py_int(py_row_stride),
                                  py_pixel_layout,
                                  transpose_buffer);
+    request.has_dirty_rows = has_dirty_rows;
+    request.dirty_rows     = move(dirty_rows);
+
+    if (py_downsample != nullptr) {
+        request.downsample    = downsample;
+        request.full_width_i  = full_width_i;
+        request.full_height_i = full_height_i;
+    }
+
+    if (py_region != nullptr) {
+        request.is_region   = true;
+        request.region_x    = get_py_int(PyTuple_GetItem(py_region, 0));
+        request.region_y    = get_py_int(PyTuple_GetItem(py_region, 1));
+        request.region_step = get_py_int(PyTuple_GetItem(py_region, 2));
+    }
+
+    if (py_slice != nullptr) {
+        request.slice_x    = get_py_int(PyTuple_GetItem(py_slice, 0));
+        request.slice_y    = get_py_int(PyTuple_GetItem(py_slice, 1));
+        request.slice_step = get_py_int(PyTuple_GetItem(py_slice, 2));
+    }
 
     window->plot_buffer(request);
 }
+
+
+int giw_capture_start(const char* path)
+{
+    return PlotCapture::start(path) ? 1 : 0;
+}
+
+
+void giw_capture_stop()
+{
+    PlotCapture::stop();
+}
+
+
+int giw_replay_capture(WindowHandler handler, const char* path, int max_speed)
+{
+    MainWindow* window = static_cast<MainWindow*>(handler);
+
+    if (window == nullptr) {
+        RAISE_PY_EXCEPTION(PyExc_RuntimeError,
+                           "giw_replay_capture received null window handler");
+        return -1;
+    }
+
+    PlotCaptureReader reader;
+    if (!reader.open(path)) {
+        return -1;
+    }
+
+    const chrono::milliseconds poll_interval(1);
+    const uint64_t replay_started_at_us = Tracer::now_us();
+
+    int num_requests = 0;
+    uint64_t timestamp_us;
+
+    for (unique_ptr<BufferRequestMessage> request =
+             reader.read_next(timestamp_us);
+         request != nullptr;
+         request = reader.read_next(timestamp_us)) {
+        if (max_speed) {
+            // Keep the queue short, so that large captures don't pile up in
+            // memory
+            while (window->get_pending_update_count() >=
+                   max_queued_replay_requests) {
+                this_thread::sleep_for(poll_interval);
+            }
+        } else {
+            const uint64_t elapsed_us = Tracer::now_us() - replay_started_at_us;
+            if (timestamp_us > elapsed_us) {
+                this_thread::sleep_for(
+                    chrono::microseconds(timestamp_us - elapsed_us));
+            }
+        }
+
+        window->plot_buffer(*request);
+        ++num_requests;
+    }
+
+    // Wait until all requests were processed
+    while (window->get_pending_update_count() > 0 &&
+           window->is_window_ready()) {
+        this_thread::sleep_for(poll_interval);
+    }
+
+    return num_requests;
+}
+
+
+void giw_start_interaction_benchmark(WindowHandler handler,
+                                     const char* report_path)
+{
+    MainWindow* window = static_cast<MainWindow*>(handler);
+
+    if (window == nullptr) {
+        RAISE_PY_EXCEPTION(PyExc_RuntimeError,
+                           "giw_start_interaction_benchmark received null "
+                           "window handler");
+        return;
+    }
+
+    window->start_interaction_benchmark(report_path);
+}
+
+
+int giw_is_interaction_benchmark_running(WindowHandler handler)
+{
+    MainWindow* window = static_cast<MainWindow*>(handler);
+
+    return window != nullptr && window->is_interaction_benchmark_running();
+}
+
+
+static bool set_py_dict_item(PyObject* dict, const char* key, PyObject* value)
+{
+    if (value == nullptr) {
+        return false;
+    }
+
+    const int result = PyDict_SetItemString(dict, key, value);
+    Py_DECREF(value);
+
+    return result == 0;
+}
+
+
+static PyObject* build_py_histogram(const Metrics::Histogram& histogram)
+{
+    PyObject* py_histogram = PyDict_New();
+    if (py_histogram == nullptr) {
+        return nullptr;
+    }
+
+    const double mean =
+        histogram.count > 0
+            ? static_cast<double>(histogram.sum) / histogram.count
+            : 0.0;
+
+    PyObject* py_buckets = PyList_New(0);
+    for (int i = 0; py_buckets != nullptr &&
+                    i < Metrics::Histogram::num_buckets;
+         ++i) {
+        if (histogram.buckets[i] == 0) {
+            continue;
+        }
+
+        const unsigned long long upper_bound =
+            (i == 0) ? 0 : (1ull << i) - 1;
+        PyObject* py_bucket =
+            Py_BuildValue("(KK)",
+                          upper_bound,
+                          static_cast<unsigned long long>(
+                              histogram.buckets[i]));
+
+        if (py_bucket == nullptr || PyList_Append(py_buckets, py_bucket)) {
+            Py_XDECREF(py_bucket);
+            Py_DECREF(py_buckets);
+            py_buckets = nullptr;
+        } else {
+            Py_DECREF(py_bucket);
+        }
+    }
+
+    const bool ok =
+        set_py_dict_item(py_histogram,
+                         "count",
+                         PyLong_FromUnsignedLongLong(histogram.count)) &&
+        set_py_dict_item(py_histogram,
+                         "sum",
+                         PyLong_FromUnsignedLongLong(histogram.sum)) &&
+        set_py_dict_item(py_histogram,
+                         "min",
+                         PyLong_FromUnsignedLongLong(histogram.min)) &&
+        set_py_dict_item(py_histogram,
+                         "max",
+                         PyLong_FromUnsignedLongLong(histogram.max)) &&
+        set_py_dict_item(py_histogram, "mean", PyFloat_FromDouble(mean)) &&
+        set_py_dict_item(
+            py_histogram,
+            "p50",
+            PyLong_FromUnsignedLongLong(histogram.quantile(0.50))) &&
+        set_py_dict_item(
+            py_histogram,
+            "p90",
+            PyLong_FromUnsignedLongLong(histogram.quantile(0.90))) &&
+        set_py_dict_item(
+            py_histogram,
+            "p99",
+            PyLong_FromUnsignedLongLong(histogram.quantile(0.99))) &&
+        set_py_dict_item(py_histogram, "buckets", py_buckets);
+
+    if (!ok) {
+        Py_DECREF(py_histogram);
+        return nullptr;
+    }
+
+    return py_histogram;
+}
+
+
+static PyObject*
+build_py_histogram_dict(const map<string, Metrics::Histogram>& histograms)
+{
+    PyObject* py_histograms = PyDict_New();
+
+    for (const auto& histogram : histograms) {
+        if (py_histograms == nullptr) {
+            break;
+        }
+
+        if (!set_py_dict_item(py_histograms,
+                              histogram.first.c_str(),
+                              build_py_histogram(histogram.second))) {
+            Py_DECREF(py_histograms);
+            py_histograms = nullptr;
+        }
+    }
+
+    return py_histograms;
+}
+
+
+static PyObject* build_py_metrics(const Metrics::Snapshot& snapshot)
+{
+    PyObject* py_counters = PyDict_New();
+    for (const auto& counter : snapshot.counters) {
+        if (py_counters != nullptr &&
+            !set_py_dict_item(py_counters,
+                              counter.first.c_str(),
+                              PyLong_FromUnsignedLongLong(counter.second))) {
+            Py_DECREF(py_counters);
+            py_counters = nullptr;
+        }
+    }
+
+    PyObject* py_gauges = PyDict_New();
+    for (const auto& gauge : snapshot.gauges) {
+        if (py_gauges != nullptr &&
+            !set_py_dict_item(py_gauges,
+                              gauge.first.c_str(),
+                              PyLong_FromLongLong(gauge.second))) {
+            Py_DECREF(py_gauges);
+            py_gauges = nullptr;
+        }
+    }
+
+    PyObject* py_caches = PyDict_New();
+    for (const auto& cache : snapshot.caches) {
+        const uint64_t accesses = cache.second.hits + cache.second.misses;
+        const double hit_rate =
+            accesses > 0 ? static_cast<double>(cache.second.hits) / accesses
+                         : 0.0;
+
+        if (py_caches != nullptr &&
+            !set_py_dict_item(py_caches,
+                              cache.first.c_str(),
+                              Py_BuildValue("{sKsKsd}",
+                                            "hits",
+                                            static_cast<unsigned long long>(
+                                                cache.second.hits),
+                                            "misses",
+                                            static_cast<unsigned long long>(
+                                                cache.second.misses),
+                                            "hit_rate",
+                                            hit_rate))) {
+            Py_DECREF(py_caches);
+            py_caches = nullptr;
+        }
+    }
+
+    PyObject* py_buffers = PyDict_New();
+    for (const auto& buffer : snapshot.buffers) {
+        if (py_buffers != nullptr &&
+            !set_py_dict_item(py_buffers,
+                              buffer.first.c_str(),
+                              Py_BuildValue("{sKsK}",
+                                            "host_bytes",
+                                            static_cast<unsigned long long>(
+                                                buffer.second.host_bytes),
+                                            "gpu_bytes",
+                                            static_cast<unsigned long long>(
+                                                buffer.second.gpu_bytes)))) {
+            Py_DECREF(py_buffers);
+            py_buffers = nullptr;
+        }
+    }
+
+    PyObject* py_metrics = PyDict_New();
+    if (py_metrics == nullptr) {
+        Py_XDECREF(py_counters);
+        Py_XDECREF(py_gauges);
+        Py_XDECREF(py_caches);
+        Py_XDECREF(py_buffers);
+        return nullptr;
+    }
+
+    // set_py_dict_item releases the value even if it fails, so every entry
+    // must be visited
+    bool ok = set_py_dict_item(py_metrics, "counters", py_counters);
+    ok &= set_py_dict_item(py_metrics, "gauges", py_gauges);
+    ok &= set_py_dict_item(py_metrics,
+                           "latencies_us",
+                           build_py_histogram_dict(snapshot.latencies_us));
+    ok &= set_py_dict_item(py_metrics,
+                           "histograms",
+                           build_py_histogram_dict(snapshot.histograms));
+    ok &= set_py_dict_item(py_metrics, "caches", py_caches);
+    ok &= set_py_dict_item(py_metrics, "buffers", py_buffers);
+
+    if (!ok) {
+        Py_DECREF(py_metrics);
+        return nullptr;
+    }
+
+    return py_metrics;
+}
+
+
+PyObject* giw_get_metrics(WindowHandler handler)
+{
+    MainWindow* window = static_cast<MainWindow*>(handler);
+
+    if (window == nullptr) {
+        RAISE_PY_EXCEPTION(PyExc_Exception,
+                           "giw_get_metrics received null window handler");
+        return nullptr;
+    }
+
+    // The snapshot is taken before acquiring the GIL, so that the GUI thread
+    // is never blocked by the interpreter
+    const Metrics::Snapshot snapshot = Metrics::snapshot();
+
+    PyGILState_STATE gil_state = PyGILState_Ensure();
+    PyObject* py_metrics       = build_py_metrics(snapshot);
+    PyGILState_Release(gil_state);
+
+    return py_metrics;
+}
+
+
+/**
+ * Read the location and layout of a buffer from its metadata dict. Must be
+ * called with the GIL held. Sets a Python exception and returns false if any
+ * field is missing or invalid.
+ */
+static bool get_buffer_descriptor(PyObject* buffer_metadata,
+                                  const char* context,
+                                  BufferDescriptor& descriptor)
+{
+    if (!PyDict_Check(buffer_metadata)) {
+        PyErr_Format(PyExc_TypeError,
+                     "Invalid object given to %s (was expecting a dict)",
+                     context);
+        return false;
+    }
+
+    PyObject* py_pointer = PyDict_GetItemString(buffer_metadata, "pointer");
+    if (py_pointer == nullptr || !PyMemoryView_Check(py_pointer)) {
+        PyErr_Format(PyExc_TypeError,
+                     "Key pointer provided to %s must be a memoryview",
+                     context);
+        return false;
+    }
+
+    const char* int_fields[] = {
+        "width", "height", "channels", "type", "row_stride"};
+    int int_values[sizeof(int_fields) / sizeof(int_fields[0])];
+
+    for (size_t i = 0; i < sizeof(int_fields) / sizeof(int_fields[0]); ++i) {
+        PyObject* py_value =
+            PyDict_GetItemString(buffer_metadata, int_fields[i]);
+        if (py_value == nullptr || !PyLong_Check(py_value)) {
+            PyErr_Format(PyExc_TypeError,
+                         "Key %s provided to %s must be an integer",
+                         int_fields[i],
+                         context);
+            return false;
+        }
+        int_values[i] = get_py_int(py_value);
+    }
+
+    descriptor.data =
+        static_cast<const uint8_t*>(get_c_ptr_from_py_buffer(py_pointer));
+    descriptor.width    = int_values[0];
+    descriptor.height   = int_values[1];
+    descriptor.channels = int_values[2];
+    descriptor.type     = static_cast<Buffer::BufferType>(int_values[3]);
+    descriptor.step     = int_values[4];
+
+    const size_t required_size = descriptor.required_size();
+    if (required_size == 0 || descriptor.step < descriptor.width) {
+        PyErr_Format(PyExc_ValueError,
+                     "Buffer given to %s does not match its dimensions",
+                     context);
+        return false;
+    }
+
+    return check_py_buffer_size(py_pointer, required_size, context);
+}
+
+
+int giw_is_buffer_condition_valid(const char* condition)
+{
+    BufferCondition buffer_condition;
+    return buffer_condition.parse(condition) ? 1 : 0;
+}
+
+
+int giw_evaluate_buffer_condition(PyObject* buffer_metadata,
+                                  const char* condition)
+{
+    BufferCondition buffer_condition;
+    if (!buffer_condition.parse(condition)) {
+        RAISE_PY_EXCEPTION(PyExc_ValueError,
+                           "Invalid condition given to "
+                           "evaluate_buffer_condition");
+        return -1;
+    }
+
+    BufferDescriptor descriptor;
+    PyGILState_STATE gil_state = PyGILState_Ensure();
+    const bool valid_buffer    = get_buffer_descriptor(
+        buffer_metadata, "evaluate_buffer_condition", descriptor);
+    PyGILState_Release(gil_state);
+
+    if (!valid_buffer) {
+        return -1;
+    }
+
+    // The GIL is not held during the scan. The buffer memory is kept alive by
+    // the caller, which owns buffer_metadata.
+    BufferStatistics statistics;
+    if (!compute_buffer_statistics(descriptor, statistics)) {
+        RAISE_PY_EXCEPTION(PyExc_TypeError,
+                           "Buffer given to evaluate_buffer_condition has an "
+                           "unsupported type or number of channels");
+        return -1;
+    }
+
+    return buffer_condition.evaluate(statistics) ? 1 : 0;
+}
+
+
+static bool set_py_list_item(PyObject* list, int index, PyObject* value)
+{
+    if (value == nullptr) {
+        return false;
+    }
+
+    // Steals the reference to value
+    PyList_SET_ITEM(list, index, value);
+
+    return true;
+}
+
+
+static PyObject* build_py_channel_list(const double* values, int channels)
+{
+    PyObject* py_list = PyList_New(channels);
+    if (py_list == nullptr) {
+        return nullptr;
+    }
+
+    for (int c = 0; c < channels; ++c) {
+        if (!set_py_list_item(py_list, c, PyFloat_FromDouble(values[c]))) {
+            Py_DECREF(py_list);
+            return nullptr;
+        }
+    }
+
+    return py_list;
+}
+
+
+static PyObject* build_py_channel_list(const uint64_t* values, int channels)
+{
+    PyObject* py_list = PyList_New(channels);
+    if (py_list == nullptr) {
+        return nullptr;
+    }
+
+    for (int c = 0; c < channels; ++c) {
+        if (!set_py_list_item(py_list,
+                              c,
+                              PyLong_FromUnsignedLongLong(
+                                  static_cast<unsigned long long>(
+                                      values[c])))) {
+            Py_DECREF(py_list);
+            return nullptr;
+        }
+    }
+
+    return py_list;
+}
+
+
+static PyObject* build_py_channel_histograms(const BufferHistogram& histogram,
+                                             int channels)
+{
+    PyObject* py_histograms = PyList_New(channels);
+    if (py_histograms == nullptr) {
+        return nullptr;
+    }
+
+    for (int c = 0; c < channels; ++c) {
+        if (!set_py_list_item(
+                py_histograms,
+                c,
+                build_py_channel_list(histogram.counts[c].data(),
+                                      histogram.num_bins))) {
+            Py_DECREF(py_histograms);
+            return nullptr;
+        }
+    }
+
+    return py_histograms;
+}
+
+
+static PyObject* build_py_buffer_stats(const BufferStatistics& statistics,
+                                       const BufferHistogram* histogram)
+{
+    PyObject* py_stats = PyDict_New();
+    if (py_stats == nullptr) {
+        return nullptr;
+    }
+
+    const int channels = statistics.channels;
+
+    double mean[BufferStatistics::max_channels];
+    for (int c = 0; c < channels; ++c) {
+        mean[c] = statistics.mean(c);
+    }
+
+    const bool ok =
+        set_py_dict_item(py_stats,
+                         "min",
+                         build_py_channel_list(statistics.min, channels)) &&
+        set_py_dict_item(py_stats,
+                         "max",
+                         build_py_channel_list(statistics.max, channels)) &&
+        set_py_dict_item(py_stats,
+                         "mean",
+                         build_py_channel_list(mean, channels)) &&
+        set_py_dict_item(py_stats,
+                         "count",
+                         build_py_channel_list(statistics.count, channels)) &&
+        set_py_dict_item(
+            py_stats,
+            "nan_count",
+            build_py_channel_list(statistics.nan_count, channels)) &&
+        set_py_dict_item(
+            py_stats,
+            "inf_count",
+            build_py_channel_list(statistics.inf_count, channels)) &&
+        (histogram == nullptr ||
+         set_py_dict_item(py_stats,
+                          "histogram",
+                          build_py_channel_histograms(*histogram, channels)));
+
+    if (!ok) {
+        Py_DECREF(py_stats);
+        return nullptr;
+    }
+
+    return py_stats;
+}
+
+
+PyObject* giw_compute_stats(PyObject* buffer_metadata, int histogram_bins)
+{
+    BufferDescriptor descriptor;
+    PyGILState_STATE gil_state = PyGILState_Ensure();
+    const bool valid_buffer =
+        get_buffer_descriptor(buffer_metadata, "compute_stats", descriptor);
+    PyGILState_Release(gil_state);
+
+    if (!valid_buffer) {
+        return nullptr;
+    }
+
+    // As in giw_evaluate_buffer_condition(), the scan runs without the GIL
+    BufferStatistics statistics;
+    BufferHistogram histogram;
+    const bool computed =
+        compute_buffer_statistics(descriptor, statistics) &&
+        (histogram_bins <= 0 || compute_buffer_histogram(descriptor,
+                                                         statistics,
+                                                         histogram_bins,
+                                                         histogram));
+    if (!computed) {
+        RAISE_PY_EXCEPTION(PyExc_TypeError,
+                           "Buffer given to compute_stats has an unsupported "
+                           "type or number of channels");
+        return nullptr;
+    }
+
+    gil_state = PyGILState_Ensure();
+    PyObject* py_stats = build_py_buffer_stats(
+        statistics, histogram_bins > 0 ? &histogram : nullptr);
+    PyGILState_Release(gil_state);
+
+    return py_stats;
+}
+
+
+void giw_trace_set_enabled(int enabled)
+{
+    Tracer::set_enabled(enabled != 0);
+}
+
+
+void giw_trace_record_span(const char* name,
+                           unsigned long long begin_us,
+                           unsigned long long end_us)
+{
+    const uint64_t duration_us = end_us > begin_us ? end_us - begin_us : 0;
+
+    Metrics::record_latency(name, duration_us);
+    Tracer::record_dynamic_span(name, begin_us, end_us);
+}
+
+
+void giw_trace_set_thread_name(const char* name)
+{
+    Tracer::set_thread_name(name);
+}
+
+
+int giw_trace_flush(const char* path)
+{
+    return Tracer::flush(path) ? 1 : 0;
+}
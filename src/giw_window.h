@@ -101,6 +101,28 @@ void giw_exec(AppHandler handler);
 GIW_API
 WindowHandler giw_create_window(int (*plot_callback)(const char*));
 
+/**
+ * Set the callback used to fetch regions of downsampled buffers
+ *
+ * Buffers too large to be fetched at full resolution are plotted as an
+ * overview (see the downsample field of giw_plot_buffer()). As the user zooms
+ * into an overview, the window calls region_callback with the buffer name,
+ * the region origin and dimensions (in buffer pixels) and the sampling step;
+ * the callback is expected to plot the samples as a region of the buffer.
+ *
+ * @param handler  Window handler, generated by giw_create_window()
+ * @param region_callback  Callback function to be called when the window
+ *     needs a region of a buffer
+ */
+GIW_API
+void giw_set_region_callback(WindowHandler handler,
+                             int (*region_callback)(const char*,
+                                                    int,
+                                                    int,
+                                                    int,
+                                                    int,
+                                                    int));
+
 /**
  * Check if the given window is open
  *
@@ -134,6 +156,18 @@ void giw_destroy_window(WindowHandler handler);
 GIW_API
 PyObject* giw_get_observed_buffers(WindowHandler handler);
 
+/**
+ * Get the names of the buffers being visualized that must be refreshed at the
+ * current stop, according to their refresh policies. Must be called once per
+ * debugger stop, since it also counts the stops missed by the other buffers.
+ *
+ * @param handler  Window handler, generated by giw_create_window()
+ * @return  Python list object containing python str objects with the names of
+ *     the buffers to be fetched again.
+ */
+GIW_API
+PyObject* giw_get_buffers_to_refresh(WindowHandler handler);
+
 /**
  * Set list of symbols available in the current context
  *
@@ -149,6 +183,24 @@ GIW_API
 void giw_set_available_symbols(WindowHandler handler,
                                PyObject* available_vars);
 
+/**
+ * Update the list of symbols available in the current context
+ *
+ * Same as giw_set_available_symbols(), but only the symbols that appeared
+ * and disappeared since the previous call are given, so that the cost of the
+ * call doesn't grow with the number of symbols in scope.
+ *
+ * @param handler  Window handler, generated by giw_create_window()
+ * @param added_vars  Python list of python str objects containing the names
+ *     of the symbols that became available.
+ * @param removed_vars  Python list of python str objects containing the
+ *     names of the symbols that are not available anymore.
+ */
+GIW_API
+void giw_update_available_symbols(WindowHandler handler,
+                                  PyObject* added_vars,
+                                  PyObject* removed_vars);
+
 /**
  * Add a buffer to the plot list
  *
@@ -162,10 +214,219 @@ void giw_set_available_symbols(WindowHandler handler,
  *     - [type        ] Buffer type (see symbols.py for details)
  *     - [row_stride  ] Row stride, in pixels
  *     - [pixel_layout] String defining pixel channel layout (e.g. 'rgba')
+ *
+ * Optional elements:
+ *     - [transpose_buffer] Whether the buffer is shown transposed
+ *     - [dirty_rows ] List of (first, last) row ranges modified since the
+ *                     buffer was last plotted
+ *     - [downsample ] For buffers too large to be fetched at full resolution,
+ *                     the buffer contains every downsample-th pixel of every
+ *                     downsample-th row of the actual buffer, whose
+ *                     dimensions are given by [full_width] and [full_height]
+ *     - [region     ] Tuple (x, y, step): the buffer contains every step-th
+ *                     pixel of a region starting at pixel (x, y) of a
+ *                     downsampled buffer, requested by the region callback
+ *     - [slice      ] Tuple (x, y, step): the buffer was plotted from a slice
+ *                     expression, and contains every step-th pixel of every
+ *                     step-th row of the sliced buffer, from its pixel (x, y).
+ *                     Pixel coordinates are shown in the sliced buffer's
+ *                     coordinate system
  * */
 GIW_API
 void giw_plot_buffer(WindowHandler handler, PyObject* bufffer_metadata);
 
+/**
+ * Start recording plot requests to a capture file
+ *
+ * Every buffer given to giw_plot_buffer() from now on is written to the file
+ * (metadata and pixels), so that the session can later be reproduced with
+ * giw_replay_capture(). Starting a new capture closes the previous one. This
+ * function can be called from any thread.
+ *
+ * @param path  Output file path
+ * @return  Returns 1 if the capture file could be created, 0 otherwise.
+ */
+GIW_API
+int giw_capture_start(const char* path);
+
+/**
+ * Stop recording plot requests and close the capture file
+ */
+GIW_API
+void giw_capture_stop();
+
+/**
+ * Replay a capture file recorded with giw_capture_start()
+ *
+ * The requests are fed to the window in the order they were captured, either
+ * with their original timing or as fast as the window can consume them. This
+ * function blocks until all requests were processed by the window, and must
+ * not be called from the GUI thread.
+ *
+ * @param handler  Window handler, generated by giw_create_window()
+ * @param path  Capture file path
+ * @param max_speed  Nonzero to ignore the original timing
+ * @return  Number of replayed requests, or -1 if the file could not be read.
+ */
+GIW_API
+int giw_replay_capture(WindowHandler handler, const char* path, int max_speed);
+
+/**
+ * Start the interaction latency benchmark
+ *
+ * Replays a fixed sequence of wheel, drag and keyboard zoom/pan events on the
+ * buffers being visualized (alone and with linked views, at regular and at
+ * high zoom levels), measuring the input-to-present latency and frame times.
+ * The benchmark starts once all pending plot requests were processed. The
+ * results are written as JSON to report_path. This function can be called
+ * from any thread.
+ *
+ * @param handler  Window handler, generated by giw_create_window()
+ * @param report_path  Path of the JSON report
+ */
+GIW_API
+void giw_start_interaction_benchmark(WindowHandler handler,
+                                     const char* report_path);
+
+/**
+ * Check whether the interaction latency benchmark is running
+ *
+ * @param handler  Window handler, generated by giw_create_window()
+ * @return  Returns 1 if a benchmark was started and has not finished yet, 0
+ *     otherwise.
+ */
+GIW_API
+int giw_is_interaction_benchmark_running(WindowHandler handler);
+
+/**
+ * Check whether a buffer condition is well formed
+ *
+ * @param condition  Condition expression (see giw_evaluate_buffer_condition())
+ * @return  Returns 1 if the condition can be evaluated, 0 otherwise.
+ */
+GIW_API
+int giw_is_buffer_condition_valid(const char* condition);
+
+/**
+ * Evaluate a condition on the statistics of a buffer
+ *
+ * The condition has the form "<reduction> <comparison> <value>", where the
+ * reduction is one of min, max, mean, nan_count or inf_count, and the
+ * comparison is one of <, <=, >, >=, == or !=. The shorthands "nan" and "inf"
+ * test for the presence of any NaN or infinite value. For multi-channel
+ * buffers, the condition holds if it holds for any channel.
+ *
+ * The buffer is scanned natively by multiple threads, and no window is
+ * required.
+ *
+ * @param buffer_metadata  Python dict describing the buffer, with the same
+ * pointer, width, height, channels, type and row_stride fields given to
+ * giw_plot_buffer()
+ * @param condition  Condition expression
+ * @return  Returns 1 if the condition holds, 0 if it doesn't, and -1 (raising
+ * a Python exception) if the buffer or the condition are invalid.
+ */
+GIW_API
+int giw_evaluate_buffer_condition(PyObject* buffer_metadata,
+                                  const char* condition);
+
+/**
+ * Compute the statistics of a buffer
+ *
+ * The buffer is scanned natively by multiple threads, and no window is
+ * required. The returned dict has the following entries, each being a list
+ * with one value per channel:
+ *   - min, max, mean: range and mean of the finite values (NaN if there is
+ *     no finite value)
+ *   - count, nan_count, inf_count: number of finite, NaN and infinite values
+ *   - histogram: only present if histogram_bins is positive; list of
+ *     histogram_bins counts of finite values, spanning [min, max]
+ *
+ * @param buffer_metadata  Python dict describing the buffer, with the same
+ * pointer, width, height, channels, type and row_stride fields given to
+ * giw_plot_buffer()
+ * @param histogram_bins  Number of histogram bins, or 0 to skip the histogram
+ * @return  Python dict with the statistics, or null (raising a Python
+ * exception) if the buffer is invalid
+ */
+GIW_API
+PyObject* giw_compute_stats(PyObject* buffer_metadata, int histogram_bins);
+
+/**
+ * Get the performance metrics collected since the library was loaded
+ *
+ * The returned dict has the following entries:
+ *   - counters: dict of cumulative counters (e.g. bytes_fetched,
+ *     bytes_uploaded, plot_requests)
+ *   - gauges: dict of instantaneous values (e.g. queue_depth)
+ *   - latencies_us: dict mapping each pipeline stage to a histogram of its
+ *     durations, in microseconds
+ *   - histograms: other distributions (e.g. queue_depth, frame_interval_us)
+ *   - caches: dict mapping each cache to a dict with its hits, misses and
+ *     hit_rate
+ *   - buffers: dict mapping each observed buffer name to a dict with its
+ *     host_bytes and gpu_bytes
+ *
+ * Each histogram is a dict with count, sum, min, max, mean, p50, p90, p99 and
+ * buckets (a list of (upper_bound, count) tuples, one per non-empty log2
+ * bucket).
+ *
+ * @param handler  Window handler, generated by giw_create_window()
+ * @return  Python dict with the metrics
+ */
+GIW_API
+PyObject* giw_get_metrics(WindowHandler handler);
+
+/**
+ * Enable or disable the pipeline tracer
+ *
+ * While enabled, every stage of the plot pipeline (metadata retrieval, memory
+ * reads, queueing, conversion, min/max, texture upload, icon rendering and
+ * painting) records a timed span. This function can be called from any
+ * thread.
+ *
+ * @param enabled  Nonzero to start recording spans, zero to stop
+ */
+GIW_API
+void giw_trace_set_enabled(int enabled);
+
+/**
+ * Record a span measured outside of the native library
+ *
+ * Timestamps must come from the monotonic clock (e.g. Python's
+ * time.monotonic() * 1e6). The span is attributed to the calling thread. Its
+ * duration is added to the stage latencies reported by giw_get_metrics() even
+ * if tracing is disabled.
+ *
+ * @param name  Name of the span
+ * @param begin_us  Start of the span, in microseconds
+ * @param end_us  End of the span, in microseconds
+ */
+GIW_API
+void giw_trace_record_span(const char* name,
+                           unsigned long long begin_us,
+                           unsigned long long end_us);
+
+/**
+ * Name the calling thread in the generated traces
+ *
+ * @param name  Thread name
+ */
+GIW_API
+void giw_trace_set_thread_name(const char* name);
+
+/**
+ * Write the spans recorded so far to a trace-event JSON file
+ *
+ * The generated file can be loaded in chrome://tracing or Perfetto. Spans
+ * written to the file are discarded from the tracer.
+ *
+ * @param path  Output file path
+ * @return  Returns 1 if the file was written, 0 otherwise.
+ */
+GIW_API
+int giw_trace_flush(const char* path);
+
 #ifdef __cplusplus
 }
 #endif
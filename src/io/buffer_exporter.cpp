@@ -29,59 +29,35 @@
 
 #include "buffer_exporter.h"
 
-#include "math/assorted.h"
+#include "math/buffer_dispatch.h"
+#include "math/simd_dispatch.h"
 
 
 using namespace std;
 
 
-template <typename T>
-float get_multiplier()
+template <typename T, int Channels>
+void export_bitmap(const char* fname,
+                   const BufferExporter::ExportedBuffer& buffer)
 {
-    return 255.f / static_cast<float>(std::numeric_limits<T>::max());
-}
-
-
-template <>
-float get_multiplier<float>()
-{
-    return 255.f;
-}
-
-
-template <typename T>
-T get_max_intensity()
-{
-    return std::numeric_limits<T>::max();
-}
-
-
-template <>
-float get_max_intensity<float>()
-{
-    return 1.f;
-}
+    const BufferDescriptor& descriptor = buffer.descriptor;
 
-
-template <typename T>
-void export_bitmap(const char* fname, const Buffer* buffer)
-{
-    int width_i  = static_cast<int>(buffer->buffer_width_f);
-    int height_i = static_cast<int>(buffer->buffer_height_f);
+    int width_i  = descriptor.width;
+    int height_i = descriptor.height;
 
     vector<uint8_t> processed_buffer(4 * width_i * height_i);
     uint8_t default_channel_vals[] = {0, 0, 0, 255};
 
     uint8_t* out_ptr = processed_buffer.data();
 
-    const float* bc_comp = buffer->auto_buffer_contrast_brightness();
-    float color_scale    = get_multiplier<T>();
+    const float* bc_comp = buffer.contrast_brightness;
 
     const float max_intensity = get_max_intensity<T>();
+    const float color_scale   = 255.f / max_intensity;
 
     uint8_t pixel_layout[4];
     for (int c = 0; c < 4; ++c) {
-        switch (buffer->get_pixel_layout()[c]) {
+        switch (buffer.pixel_layout[c]) {
         case 'r':
             pixel_layout[c] = 0;
             break;
@@ -97,46 +73,47 @@ void export_bitmap(const char* fname, const Buffer* buffer)
         }
     }
 
-    const T* in_ptr  = reinterpret_cast<T*>(buffer->buffer);
-    int input_stride = buffer->channels * buffer->step;
-    uint8_t unformatted_pixel[4];
+    // Perform contrast normalization
+    float scale[4];
+    float offset[4];
+    for (int c = 0; c < Channels; ++c) {
+        scale[c]  = bc_comp[c] * color_scale;
+        offset[c] = bc_comp[4 + c] * max_intensity * color_scale;
+    }
 
-    for (int y = 0; y < height_i; ++y) {
-        for (int x = 0; x < width_i; ++x) {
-            int col_offset = x * buffer->channels;
-            int c;
+    vector<uint8_t> normalized_buffer(Channels * width_i * height_i);
+    get_simd_kernels().normalize_to_uint8(
+        descriptor, scale, offset, normalized_buffer.data());
 
-            // Perform contrast normalization
-            for (c = 0; c < buffer->channels; ++c) {
-                float in_val = static_cast<float>(in_ptr[col_offset + c]);
+    const uint8_t* in_ptr = normalized_buffer.data();
+    uint8_t unformatted_pixel[4];
 
-                unformatted_pixel[c] = static_cast<uint8_t>(clamp(
-                    (in_val * bc_comp[c] + bc_comp[4 + c] * max_intensity) *
-                        color_scale,
-                    0.f,
-                    255.f));
-            }
+    for (int i = 0; i < width_i * height_i; ++i) {
+        int c;
 
-            // Grayscale: Repeat first channel into G and B
-            if (buffer->channels == 1) {
-                for (; c < 3; ++c) {
-                    unformatted_pixel[c] = unformatted_pixel[0];
-                }
-            }
+        for (c = 0; c < Channels; ++c) {
+            unformatted_pixel[c] = in_ptr[c];
+        }
 
-            // The remaining, non-filled channels will be set to a default value
-            for (; c < 4; ++c) {
-                unformatted_pixel[c] = default_channel_vals[c];
+        // Grayscale: Repeat first channel into G and B
+        if (Channels == 1) {
+            for (; c < 3; ++c) {
+                unformatted_pixel[c] = unformatted_pixel[0];
             }
+        }
 
-            // Reorganize pixel layout according to user provided format
-            for (int c = 0; c < 4; ++c) {
-                out_ptr[pixel_layout[c]] = unformatted_pixel[c];
-            }
-            out_ptr += 4;
+        // The remaining, non-filled channels will be set to a default value
+        for (; c < 4; ++c) {
+            unformatted_pixel[c] = default_channel_vals[c];
+        }
+
+        // Reorganize pixel layout according to user provided format
+        for (int c = 0; c < 4; ++c) {
+            out_ptr[pixel_layout[c]] = unformatted_pixel[c];
         }
 
-        in_ptr += input_stride;
+        in_ptr += Channels;
+        out_ptr += 4;
     }
 
     const int bytes_per_line = width_i * 4;
@@ -188,13 +165,23 @@ const char* get_type_descriptor<float>()
 }
 
 
+template <>
+const char* get_type_descriptor<double>()
+{
+    return "double";
+}
+
+
 template <typename T>
-void export_binary(const char* fname, const Buffer* buffer)
+void export_binary(const char* fname,
+                   const BufferExporter::ExportedBuffer& buffer)
 {
-    int width_i  = static_cast<int>(buffer->buffer_width_f);
-    int height_i = static_cast<int>(buffer->buffer_height_f);
+    const BufferDescriptor& descriptor = buffer.descriptor;
+
+    int width_i  = descriptor.width;
+    int height_i = descriptor.height;
 
-    const T* in_ptr = reinterpret_cast<T*>(buffer->buffer);
+    const T* in_ptr = reinterpret_cast<const T*>(descriptor.data);
 
     FILE* fhandle = fopen(fname, "wb");
 
@@ -202,11 +189,11 @@ void export_binary(const char* fname, const Buffer* buffer)
         fprintf(fhandle, "%s\n", get_type_descriptor<T>());
         fwrite(&height_i, sizeof(int), 1, fhandle);
         fwrite(&width_i, sizeof(int), 1, fhandle);
-        fwrite(&buffer->channels, sizeof(int), 1, fhandle);
+        fwrite(&descriptor.channels, sizeof(int), 1, fhandle);
         for (int y = 0; y < height_i; ++y) {
-            fwrite(in_ptr + y * buffer->step * buffer->channels,
+            fwrite(in_ptr + y * descriptor.step * descriptor.channels,
                    sizeof(T),
-                   width_i * buffer->channels,
+                   width_i * descriptor.channels,
                    fhandle);
         }
         fclose(fhandle);
@@ -214,48 +201,63 @@ void export_binary(const char* fname, const Buffer* buffer)
 }
 
 
-void BufferExporter::export_buffer(const Buffer* buffer,
+struct BitmapExportKernel
+{
+    template <typename T, int Channels>
+    static void run(const char* fname,
+                    const BufferExporter::ExportedBuffer& buffer)
+    {
+        export_bitmap<T, Channels>(fname, buffer);
+    }
+};
+
+
+struct BinaryExportKernel
+{
+    template <typename T, int Channels>
+    static void run(const char* fname,
+                    const BufferExporter::ExportedBuffer& buffer)
+    {
+        export_binary<T>(fname, buffer);
+    }
+};
+
+
+BufferExporter::ExportedBuffer::ExportedBuffer(
+    const Buffer* buffer,
+    const std::shared_ptr<uint8_t>& data_owner)
+    : data_owner(data_owner)
+{
+    descriptor = {buffer->buffer,
+                  static_cast<int>(buffer->buffer_width_f),
+                  static_cast<int>(buffer->buffer_height_f),
+                  buffer->channels,
+                  buffer->get_stored_type(),
+                  buffer->step};
+
+    const float* bc_comp = buffer->auto_buffer_contrast_brightness();
+    for (int i = 0; i < 8; ++i) {
+        contrast_brightness[i] = bc_comp[i];
+    }
+
+    for (int c = 0; c < 4; ++c) {
+        pixel_layout[c] = buffer->get_pixel_layout()[c];
+    }
+}
+
+
+void BufferExporter::export_buffer(const ExportedBuffer& buffer,
                                    const std::string& path,
                                    BufferExporter::OutputType type)
 {
+    const BufferDescriptor& descriptor = buffer.descriptor;
+
     if (type == OutputType::Bitmap) {
-        switch (buffer->type) {
-        case Buffer::BufferType::UnsignedByte:
-            export_bitmap<uint8_t>(path.c_str(), buffer);
-            break;
-        case Buffer::BufferType::UnsignedShort:
-            export_bitmap<uint16_t>(path.c_str(), buffer);
-            break;
-        case Buffer::BufferType::Short:
-            export_bitmap<int16_t>(path.c_str(), buffer);
-            break;
-        case Buffer::BufferType::Int32:
-            export_bitmap<int32_t>(path.c_str(), buffer);
-            break;
-        case Buffer::BufferType::Float32:
-        case Buffer::BufferType::Float64:
-            export_bitmap<float>(path.c_str(), buffer);
-            break;
-        }
+        dispatch_buffer_type<BitmapExportKernel>(
+            descriptor.type, descriptor.channels, path.c_str(), buffer);
     } else {
         // Matlab/Octave matrix (load with the giw_load.m function)
-        switch (buffer->type) {
-        case Buffer::BufferType::UnsignedByte:
-            export_binary<uint8_t>(path.c_str(), buffer);
-            break;
-        case Buffer::BufferType::UnsignedShort:
-            export_binary<uint16_t>(path.c_str(), buffer);
-            break;
-        case Buffer::BufferType::Short:
-            export_binary<int16_t>(path.c_str(), buffer);
-            break;
-        case Buffer::BufferType::Int32:
-            export_binary<int32_t>(path.c_str(), buffer);
-            break;
-        case Buffer::BufferType::Float32:
-        case Buffer::BufferType::Float64:
-            export_binary<float>(path.c_str(), buffer);
-            break;
-        }
+        dispatch_buffer_type<BinaryExportKernel>(
+            descriptor.type, descriptor.channels, path.c_str(), buffer);
     }
 }
@@ -26,6 +26,10 @@
 #ifndef BUFFER_EXPORTER_H_
 #define BUFFER_EXPORTER_H_
 
+#include <memory>
+#include <string>
+
+#include "math/buffer_statistics.h"
 #include "visualization/components/buffer.h"
 
 
@@ -34,7 +38,23 @@ class BufferExporter
   public:
     enum class OutputType { Bitmap, OctaveMatrix };
 
-    static void export_buffer(const Buffer* buffer,
+    /**
+     * Pixel data and display parameters of a buffer when its export was
+     * requested. The data is kept alive by data_owner, so that the buffer can
+     * be exported by a task worker while it is updated.
+     */
+    struct ExportedBuffer
+    {
+        std::shared_ptr<uint8_t> data_owner;
+        BufferDescriptor descriptor;
+        float contrast_brightness[8];
+        char pixel_layout[4];
+
+        ExportedBuffer(const Buffer* buffer,
+                       const std::shared_ptr<uint8_t>& data_owner);
+    };
+
+    static void export_buffer(const ExportedBuffer& buffer,
                               const std::string& path,
                               OutputType type);
 };
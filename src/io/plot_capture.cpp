@@ -0,0 +1,244 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include <cstring>
+#include <mutex>
+
+#include "plot_capture.h"
+
+#include "profiling/tracer.h"
+
+
+using namespace std;
+
+
+static const char capture_magic[] = "GIWCAP01";
+static const size_t capture_magic_size = sizeof(capture_magic) - 1;
+
+
+struct CaptureState
+{
+    mutex capture_mutex;
+    FILE* output          = nullptr;
+    uint64_t started_at_us = 0;
+};
+
+
+static CaptureState& get_capture_state()
+{
+    static CaptureState state;
+    return state;
+}
+
+
+template <typename T>
+static void write_value(FILE* output, T value)
+{
+    fwrite(&value, sizeof(T), 1, output);
+}
+
+
+static void write_string(FILE* output, const string& str)
+{
+    write_value<uint32_t>(output, str.size());
+    fwrite(str.data(), 1, str.size(), output);
+}
+
+
+template <typename T>
+static bool read_value(FILE* input, T& value)
+{
+    return fread(&value, sizeof(T), 1, input) == 1;
+}
+
+
+static bool read_string(FILE* input, string& str)
+{
+    uint32_t size;
+    if (!read_value(input, size)) {
+        return false;
+    }
+
+    str.resize(size);
+    return size == 0 || fread(&str[0], 1, size, input) == size;
+}
+
+
+bool PlotCapture::start(const string& path)
+{
+    CaptureState& state = get_capture_state();
+    unique_lock<mutex> lock(state.capture_mutex);
+
+    if (state.output != nullptr) {
+        fclose(state.output);
+    }
+
+    state.output = fopen(path.c_str(), "wb");
+    if (state.output == nullptr) {
+        return false;
+    }
+
+    fwrite(capture_magic, 1, capture_magic_size, state.output);
+    state.started_at_us = Tracer::now_us();
+
+    return true;
+}
+
+
+void PlotCapture::stop()
+{
+    CaptureState& state = get_capture_state();
+    unique_lock<mutex> lock(state.capture_mutex);
+
+    if (state.output != nullptr) {
+        fclose(state.output);
+        state.output = nullptr;
+    }
+}
+
+
+bool PlotCapture::is_active()
+{
+    CaptureState& state = get_capture_state();
+    unique_lock<mutex> lock(state.capture_mutex);
+
+    return state.output != nullptr;
+}
+
+
+void PlotCapture::record(const BufferRequestMessage& request)
+{
+    CaptureState& state = get_capture_state();
+    unique_lock<mutex> lock(state.capture_mutex);
+
+    if (state.output == nullptr) {
+        return;
+    }
+
+    GIW_TRACE_SCOPE("capture_write");
+
+    FILE* output = state.output;
+
+    write_value<uint64_t>(output, Tracer::now_us() - state.started_at_us);
+    write_string(output, request.variable_name_str);
+    write_string(output, request.display_name_str);
+    write_string(output, request.pixel_layout);
+    write_value<int32_t>(output, request.width_i);
+    write_value<int32_t>(output, request.height_i);
+    write_value<int32_t>(output, request.channels);
+    write_value<int32_t>(output, static_cast<int32_t>(request.type));
+    write_value<int32_t>(output, request.step);
+    write_value<uint8_t>(output, request.transpose_buffer ? 1 : 0);
+    write_value<uint64_t>(output, request.buffer_size);
+    fwrite(request.buffer_ptr, 1, request.buffer_size, output);
+
+    fflush(output);
+}
+
+
+PlotCaptureReader::PlotCaptureReader()
+    : input_(nullptr)
+{
+}
+
+
+PlotCaptureReader::~PlotCaptureReader()
+{
+    if (input_ != nullptr) {
+        fclose(input_);
+    }
+}
+
+
+bool PlotCaptureReader::open(const string& path)
+{
+    input_ = fopen(path.c_str(), "rb");
+    if (input_ == nullptr) {
+        return false;
+    }
+
+    char magic[capture_magic_size];
+    if (fread(magic, 1, capture_magic_size, input_) != capture_magic_size ||
+        memcmp(magic, capture_magic, capture_magic_size) != 0) {
+        fclose(input_);
+        input_ = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+
+unique_ptr<BufferRequestMessage>
+PlotCaptureReader::read_next(uint64_t& timestamp_us)
+{
+    if (input_ == nullptr) {
+        return nullptr;
+    }
+
+    string variable_name;
+    string display_name;
+    string pixel_layout;
+    int32_t width;
+    int32_t height;
+    int32_t channels;
+    int32_t type;
+    int32_t step;
+    uint8_t transpose;
+    uint64_t buffer_size;
+
+    const bool header_read =
+        read_value(input_, timestamp_us) &&
+        read_string(input_, variable_name) &&
+        read_string(input_, display_name) &&
+        read_string(input_, pixel_layout) && read_value(input_, width) &&
+        read_value(input_, height) && read_value(input_, channels) &&
+        read_value(input_, type) && read_value(input_, step) &&
+        read_value(input_, transpose) && read_value(input_, buffer_size);
+
+    if (!header_read) {
+        return nullptr;
+    }
+
+    shared_ptr<uint8_t> buffer(new uint8_t[buffer_size],
+                               [](uint8_t* buff) { delete[] buff; });
+
+    if (fread(buffer.get(), 1, buffer_size, input_) != buffer_size) {
+        return nullptr;
+    }
+
+    return unique_ptr<BufferRequestMessage>(
+        new BufferRequestMessage(buffer,
+                                 buffer_size,
+                                 variable_name,
+                                 display_name,
+                                 width,
+                                 height,
+                                 channels,
+                                 type,
+                                 step,
+                                 pixel_layout,
+                                 transpose != 0));
+}
@@ -0,0 +1,86 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef PLOT_CAPTURE_H_
+#define PLOT_CAPTURE_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "debuggerinterface/buffer_request_message.h"
+
+
+/**
+ * Records every plot request (metadata and pixel bytes) to a capture file, so
+ * that a debugging session can be replayed later without a debugger (see
+ * PlotCaptureReader).
+ *
+ * File layout (native byte order): the magic string "GIWCAP01", followed by
+ * one record per request:
+ *   uint64 timestamp (microseconds since the capture started)
+ *   string variable name, string display name, string pixel layout
+ *   int32 width, height, channels, type, step
+ *   uint8 transpose flag
+ *   uint64 number of pixel bytes, followed by the bytes
+ * where each string is an uint32 length followed by its characters.
+ */
+class PlotCapture
+{
+  public:
+    static bool start(const std::string& path);
+
+    static void stop();
+
+    static bool is_active();
+
+    static void record(const BufferRequestMessage& request);
+};
+
+
+class PlotCaptureReader
+{
+  public:
+    PlotCaptureReader();
+
+    ~PlotCaptureReader();
+
+    bool open(const std::string& path);
+
+    /**
+     * Read the next request of the capture
+     *
+     * @param timestamp_us  Time of the request, in microseconds since the
+     *     capture started
+     * @return  nullptr at the end of the file or if it is truncated
+     */
+    std::unique_ptr<BufferRequestMessage> read_next(uint64_t& timestamp_us);
+
+  private:
+    FILE* input_;
+};
+
+#endif // PLOT_CAPTURE_H_
@@ -0,0 +1,166 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include <QDateTime>
+#include <QList>
+#include <QPair>
+#include <QSettings>
+#include <QVariant>
+
+#include "settings_writer.h"
+
+#include "profiling/tracer.h"
+
+
+using namespace std;
+
+
+static void write_settings(const PersistedSettings& snapshot)
+{
+    GIW_TRACE_SCOPE("settings_write");
+
+    using BufferExpiration = QPair<QString, QDateTime>;
+
+    QSettings settings(QSettings::Format::IniFormat,
+                       QSettings::Scope::UserScope,
+                       "gdbimagewatch");
+
+    QList<BufferExpiration> persisted_session_buffers;
+
+    // Load previous session symbols
+    QList<BufferExpiration> previous_session_buffers_qlist =
+        settings.value("PreviousSession/buffers")
+            .value<QList<BufferExpiration>>();
+
+    QDateTime now             = QDateTime::currentDateTime();
+    QDateTime next_expiration = now.addDays(1);
+
+    // Of the buffers not currently being visualized, only keep those whose
+    // timer hasn't expired yet and is not in the set of removed names
+    for (const auto& prev_buff : previous_session_buffers_qlist) {
+        const string buff_name_std_str = prev_buff.first.toStdString();
+
+        const bool being_viewed =
+            snapshot.held_buffers.find(buff_name_std_str) !=
+            snapshot.held_buffers.end();
+        const bool was_removed =
+            snapshot.removed_buffers.find(buff_name_std_str) !=
+            snapshot.removed_buffers.end();
+
+        if (!was_removed && !being_viewed && prev_buff.second >= now) {
+            persisted_session_buffers.append(prev_buff);
+        }
+    }
+
+    for (const auto& held_buffer : snapshot.held_buffers) {
+        persisted_session_buffers.append(
+            BufferExpiration(held_buffer.c_str(), next_expiration));
+    }
+
+    // Write default suffix for buffer export
+    settings.setValue("Export/default_export_suffix",
+                      snapshot.default_export_suffix);
+
+    // Write maximum framerate
+    settings.setValue("Rendering/maximum_framerate", snapshot.render_framerate);
+    settings.setValue("Rendering/renderer", snapshot.renderer);
+
+    // Write previous session symbols
+    settings.setValue("PreviousSession/buffers",
+                      QVariant::fromValue(persisted_session_buffers));
+
+    // Write selected symbol, which is the first one to be restored
+    settings.setValue("PreviousSession/selected_buffer",
+                      snapshot.selected_buffer);
+
+    // Write window position/size
+    settings.beginGroup("MainWindow");
+    settings.setValue("size", snapshot.window_size);
+    settings.setValue("pos", snapshot.window_pos);
+    settings.endGroup();
+
+    settings.sync();
+}
+
+
+SettingsWriter::SettingsWriter()
+    : stop_(false)
+    , thread_(&SettingsWriter::run, this)
+{
+}
+
+
+SettingsWriter::~SettingsWriter()
+{
+    {
+        unique_lock<mutex> lock(mutex_);
+        stop_ = true;
+    }
+    pending_cv_.notify_one();
+
+    thread_.join();
+}
+
+
+void SettingsWriter::write(const PersistedSettings& settings)
+{
+    {
+        unique_lock<mutex> lock(mutex_);
+
+        unique_ptr<PersistedSettings> snapshot(new PersistedSettings(settings));
+        if (pending_ != nullptr) {
+            // The buffers removed in the replaced snapshot must still be
+            // forgotten
+            snapshot->removed_buffers.insert(pending_->removed_buffers.begin(),
+                                             pending_->removed_buffers.end());
+        }
+        pending_ = move(snapshot);
+    }
+
+    pending_cv_.notify_one();
+}
+
+
+void SettingsWriter::run()
+{
+    Tracer::set_thread_name("settings writer");
+
+    unique_lock<mutex> lock(mutex_);
+
+    while (true) {
+        pending_cv_.wait(lock, [this] { return stop_ || pending_ != nullptr; });
+
+        if (pending_ == nullptr) {
+            // Stop requested and nothing left to write
+            return;
+        }
+
+        unique_ptr<PersistedSettings> snapshot = move(pending_);
+
+        lock.unlock();
+        write_settings(*snapshot);
+        lock.lock();
+    }
+}
@@ -0,0 +1,90 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef SETTINGS_WRITER_H_
+#define SETTINGS_WRITER_H_
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+#include <QPoint>
+#include <QSize>
+#include <QString>
+
+
+/**
+ * State of the window to be persisted by SettingsWriter, captured by the GUI
+ * thread
+ */
+struct PersistedSettings
+{
+    // Buffers being visualized, whose expiration is renewed
+    std::set<std::string> held_buffers;
+    // Buffers removed by the user, which must not be restored anymore
+    std::set<std::string> removed_buffers;
+    QString selected_buffer;
+
+    QString default_export_suffix;
+    double render_framerate;
+    QString renderer;
+
+    QSize window_size;
+    QPoint window_pos;
+};
+
+
+/**
+ * Writes the window settings from a background thread, so that the QSettings
+ * file I/O doesn't delay the GUI thread. Only the most recent pending snapshot
+ * is written; snapshots that are replaced before being written are dropped.
+ */
+class SettingsWriter
+{
+  public:
+    SettingsWriter();
+
+    /**
+     * Writes the pending snapshot, if any, before returning
+     */
+    ~SettingsWriter();
+
+    void write(const PersistedSettings& settings);
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable pending_cv_;
+    std::unique_ptr<PersistedSettings> pending_;
+    bool stop_;
+
+    std::thread thread_;
+
+    void run();
+};
+
+#endif // SETTINGS_WRITER_H_
@@ -0,0 +1,125 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef BUFFER_DISPATCH_H_
+#define BUFFER_DISPATCH_H_
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "visualization/components/buffer.h"
+
+
+/**
+ * Call Kernel::run<T, Channels>(args...) for the given number of channels
+ * (see dispatch_buffer_type())
+ */
+template <typename Kernel, typename T, typename... Args>
+bool dispatch_buffer_channels(int channels, Args&&... args)
+{
+    switch (channels) {
+    case 1:
+        Kernel::template run<T, 1>(std::forward<Args>(args)...);
+        return true;
+    case 2:
+        Kernel::template run<T, 2>(std::forward<Args>(args)...);
+        return true;
+    case 3:
+        Kernel::template run<T, 3>(std::forward<Args>(args)...);
+        return true;
+    case 4:
+        Kernel::template run<T, 4>(std::forward<Args>(args)...);
+        return true;
+    default:
+        return false;
+    }
+}
+
+
+/**
+ * Call Kernel::run<T, Channels>(args...), where T is the type of the values
+ * of a buffer of the given type, and Channels its number of channels.
+ *
+ * Per-pixel algorithms are written once as such kernels, and run on the
+ * concrete value type and number of channels: the type and channels are
+ * checked once per call, instead of once per value. Types are mapped to their
+ * value types only here, so new types are added in a single place.
+ *
+ * Returns false if the type or number of channels is not supported.
+ */
+template <typename Kernel, typename... Args>
+bool dispatch_buffer_type(Buffer::BufferType type, int channels, Args&&... args)
+{
+    switch (type) {
+    case Buffer::BufferType::UnsignedByte:
+        return dispatch_buffer_channels<Kernel, uint8_t>(
+            channels, std::forward<Args>(args)...);
+    case Buffer::BufferType::UnsignedShort:
+        return dispatch_buffer_channels<Kernel, uint16_t>(
+            channels, std::forward<Args>(args)...);
+    case Buffer::BufferType::Short:
+        return dispatch_buffer_channels<Kernel, int16_t>(
+            channels, std::forward<Args>(args)...);
+    case Buffer::BufferType::Int32:
+        return dispatch_buffer_channels<Kernel, int32_t>(
+            channels, std::forward<Args>(args)...);
+    case Buffer::BufferType::Float32:
+        return dispatch_buffer_channels<Kernel, float>(
+            channels, std::forward<Args>(args)...);
+    case Buffer::BufferType::Float64:
+        return dispatch_buffer_channels<Kernel, double>(
+            channels, std::forward<Args>(args)...);
+    default:
+        return false;
+    }
+}
+
+
+/**
+ * Value shown at full intensity in buffers of type T, when their contrast is
+ * not adjusted
+ */
+template <typename T>
+float get_max_intensity()
+{
+    return static_cast<float>(std::numeric_limits<T>::max());
+}
+
+
+template <>
+inline float get_max_intensity<float>()
+{
+    return 1.f;
+}
+
+
+template <>
+inline float get_max_intensity<double>()
+{
+    return 1.f;
+}
+
+#endif // BUFFER_DISPATCH_H_
@@ -0,0 +1,491 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include "buffer_statistics.h"
+
+#include "math/buffer_dispatch.h"
+#include "math/simd_dispatch.h"
+#include "concurrency/task_scheduler.h"
+#include "profiling/tracer.h"
+
+using namespace std;
+
+
+// Below this number of values per block, handing blocks to the task workers
+// costs more than what it saves
+static const size_t min_values_per_block = 1 << 18;
+
+
+size_t BufferDescriptor::type_size() const
+{
+    if (type == Buffer::BufferType::UnsignedShort ||
+        type == Buffer::BufferType::Short) {
+        return 2;
+    } else if (type == Buffer::BufferType::Int32 ||
+               type == Buffer::BufferType::Float32) {
+        return 4;
+    } else if (type == Buffer::BufferType::Float64) {
+        return 8;
+    }
+
+    return 1;
+}
+
+
+size_t BufferDescriptor::required_size() const
+{
+    if (width <= 0 || height <= 0) {
+        return 0;
+    }
+
+    return ((static_cast<size_t>(height) - 1) * step + width) * channels *
+           type_size();
+}
+
+
+BufferDescriptor BufferDescriptor::rows(int first_row, int last_row) const
+{
+    BufferDescriptor block = *this;
+
+    block.data += static_cast<size_t>(first_row) * step * channels *
+                  type_size();
+    block.height = last_row - first_row;
+
+    return block;
+}
+
+
+BufferStatistics::BufferStatistics()
+    : channels(0)
+{
+    for (int c = 0; c < max_channels; ++c) {
+        min[c]       = numeric_limits<double>::infinity();
+        max[c]       = -numeric_limits<double>::infinity();
+        sum[c]       = 0.0;
+        count[c]     = 0;
+        nan_count[c] = 0;
+        inf_count[c] = 0;
+    }
+}
+
+
+double BufferStatistics::mean(int channel) const
+{
+    if (count[channel] == 0) {
+        return numeric_limits<double>::quiet_NaN();
+    }
+
+    return sum[channel] / static_cast<double>(count[channel]);
+}
+
+
+template <typename T>
+static inline bool is_finite_value(T)
+{
+    return true;
+}
+
+
+template <>
+inline bool is_finite_value(float value)
+{
+    // False for both infinities and NaN, and cheaper to vectorize than
+    // std::isfinite
+    return value - value == 0.0f;
+}
+
+
+template <>
+inline bool is_finite_value(double value)
+{
+    return value - value == 0.0;
+}
+
+
+static void merge_statistics(const BufferStatistics& partial,
+                             BufferStatistics& total)
+{
+    total.channels = partial.channels;
+
+    for (int c = 0; c < partial.channels; ++c) {
+        total.min[c] = std::min(total.min[c], partial.min[c]);
+        total.max[c] = std::max(total.max[c], partial.max[c]);
+        total.sum[c] += partial.sum[c];
+        total.count[c] += partial.count[c];
+        total.nan_count[c] += partial.nan_count[c];
+        total.inf_count[c] += partial.inf_count[c];
+    }
+}
+
+
+int get_num_scan_blocks(const BufferDescriptor& buffer)
+{
+    const size_t num_values = static_cast<size_t>(buffer.width) *
+                              buffer.height * buffer.channels;
+    const size_t num_threads =
+        static_cast<size_t>(TaskScheduler::instance().num_workers()) + 1;
+    const size_t useful_blocks =
+        std::max<size_t>(1, num_values / min_values_per_block);
+    const size_t num_rows = static_cast<size_t>(std::max(buffer.height, 1));
+
+    return static_cast<int>(std::min({num_threads, useful_blocks, num_rows}));
+}
+
+
+void for_each_row_block(const BufferDescriptor& buffer,
+                        int num_blocks,
+                        const function<void(int, int, int)>& process_rows)
+{
+    TaskScheduler::instance().parallel_for(num_blocks, [&](int block) {
+        process_rows(block,
+                     buffer.height * block / num_blocks,
+                     buffer.height * (block + 1) / num_blocks);
+    });
+}
+
+
+struct StatisticsKernel
+{
+    template <typename T, int Channels>
+    static void run(const BufferDescriptor& buffer,
+                    BufferStatistics& statistics)
+    {
+        const SimdKernels& kernels = get_simd_kernels();
+        const int num_blocks       = get_num_scan_blocks(buffer);
+        vector<BufferStatistics> partial_statistics(num_blocks);
+
+        for_each_row_block(
+            buffer, num_blocks, [&](int block, int first_row, int last_row) {
+                kernels.scan_statistics(buffer.rows(first_row, last_row),
+                                        partial_statistics[block]);
+            });
+
+        for (const auto& partial : partial_statistics) {
+            merge_statistics(partial, statistics);
+        }
+
+        // Channels without finite values have no meaningful range
+        for (int c = 0; c < Channels; ++c) {
+            if (statistics.count[c] == 0) {
+                statistics.min[c] = numeric_limits<double>::quiet_NaN();
+                statistics.max[c] = numeric_limits<double>::quiet_NaN();
+            }
+        }
+    }
+};
+
+
+/**
+ * Count the finite values of rows [first_row, last_row) in num_bins bins per
+ * channel, spanning the [min, max] range of each channel
+ */
+template <typename T, int Channels>
+static void histogram_rows(const BufferDescriptor& buffer,
+                           int first_row,
+                           int last_row,
+                           const BufferStatistics& statistics,
+                           BufferHistogram& histogram)
+{
+    const int num_bins = histogram.num_bins;
+
+    double lowest[Channels];
+    double bin_scale[Channels];
+    for (int c = 0; c < Channels; ++c) {
+        const double range = statistics.max[c] - statistics.min[c];
+        lowest[c]          = statistics.min[c];
+        bin_scale[c]       = range > 0.0 ? num_bins / range : 0.0;
+    }
+
+    const T* pixels = reinterpret_cast<const T*>(buffer.data);
+    const size_t row_stride = static_cast<size_t>(buffer.step) * Channels;
+
+    for (int y = first_row; y < last_row; ++y) {
+        const T* row = pixels + y * row_stride;
+
+        for (int x = 0; x < buffer.width; ++x) {
+            for (int c = 0; c < Channels; ++c) {
+                const T value = row[x * Channels + c];
+                if (!is_finite_value(value)) {
+                    continue;
+                }
+
+                const int bin = static_cast<int>(
+                    (static_cast<double>(value) - lowest[c]) * bin_scale[c]);
+                ++histogram.counts[c][std::min(bin, num_bins - 1)];
+            }
+        }
+    }
+}
+
+
+struct HistogramKernel
+{
+    template <typename T, int Channels>
+    static void run(const BufferDescriptor& buffer,
+                    const BufferStatistics& statistics,
+                    BufferHistogram& histogram)
+    {
+        const int num_blocks = get_num_scan_blocks(buffer);
+        vector<BufferHistogram> partial_histograms(num_blocks);
+
+        for (auto& partial : partial_histograms) {
+            partial.reset(Channels, histogram.num_bins);
+        }
+
+        for_each_row_block(
+            buffer, num_blocks, [&](int block, int first_row, int last_row) {
+                histogram_rows<T, Channels>(buffer,
+                                            first_row,
+                                            last_row,
+                                            statistics,
+                                            partial_histograms[block]);
+            });
+
+        histogram.reset(Channels, histogram.num_bins);
+        for (const auto& partial : partial_histograms) {
+            for (int c = 0; c < Channels; ++c) {
+                for (int bin = 0; bin < histogram.num_bins; ++bin) {
+                    histogram.counts[c][bin] += partial.counts[c][bin];
+                }
+            }
+        }
+    }
+};
+
+
+/**
+ * Call Kernel::run<T, Channels>(buffer, args...) with the element type and
+ * number of channels of the buffer. Returns false if they are not supported.
+ */
+template <typename Kernel, typename... Args>
+static bool dispatch_buffer_kernel(const BufferDescriptor& buffer,
+                                   Args&... args)
+{
+    if (buffer.width <= 0 || buffer.height <= 0 ||
+        buffer.step < buffer.width) {
+        return false;
+    }
+
+    return dispatch_buffer_type<Kernel>(
+        buffer.type, buffer.channels, buffer, args...);
+}
+
+
+bool compute_buffer_statistics(const BufferDescriptor& buffer,
+                               BufferStatistics& statistics)
+{
+    GIW_TRACE_SCOPE("buffer_statistics");
+
+    statistics = BufferStatistics();
+
+    return dispatch_buffer_kernel<StatisticsKernel>(buffer, statistics);
+}
+
+
+void BufferHistogram::reset(int channels, int num_bins)
+{
+    this->num_bins = num_bins;
+    for (int c = 0; c < BufferStatistics::max_channels; ++c) {
+        counts[c].assign(c < channels ? num_bins : 0, 0);
+    }
+}
+
+
+bool compute_buffer_histogram(const BufferDescriptor& buffer,
+                              const BufferStatistics& statistics,
+                              int num_bins,
+                              BufferHistogram& histogram)
+{
+    GIW_TRACE_SCOPE("buffer_histogram");
+
+    if (num_bins <= 0) {
+        return false;
+    }
+
+    histogram.num_bins = num_bins;
+
+    return dispatch_buffer_kernel<HistogramKernel>(
+        buffer, statistics, histogram);
+}
+
+
+bool BufferCondition::parse(const string& expression)
+{
+    // Split the expression in <reduction> <comparison> <value>
+    size_t pos = 0;
+    auto skip_spaces = [&]() {
+        while (pos < expression.size() && isspace(expression[pos])) {
+            ++pos;
+        }
+    };
+
+    skip_spaces();
+    const size_t name_begin = pos;
+    while (pos < expression.size() &&
+           (isalpha(expression[pos]) || expression[pos] == '_')) {
+        ++pos;
+    }
+    const string name = expression.substr(name_begin, pos - name_begin);
+
+    skip_spaces();
+    const size_t comparison_begin = pos;
+    while (pos < expression.size() &&
+           string("<>=!").find(expression[pos]) != string::npos) {
+        ++pos;
+    }
+    const string comparison =
+        expression.substr(comparison_begin, pos - comparison_begin);
+
+    // Shorthands for "there is any NaN/infinite value"
+    if (comparison.empty()) {
+        skip_spaces();
+        if (pos != expression.size()) {
+            return false;
+        }
+
+        if (name == "nan") {
+            reduction_ = Reduction::NanCount;
+        } else if (name == "inf") {
+            reduction_ = Reduction::InfCount;
+        } else {
+            return false;
+        }
+        comparison_ = Comparison::Greater;
+        value_      = 0.0;
+
+        return true;
+    }
+
+    Reduction reduction;
+    if (name == "min") {
+        reduction = Reduction::Min;
+    } else if (name == "max") {
+        reduction = Reduction::Max;
+    } else if (name == "mean") {
+        reduction = Reduction::Mean;
+    } else if (name == "nan_count") {
+        reduction = Reduction::NanCount;
+    } else if (name == "inf_count") {
+        reduction = Reduction::InfCount;
+    } else {
+        return false;
+    }
+
+    Comparison parsed_comparison;
+    if (comparison == "<") {
+        parsed_comparison = Comparison::Less;
+    } else if (comparison == "<=") {
+        parsed_comparison = Comparison::LessEqual;
+    } else if (comparison == ">") {
+        parsed_comparison = Comparison::Greater;
+    } else if (comparison == ">=") {
+        parsed_comparison = Comparison::GreaterEqual;
+    } else if (comparison == "==") {
+        parsed_comparison = Comparison::Equal;
+    } else if (comparison == "!=") {
+        parsed_comparison = Comparison::NotEqual;
+    } else {
+        return false;
+    }
+
+    const char* value_begin = expression.c_str() + pos;
+    char* value_end;
+    const double value = strtod(value_begin, &value_end);
+    if (value_end == value_begin) {
+        return false;
+    }
+    pos += value_end - value_begin;
+
+    skip_spaces();
+    if (pos != expression.size()) {
+        return false;
+    }
+
+    reduction_  = reduction;
+    comparison_ = parsed_comparison;
+    value_      = value;
+
+    return true;
+}
+
+
+bool BufferCondition::evaluate(const BufferStatistics& statistics) const
+{
+    for (int c = 0; c < statistics.channels; ++c) {
+        double reduced_value = 0.0;
+        switch (reduction_) {
+        case Reduction::Min:
+            reduced_value = statistics.min[c];
+            break;
+        case Reduction::Max:
+            reduced_value = statistics.max[c];
+            break;
+        case Reduction::Mean:
+            reduced_value = statistics.mean(c);
+            break;
+        case Reduction::NanCount:
+            reduced_value = static_cast<double>(statistics.nan_count[c]);
+            break;
+        case Reduction::InfCount:
+            reduced_value = static_cast<double>(statistics.inf_count[c]);
+            break;
+        }
+
+        bool holds = false;
+        switch (comparison_) {
+        case Comparison::Less:
+            holds = reduced_value < value_;
+            break;
+        case Comparison::LessEqual:
+            holds = reduced_value <= value_;
+            break;
+        case Comparison::Greater:
+            holds = reduced_value > value_;
+            break;
+        case Comparison::GreaterEqual:
+            holds = reduced_value >= value_;
+            break;
+        case Comparison::Equal:
+            holds = reduced_value == value_;
+            break;
+        case Comparison::NotEqual:
+            holds = reduced_value != value_;
+            break;
+        }
+
+        if (holds) {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,174 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef BUFFER_STATISTICS_H_
+#define BUFFER_STATISTICS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "visualization/components/buffer.h"
+
+
+/**
+ * Location and layout of a buffer in host memory, as described by the
+ * debugger bridge (see giw_plot_buffer())
+ */
+struct BufferDescriptor
+{
+    const uint8_t* data;
+    int width;
+    int height;
+    int channels;
+    Buffer::BufferType type;
+    // Row stride, in pixels
+    int step;
+
+    /**
+     * Size of each channel value, in bytes
+     */
+    size_t type_size() const;
+
+    /**
+     * Number of bytes spanned by the buffer, from its first to its last pixel
+     */
+    size_t required_size() const;
+
+    /**
+     * Rows [first_row, last_row) of the buffer
+     */
+    BufferDescriptor rows(int first_row, int last_row) const;
+};
+
+
+/**
+ * Per channel statistics of a buffer. NaN and infinite values are counted
+ * separately, and do not take part in the min, max and mean.
+ */
+struct BufferStatistics
+{
+    static const int max_channels = 4;
+
+    int channels;
+    double min[max_channels];
+    double max[max_channels];
+    double sum[max_channels];
+    // Number of finite values
+    uint64_t count[max_channels];
+    uint64_t nan_count[max_channels];
+    uint64_t inf_count[max_channels];
+
+    BufferStatistics();
+
+    double mean(int channel) const;
+};
+
+
+/**
+ * Number of row blocks worth scanning in parallel for the given buffer
+ */
+int get_num_scan_blocks(const BufferDescriptor& buffer);
+
+
+/**
+ * Split the buffer rows in num_blocks contiguous blocks, and call
+ * process_rows(block, first_row, last_row) for each of them in parallel, in
+ * the calling thread and the workers of the TaskScheduler
+ */
+void for_each_row_block(const BufferDescriptor& buffer,
+                        int num_blocks,
+                        const std::function<void(int, int, int)>& process_rows);
+
+
+/**
+ * Scan the whole buffer, splitting its rows among the task workers. Returns
+ * false if the buffer type or number of channels is not supported.
+ */
+bool compute_buffer_statistics(const BufferDescriptor& buffer,
+                               BufferStatistics& statistics);
+
+
+/**
+ * Per channel histogram of the finite values of a buffer, with num_bins equal
+ * bins spanning the [min, max] range of each channel
+ */
+struct BufferHistogram
+{
+    int num_bins;
+    std::vector<uint64_t> counts[BufferStatistics::max_channels];
+
+    void reset(int channels, int num_bins);
+};
+
+
+/**
+ * Compute the histogram of a buffer, given its statistics (see
+ * compute_buffer_statistics()). Returns false if the number of bins, buffer
+ * type or number of channels is not supported.
+ */
+bool compute_buffer_histogram(const BufferDescriptor& buffer,
+                              const BufferStatistics& statistics,
+                              int num_bins,
+                              BufferHistogram& histogram);
+
+
+/**
+ * Predicate on the statistics of a buffer, parsed from expressions such as
+ * "max > 10", "mean <= 0.5", "nan_count >= 1" or the shorthands "nan" and
+ * "inf" (any NaN or infinite value, respectively). The predicate holds if it
+ * holds for any of the buffer channels.
+ */
+class BufferCondition
+{
+  public:
+    enum class Reduction { Min, Max, Mean, NanCount, InfCount };
+
+    enum class Comparison {
+        Less,
+        LessEqual,
+        Greater,
+        GreaterEqual,
+        Equal,
+        NotEqual
+    };
+
+    /**
+     * Returns false (leaving the condition unchanged) if the expression is
+     * malformed
+     */
+    bool parse(const std::string& expression);
+
+    bool evaluate(const BufferStatistics& statistics) const;
+
+  private:
+    Reduction reduction_   = Reduction::NanCount;
+    Comparison comparison_ = Comparison::Greater;
+    double value_          = 0.0;
+};
+
+#endif // BUFFER_STATISTICS_H_
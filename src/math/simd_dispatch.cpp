@@ -0,0 +1,220 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+#include "simd_dispatch.h"
+
+#include "profiling/metrics.h"
+
+using namespace std;
+
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GIW_SIMD_X86
+#endif
+
+
+/*
+ * The same kernels are compiled once per instruction set, each in its own
+ * namespace. Only the selected set of kernels is ever called, so the rest of
+ * the library can be built for the baseline x86 CPU.
+ */
+#ifdef GIW_SIMD_X86
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("sse2"))), \
+                             apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#pragma GCC optimize("tree-vectorize")
+#endif
+namespace sse2_kernels
+{
+#include "simd_kernels_impl.h"
+} // namespace sse2_kernels
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2,fma"))), \
+                             apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#pragma GCC optimize("tree-vectorize")
+#endif
+namespace avx2_kernels
+{
+#include "simd_kernels_impl.h"
+} // namespace avx2_kernels
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#if defined(__clang__)
+#pragma clang attribute push(                                      \
+    __attribute__((target("avx512f,avx512bw,avx512vl,avx512dq"))), \
+    apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512bw,avx512vl,avx512dq")
+#pragma GCC optimize("tree-vectorize")
+#endif
+namespace avx512_kernels
+{
+#include "simd_kernels_impl.h"
+} // namespace avx512_kernels
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#else
+
+namespace generic_kernels
+{
+#include "simd_kernels_impl.h"
+} // namespace generic_kernels
+
+#endif // GIW_SIMD_X86
+
+
+static SimdLevel detect_simd_level()
+{
+#ifdef GIW_SIMD_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512vl") &&
+        __builtin_cpu_supports("avx512dq")) {
+        return SimdLevel::AVX512;
+    } else if (__builtin_cpu_supports("avx2") &&
+               __builtin_cpu_supports("fma")) {
+        return SimdLevel::AVX2;
+    }
+    return SimdLevel::SSE2;
+#else
+    return SimdLevel::Generic;
+#endif
+}
+
+
+static SimdLevel select_simd_level()
+{
+    const SimdLevel supported_level = detect_simd_level();
+    SimdLevel level                 = supported_level;
+
+    const char* requested_name = getenv("GIW_SIMD_LEVEL");
+    if (requested_name != nullptr && requested_name[0] != '\0') {
+        bool is_known_level = false;
+        for (int i = static_cast<int>(SimdLevel::Generic);
+             i <= static_cast<int>(SimdLevel::AVX512);
+             ++i) {
+            const SimdLevel requested_level = static_cast<SimdLevel>(i);
+            if (strcmp(requested_name,
+                       get_simd_level_name(requested_level)) == 0) {
+                is_known_level = true;
+                level          = requested_level;
+            }
+        }
+
+        if (!is_known_level) {
+            cerr << "[gdb-imagewatch] Unknown GIW_SIMD_LEVEL "
+                 << requested_name << endl;
+            level = supported_level;
+        } else if (level > supported_level) {
+            cerr << "[gdb-imagewatch] GIW_SIMD_LEVEL " << requested_name
+                 << " is not supported by this CPU; using "
+                 << get_simd_level_name(supported_level) << endl;
+            level = supported_level;
+        }
+    }
+
+#ifdef GIW_SIMD_X86
+    // Generic kernels are not compiled on x86, where SSE2 is the baseline
+    if (level == SimdLevel::Generic) {
+        level = SimdLevel::SSE2;
+    }
+#endif
+
+    Metrics::set_gauge("simd_level", static_cast<int64_t>(level));
+
+    return level;
+}
+
+
+SimdLevel get_simd_level()
+{
+    static const SimdLevel level = select_simd_level();
+    return level;
+}
+
+
+const SimdKernels& get_simd_kernels()
+{
+    static const SimdKernels* const kernels = []() {
+#ifdef GIW_SIMD_X86
+        switch (get_simd_level()) {
+        case SimdLevel::AVX512:
+            return &avx512_kernels::kernels;
+        case SimdLevel::AVX2:
+            return &avx2_kernels::kernels;
+        default:
+            return &sse2_kernels::kernels;
+        }
+#else
+        return &generic_kernels::kernels;
+#endif
+    }();
+
+    return *kernels;
+}
+
+
+const char* get_simd_level_name(SimdLevel level)
+{
+    switch (level) {
+    case SimdLevel::SSE2:
+        return "sse2";
+    case SimdLevel::AVX2:
+        return "avx2";
+    case SimdLevel::AVX512:
+        return "avx512";
+    default:
+        return "generic";
+    }
+}
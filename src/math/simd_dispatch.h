@@ -0,0 +1,128 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef SIMD_DISPATCH_H_
+#define SIMD_DISPATCH_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "math/buffer_statistics.h"
+
+
+/**
+ * Instruction sets the pixel kernels are compiled for. Generic kernels are
+ * only used on non-x86 CPUs.
+ */
+enum class SimdLevel { Generic = 0, SSE2 = 1, AVX2 = 2, AVX512 = 3 };
+
+
+/**
+ * Pixel kernels compiled for one instruction set
+ */
+struct SimdKernels
+{
+    /**
+     * Lower lowest[c] and raise highest[c] to the min and max of channel c of
+     * the buffer. NaN values are ignored.
+     */
+    void (*min_max)(const BufferDescriptor& buffer,
+                    float* lowest,
+                    float* highest);
+
+    /**
+     * Convert count doubles to floats
+     */
+    void (*double_to_float)(const double* input, size_t count, float* output);
+
+    /**
+     * Convert each value v of channel c of the buffer to
+     * clamp(v * scale[c] + offset[c], 0, 255), in a dense output of
+     * width * height * channels bytes. NaN values are converted to 0.
+     */
+    void (*normalize_to_uint8)(const BufferDescriptor& buffer,
+                               const float* scale,
+                               const float* offset,
+                               uint8_t* output);
+
+    /**
+     * Shade count pixels of the software renderer, given as four planes of
+     * normalized values in output channel order (red, green, blue, alpha).
+     * Each channel c becomes clamp(planes[c][i] * scale[c] + offset[c] +
+     * borders[i] * border_scale[c], 0, 255), where borders may be null. The
+     * colors are then blended by their alpha over the gray levels in
+     * background, and packed as 0xffRRGGBB.
+     */
+    void (*shade_pixels)(const float* const* planes,
+                         const float* scale,
+                         const float* offset,
+                         const float* borders,
+                         const float* border_scale,
+                         const float* background,
+                         size_t count,
+                         uint32_t* output);
+
+    /**
+     * Pixels of a buffer of width x height pixels under the count points
+     * (x + i * delta_x, y + i * delta_y), given in pixels from the corner of
+     * its first pixel. Points out of the buffer are clamped to its edges.
+     */
+    void (*nearest_pixels)(float x,
+                           float y,
+                           float delta_x,
+                           float delta_y,
+                           int width,
+                           int height,
+                           size_t count,
+                           int* pixels_x,
+                           int* pixels_y);
+
+    /**
+     * Per channel statistics of the buffer, which must have 1 to 4 channels.
+     * statistics must be default-constructed; the min and max of channels
+     * without finite values are left untouched.
+     */
+    void (*scan_statistics)(const BufferDescriptor& buffer,
+                            BufferStatistics& statistics);
+};
+
+
+/**
+ * Kernels for the instruction set selected by get_simd_level()
+ */
+const SimdKernels& get_simd_kernels();
+
+
+/**
+ * Widest instruction set supported by the CPU, detected once with cpuid. The
+ * environment variable GIW_SIMD_LEVEL (generic, sse2, avx2 or avx512) can
+ * select a narrower one, e.g. for testing.
+ */
+SimdLevel get_simd_level();
+
+
+const char* get_simd_level_name(SimdLevel level);
+
+#endif // SIMD_DISPATCH_H_
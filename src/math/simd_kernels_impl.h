@@ -0,0 +1,519 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/*
+ * Pixel kernels of simd_dispatch.cpp. This file is included once per
+ * instruction set, in its own namespace and with the matching target options,
+ * so it has no include guard and must not include any header. The kernels
+ * are plain loops over blocks of values, which the compiler vectorizes for
+ * each target.
+ */
+
+// Values processed per block: a multiple of 1 to 4 channels, and of the lanes
+// of the widest vectors, so that lane j of a block always holds channel
+// j % channels
+static const int block_size = 48;
+
+
+template <typename T>
+static void min_max_row(const T* values,
+                        size_t count,
+                        int channels,
+                        float* lowest,
+                        float* highest)
+{
+    float block_lowest[block_size];
+    float block_highest[block_size];
+    for (int j = 0; j < block_size; ++j) {
+        block_lowest[j]  = lowest[j % channels];
+        block_highest[j] = highest[j % channels];
+    }
+
+    size_t i = 0;
+    for (; i + block_size <= count; i += block_size) {
+        for (int j = 0; j < block_size; ++j) {
+            const float value = static_cast<float>(values[i + j]);
+            block_lowest[j] = value < block_lowest[j] ? value : block_lowest[j];
+            block_highest[j] =
+                value > block_highest[j] ? value : block_highest[j];
+        }
+    }
+
+    for (int j = 0; j < block_size; ++j) {
+        const int c = j % channels;
+        lowest[c]   = block_lowest[j] < lowest[c] ? block_lowest[j] : lowest[c];
+        highest[c] =
+            block_highest[j] > highest[c] ? block_highest[j] : highest[c];
+    }
+
+    // Blocks end at a multiple of the number of channels
+    for (; i < count; ++i) {
+        const float value = static_cast<float>(values[i]);
+        const int c       = static_cast<int>(i % channels);
+        lowest[c]         = value < lowest[c] ? value : lowest[c];
+        highest[c]        = value > highest[c] ? value : highest[c];
+    }
+}
+
+
+template <typename T>
+static void min_max_rows(const BufferDescriptor& buffer,
+                         float* lowest,
+                         float* highest)
+{
+    const size_t row_count = static_cast<size_t>(buffer.width) *
+                             buffer.channels;
+    const size_t row_stride = static_cast<size_t>(buffer.step) *
+                              buffer.channels;
+    const T* values = reinterpret_cast<const T*>(buffer.data);
+
+    for (int y = 0; y < buffer.height; ++y) {
+        min_max_row(
+            values + y * row_stride, row_count, buffer.channels, lowest,
+            highest);
+    }
+}
+
+
+static void min_max(const BufferDescriptor& buffer,
+                    float* lowest,
+                    float* highest)
+{
+    if (buffer.channels < 1 || buffer.channels > 4) {
+        return;
+    }
+
+    switch (buffer.type) {
+    case Buffer::BufferType::UnsignedByte:
+        min_max_rows<uint8_t>(buffer, lowest, highest);
+        break;
+    case Buffer::BufferType::UnsignedShort:
+        min_max_rows<uint16_t>(buffer, lowest, highest);
+        break;
+    case Buffer::BufferType::Short:
+        min_max_rows<int16_t>(buffer, lowest, highest);
+        break;
+    case Buffer::BufferType::Int32:
+        min_max_rows<int32_t>(buffer, lowest, highest);
+        break;
+    case Buffer::BufferType::Float32:
+        min_max_rows<float>(buffer, lowest, highest);
+        break;
+    case Buffer::BufferType::Float64:
+        min_max_rows<double>(buffer, lowest, highest);
+        break;
+    }
+}
+
+
+static void double_to_float(const double* input, size_t count, float* output)
+{
+    for (size_t i = 0; i < count; ++i) {
+        output[i] = static_cast<float>(input[i]);
+    }
+}
+
+
+static inline uint8_t normalize_value(float value, float scale, float offset)
+{
+    value = value * scale + offset;
+    // Written so that NaN values become 0
+    value = value > 0.f ? value : 0.f;
+    value = value < 255.f ? value : 255.f;
+    return static_cast<uint8_t>(value);
+}
+
+
+template <typename T>
+static void normalize_rows(const BufferDescriptor& buffer,
+                           const float* scale,
+                           const float* offset,
+                           uint8_t* output)
+{
+    float block_scale[block_size];
+    float block_offset[block_size];
+    for (int j = 0; j < block_size; ++j) {
+        block_scale[j]  = scale[j % buffer.channels];
+        block_offset[j] = offset[j % buffer.channels];
+    }
+
+    const size_t row_count = static_cast<size_t>(buffer.width) *
+                             buffer.channels;
+    const size_t row_stride = static_cast<size_t>(buffer.step) *
+                              buffer.channels;
+
+    for (int y = 0; y < buffer.height; ++y) {
+        const T* values = reinterpret_cast<const T*>(buffer.data) +
+                          y * row_stride;
+        uint8_t* row_output = output + y * row_count;
+
+        size_t i = 0;
+        for (; i + block_size <= row_count; i += block_size) {
+            for (int j = 0; j < block_size; ++j) {
+                row_output[i + j] =
+                    normalize_value(static_cast<float>(values[i + j]),
+                                    block_scale[j],
+                                    block_offset[j]);
+            }
+        }
+
+        for (; i < row_count; ++i) {
+            const int c   = static_cast<int>(i % buffer.channels);
+            row_output[i] = normalize_value(
+                static_cast<float>(values[i]), scale[c], offset[c]);
+        }
+    }
+}
+
+
+static void normalize_to_uint8(const BufferDescriptor& buffer,
+                               const float* scale,
+                               const float* offset,
+                               uint8_t* output)
+{
+    if (buffer.channels < 1 || buffer.channels > 4) {
+        return;
+    }
+
+    switch (buffer.type) {
+    case Buffer::BufferType::UnsignedByte:
+        normalize_rows<uint8_t>(buffer, scale, offset, output);
+        break;
+    case Buffer::BufferType::UnsignedShort:
+        normalize_rows<uint16_t>(buffer, scale, offset, output);
+        break;
+    case Buffer::BufferType::Short:
+        normalize_rows<int16_t>(buffer, scale, offset, output);
+        break;
+    case Buffer::BufferType::Int32:
+        normalize_rows<int32_t>(buffer, scale, offset, output);
+        break;
+    case Buffer::BufferType::Float32:
+        normalize_rows<float>(buffer, scale, offset, output);
+        break;
+    case Buffer::BufferType::Float64:
+        normalize_rows<double>(buffer, scale, offset, output);
+        break;
+    }
+}
+
+
+static inline float clamp_channel(float value)
+{
+    // Written so that NaN values become 0
+    value = value > 0.f ? value : 0.f;
+    return value < 255.f ? value : 255.f;
+}
+
+
+template <bool WithBorders>
+static void shade_pixel_span(const float* const* planes,
+                             const float* scale,
+                             const float* offset,
+                             const float* borders,
+                             const float* border_scale,
+                             const float* background,
+                             size_t count,
+                             uint32_t* output)
+{
+    const float* red_plane   = planes[0];
+    const float* green_plane = planes[1];
+    const float* blue_plane  = planes[2];
+    const float* alpha_plane = planes[3];
+
+    for (size_t i = 0; i < count; ++i) {
+        float red   = red_plane[i] * scale[0] + offset[0];
+        float green = green_plane[i] * scale[1] + offset[1];
+        float blue  = blue_plane[i] * scale[2] + offset[2];
+        float alpha = alpha_plane[i] * scale[3] + offset[3];
+
+        if (WithBorders) {
+            red += borders[i] * border_scale[0];
+            green += borders[i] * border_scale[1];
+            blue += borders[i] * border_scale[2];
+            alpha += borders[i] * border_scale[3];
+        }
+
+        red   = clamp_channel(red);
+        green = clamp_channel(green);
+        blue  = clamp_channel(blue);
+        alpha = clamp_channel(alpha) / 255.f;
+
+        const float background_weight = (1.f - alpha) * background[i];
+
+        red   = red * alpha + background_weight + 0.5f;
+        green = green * alpha + background_weight + 0.5f;
+        blue  = blue * alpha + background_weight + 0.5f;
+
+        output[i] = 0xff000000u |
+                    static_cast<uint32_t>(static_cast<int32_t>(red)) << 16 |
+                    static_cast<uint32_t>(static_cast<int32_t>(green)) << 8 |
+                    static_cast<uint32_t>(static_cast<int32_t>(blue));
+    }
+}
+
+
+static void shade_pixels(const float* const* planes,
+                         const float* scale,
+                         const float* offset,
+                         const float* borders,
+                         const float* border_scale,
+                         const float* background,
+                         size_t count,
+                         uint32_t* output)
+{
+    if (borders != nullptr) {
+        shade_pixel_span<true>(planes,
+                               scale,
+                               offset,
+                               borders,
+                               border_scale,
+                               background,
+                               count,
+                               output);
+    } else {
+        shade_pixel_span<false>(planes,
+                                scale,
+                                offset,
+                                borders,
+                                border_scale,
+                                background,
+                                count,
+                                output);
+    }
+}
+
+
+static void nearest_pixels(float x,
+                           float y,
+                           float delta_x,
+                           float delta_y,
+                           int width,
+                           int height,
+                           size_t count,
+                           int* pixels_x,
+                           int* pixels_y)
+{
+    for (size_t i = 0; i < count; ++i) {
+        // Converted through int32_t, which vectorizes better than size_t
+        const float position = static_cast<float>(static_cast<int32_t>(i));
+        const int pixel_x    = static_cast<int>(x + position * delta_x);
+        const int pixel_y    = static_cast<int>(y + position * delta_y);
+
+        pixels_x[i] =
+            pixel_x > 0 ? (pixel_x < width ? pixel_x : width - 1) : 0;
+        pixels_y[i] =
+            pixel_y > 0 ? (pixel_y < height ? pixel_y : height - 1) : 0;
+    }
+}
+
+
+template <typename T>
+struct ScanSum
+{
+    typedef int64_t type;
+};
+
+
+template <>
+struct ScanSum<float>
+{
+    typedef double type;
+};
+
+
+template <>
+struct ScanSum<double>
+{
+    typedef double type;
+};
+
+
+template <typename T>
+static inline bool is_finite_value(T)
+{
+    return true;
+}
+
+
+template <>
+inline bool is_finite_value(float value)
+{
+    // False for both infinities and NaN, and cheaper to vectorize than
+    // std::isfinite
+    return value - value == 0.0f;
+}
+
+
+template <>
+inline bool is_finite_value(double value)
+{
+    return value - value == 0.0;
+}
+
+
+/**
+ * Partial statistics of the values of a buffer, one per lane of a block (see
+ * block_size)
+ */
+template <typename T>
+struct ScanLanes
+{
+    T lowest[block_size];
+    T highest[block_size];
+    typename ScanSum<T>::type sum[block_size];
+    uint64_t count[block_size];
+    uint64_t nan_count[block_size];
+};
+
+
+template <typename T>
+static inline void scan_value(T value, int lane, ScanLanes<T>& lanes)
+{
+    typedef typename ScanSum<T>::type Sum;
+
+    // Selects on masks combined with & instead of branches, so that the loop
+    // over a block of lanes is vectorized
+    const bool finite = is_finite_value(value);
+    const bool lower  = finite & (value < lanes.lowest[lane]);
+    const bool higher = finite & (value > lanes.highest[lane]);
+
+    lanes.lowest[lane]  = lower ? value : lanes.lowest[lane];
+    lanes.highest[lane] = higher ? value : lanes.highest[lane];
+
+    // Tested again on the widened value, since SSE2 cannot select doubles
+    // with the mask of a float comparison
+    const Sum wide_value = static_cast<Sum>(value);
+    lanes.sum[lane] += is_finite_value(wide_value) ? wide_value : Sum(0);
+    lanes.count[lane] += finite;
+    lanes.nan_count[lane] += value != value;
+}
+
+
+template <typename T>
+static void scan_rows(const BufferDescriptor& buffer,
+                      BufferStatistics& statistics)
+{
+    typedef typename ScanSum<T>::type Sum;
+
+    const int channels = buffer.channels;
+
+    // Each lane has its own partial sums, so that floating point values are
+    // added in the same order whether the block is vectorized or not
+    ScanLanes<T> lanes;
+    for (int j = 0; j < block_size; ++j) {
+        lanes.lowest[j]    = std::numeric_limits<T>::max();
+        lanes.highest[j]   = std::numeric_limits<T>::lowest();
+        lanes.sum[j]       = 0;
+        lanes.count[j]     = 0;
+        lanes.nan_count[j] = 0;
+    }
+
+    const size_t row_count = static_cast<size_t>(buffer.width) * channels;
+    const size_t row_stride = static_cast<size_t>(buffer.step) * channels;
+    const T* values = reinterpret_cast<const T*>(buffer.data);
+
+    for (int y = 0; y < buffer.height; ++y) {
+        const T* row = values + y * row_stride;
+
+        size_t i = 0;
+        for (; i + block_size <= row_count; i += block_size) {
+            for (int j = 0; j < block_size; ++j) {
+                scan_value(row[i + j], j, lanes);
+            }
+        }
+
+        // Blocks end at a multiple of the number of channels, so lane c
+        // holds channel c
+        for (; i < row_count; ++i) {
+            scan_value(row[i], static_cast<int>(i % channels), lanes);
+        }
+    }
+
+    Sum sum[BufferStatistics::max_channels] = {0, 0, 0, 0};
+    for (int j = 0; j < block_size; ++j) {
+        const int c = j % channels;
+
+        if (lanes.count[j] > 0) {
+            const double lowest  = static_cast<double>(lanes.lowest[j]);
+            const double highest = static_cast<double>(lanes.highest[j]);
+            statistics.min[c] =
+                lowest < statistics.min[c] ? lowest : statistics.min[c];
+            statistics.max[c] =
+                highest > statistics.max[c] ? highest : statistics.max[c];
+        }
+        sum[c] += lanes.sum[j];
+        statistics.count[c] += lanes.count[j];
+        statistics.nan_count[c] += lanes.nan_count[j];
+    }
+
+    const uint64_t num_values =
+        static_cast<uint64_t>(buffer.height) * buffer.width;
+
+    statistics.channels = channels;
+    for (int c = 0; c < channels; ++c) {
+        statistics.sum[c] = static_cast<double>(sum[c]);
+        statistics.inf_count[c] =
+            num_values - statistics.count[c] - statistics.nan_count[c];
+    }
+}
+
+
+static void scan_statistics(const BufferDescriptor& buffer,
+                            BufferStatistics& statistics)
+{
+    if (buffer.channels < 1 || buffer.channels > 4) {
+        return;
+    }
+
+    switch (buffer.type) {
+    case Buffer::BufferType::UnsignedByte:
+        scan_rows<uint8_t>(buffer, statistics);
+        break;
+    case Buffer::BufferType::UnsignedShort:
+        scan_rows<uint16_t>(buffer, statistics);
+        break;
+    case Buffer::BufferType::Short:
+        scan_rows<int16_t>(buffer, statistics);
+        break;
+    case Buffer::BufferType::Int32:
+        scan_rows<int32_t>(buffer, statistics);
+        break;
+    case Buffer::BufferType::Float32:
+        scan_rows<float>(buffer, statistics);
+        break;
+    case Buffer::BufferType::Float64:
+        scan_rows<double>(buffer, statistics);
+        break;
+    }
+}
+
+
+static const SimdKernels kernels = {min_max,
+                                    double_to_float,
+                                    normalize_to_uint8,
+                                    shade_pixels,
+                                    nearest_pixels,
+                                    scan_statistics};
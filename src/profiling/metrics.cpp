@@ -0,0 +1,263 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#include "metrics.h"
+
+
+using namespace std;
+
+
+struct MetricsRegistry
+{
+    mutex registry_mutex;
+    Metrics::Snapshot data;
+    vector<Metrics::LatencySlot*> latency_slots;
+};
+
+
+static MetricsRegistry& get_metrics_registry()
+{
+    // Never destroyed, for the same reason as the trace registry
+    static MetricsRegistry* registry = new MetricsRegistry();
+    return *registry;
+}
+
+
+Metrics::Histogram::Histogram()
+    : count(0)
+    , sum(0)
+    , min(0)
+    , max(0)
+{
+    fill(buckets, buckets + num_buckets, 0);
+}
+
+
+void Metrics::Histogram::add(uint64_t value)
+{
+    min = (count == 0) ? value : std::min(min, value);
+    max = (count == 0) ? value : std::max(max, value);
+    ++count;
+    sum += value;
+    ++buckets[get_bucket(value)];
+}
+
+
+void Metrics::Histogram::merge(const Histogram& other)
+{
+    if (other.count == 0) {
+        return;
+    }
+
+    min = (count == 0) ? other.min : std::min(min, other.min);
+    max = (count == 0) ? other.max : std::max(max, other.max);
+    count += other.count;
+    sum += other.sum;
+    for (int bucket = 0; bucket < num_buckets; ++bucket) {
+        buckets[bucket] += other.buckets[bucket];
+    }
+}
+
+
+int Metrics::Histogram::get_bucket(uint64_t value)
+{
+    int bucket = 0;
+    while (bucket < num_buckets - 1 && (value >> bucket) != 0) {
+        ++bucket;
+    }
+
+    return bucket;
+}
+
+
+uint64_t Metrics::Histogram::quantile(double q) const
+{
+    const uint64_t target = static_cast<uint64_t>(q * count);
+    uint64_t accumulated  = 0;
+
+    for (int bucket = 0; bucket < num_buckets; ++bucket) {
+        accumulated += buckets[bucket];
+        if (accumulated > target) {
+            const uint64_t upper_bound =
+                (bucket == 0) ? 0 : (uint64_t(1) << bucket) - 1;
+            return std::min(upper_bound, max);
+        }
+    }
+
+    return max;
+}
+
+
+void Metrics::add_to_counter(const char* name, uint64_t value)
+{
+    MetricsRegistry& registry = get_metrics_registry();
+    unique_lock<mutex> lock(registry.registry_mutex);
+    registry.data.counters[name] += value;
+}
+
+
+void Metrics::set_gauge(const char* name, int64_t value)
+{
+    MetricsRegistry& registry = get_metrics_registry();
+    unique_lock<mutex> lock(registry.registry_mutex);
+    registry.data.gauges[name] = value;
+}
+
+
+void Metrics::record_latency(const string& stage, uint64_t duration_us)
+{
+    MetricsRegistry& registry = get_metrics_registry();
+    unique_lock<mutex> lock(registry.registry_mutex);
+    registry.data.latencies_us[stage].add(duration_us);
+}
+
+
+Metrics::LatencySlot::LatencySlot(const char* stage)
+    : stage_(stage)
+    , count_(0)
+    , sum_(0)
+    , min_(numeric_limits<uint64_t>::max())
+    , max_(0)
+{
+    for (auto& bucket : buckets_) {
+        bucket.store(0, memory_order_relaxed);
+    }
+}
+
+
+void Metrics::LatencySlot::add(uint64_t duration_us)
+{
+    uint64_t lowest = min_.load(memory_order_relaxed);
+    while (duration_us < lowest &&
+           !min_.compare_exchange_weak(
+               lowest, duration_us, memory_order_relaxed)) {
+    }
+
+    uint64_t highest = max_.load(memory_order_relaxed);
+    while (duration_us > highest &&
+           !max_.compare_exchange_weak(
+               highest, duration_us, memory_order_relaxed)) {
+    }
+
+    buckets_[Histogram::get_bucket(duration_us)].fetch_add(
+        1, memory_order_relaxed);
+    sum_.fetch_add(duration_us, memory_order_relaxed);
+    count_.fetch_add(1, memory_order_relaxed);
+}
+
+
+Metrics::Histogram Metrics::LatencySlot::load() const
+{
+    // Samples being added concurrently may be partially counted
+    Histogram histogram;
+    histogram.count = count_.load(memory_order_relaxed);
+    histogram.sum   = sum_.load(memory_order_relaxed);
+    histogram.min   = min_.load(memory_order_relaxed);
+    histogram.max   = max_.load(memory_order_relaxed);
+    for (int bucket = 0; bucket < Histogram::num_buckets; ++bucket) {
+        histogram.buckets[bucket] =
+            buckets_[bucket].load(memory_order_relaxed);
+    }
+
+    return histogram;
+}
+
+
+Metrics::LatencySlot& Metrics::register_latency_slot(const char* stage)
+{
+    MetricsRegistry& registry = get_metrics_registry();
+    unique_lock<mutex> lock(registry.registry_mutex);
+
+    // Never destroyed, so that scopes still running at exit can use it
+    LatencySlot* slot = new LatencySlot(stage);
+    registry.latency_slots.push_back(slot);
+
+    return *slot;
+}
+
+
+void Metrics::record_sample(const char* name, uint64_t value)
+{
+    MetricsRegistry& registry = get_metrics_registry();
+    unique_lock<mutex> lock(registry.registry_mutex);
+    registry.data.histograms[name].add(value);
+}
+
+
+void Metrics::record_cache_access(const char* cache, bool hit)
+{
+    MetricsRegistry& registry = get_metrics_registry();
+    unique_lock<mutex> lock(registry.registry_mutex);
+
+    CacheStats& stats = registry.data.caches[cache];
+    if (hit) {
+        ++stats.hits;
+    } else {
+        ++stats.misses;
+    }
+}
+
+
+void Metrics::set_buffer_memory(const string& buffer_name,
+                                uint64_t host_bytes,
+                                uint64_t gpu_bytes)
+{
+    MetricsRegistry& registry = get_metrics_registry();
+    unique_lock<mutex> lock(registry.registry_mutex);
+
+    BufferMemory& memory = registry.data.buffers[buffer_name];
+    memory.host_bytes    = host_bytes;
+    memory.gpu_bytes     = gpu_bytes;
+}
+
+
+void Metrics::remove_buffer_memory(const string& buffer_name)
+{
+    MetricsRegistry& registry = get_metrics_registry();
+    unique_lock<mutex> lock(registry.registry_mutex);
+    registry.data.buffers.erase(buffer_name);
+}
+
+
+Metrics::Snapshot Metrics::snapshot()
+{
+    MetricsRegistry& registry = get_metrics_registry();
+    unique_lock<mutex> lock(registry.registry_mutex);
+
+    Snapshot snapshot = registry.data;
+    for (const LatencySlot* slot : registry.latency_slots) {
+        const Histogram latencies = slot->load();
+        if (latencies.count > 0) {
+            snapshot.latencies_us[slot->stage_].merge(latencies);
+        }
+    }
+
+    return snapshot;
+}
@@ -0,0 +1,149 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef METRICS_H_
+#define METRICS_H_
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <string>
+
+
+/**
+ * Counters and histograms describing the plot pipeline, kept for the whole
+ * debugging session and exposed through giw_get_metrics().
+ *
+ * All methods may be called from any thread.
+ */
+class Metrics
+{
+  public:
+    /**
+     * Distribution of a non-negative quantity. Bucket i counts the samples
+     * in [2^(i-1), 2^i), bucket 0 counts zeros.
+     */
+    struct Histogram
+    {
+        static const int num_buckets = 40;
+
+        uint64_t count;
+        uint64_t sum;
+        uint64_t min;
+        uint64_t max;
+        uint64_t buckets[num_buckets];
+
+        Histogram();
+
+        void add(uint64_t value);
+
+        /**
+         * Add the samples of other
+         */
+        void merge(const Histogram& other);
+
+        /**
+         * Upper bound of the bucket containing the given quantile (in [0, 1])
+         */
+        uint64_t quantile(double q) const;
+
+        static int get_bucket(uint64_t value);
+    };
+
+    /**
+     * Latencies of a pipeline stage recorded from a single call site, without
+     * locks nor allocations (see GIW_TRACE_SCOPE). Slots are never destroyed;
+     * snapshot() merges them into the latencies of their stage.
+     */
+    class LatencySlot
+    {
+      public:
+        void add(uint64_t duration_us);
+
+      private:
+        friend class Metrics;
+
+        explicit LatencySlot(const char* stage);
+
+        const char* stage_;
+        std::atomic<uint64_t> count_;
+        std::atomic<uint64_t> sum_;
+        std::atomic<uint64_t> min_;
+        std::atomic<uint64_t> max_;
+        std::atomic<uint64_t> buckets_[Histogram::num_buckets];
+
+        Histogram load() const;
+    };
+
+    struct CacheStats
+    {
+        uint64_t hits;
+        uint64_t misses;
+    };
+
+    struct BufferMemory
+    {
+        uint64_t host_bytes;
+        uint64_t gpu_bytes;
+    };
+
+    struct Snapshot
+    {
+        std::map<std::string, uint64_t> counters;
+        std::map<std::string, int64_t> gauges;
+        std::map<std::string, Histogram> latencies_us;
+        std::map<std::string, Histogram> histograms;
+        std::map<std::string, CacheStats> caches;
+        std::map<std::string, BufferMemory> buffers;
+    };
+
+    static void add_to_counter(const char* name, uint64_t value);
+
+    static void set_gauge(const char* name, int64_t value);
+
+    /**
+     * Record the duration of a pipeline stage (see TraceScope)
+     */
+    static void record_latency(const std::string& stage, uint64_t duration_us);
+
+    /**
+     * Slot recording the latencies of a stage whose name is a string literal
+     */
+    static LatencySlot& register_latency_slot(const char* stage);
+
+    static void record_sample(const char* name, uint64_t value);
+
+    static void record_cache_access(const char* cache, bool hit);
+
+    static void set_buffer_memory(const std::string& buffer_name,
+                                  uint64_t host_bytes,
+                                  uint64_t gpu_bytes);
+
+    static void remove_buffer_memory(const std::string& buffer_name);
+
+    static Snapshot snapshot();
+};
+
+#endif // METRICS_H_
@@ -0,0 +1,288 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "metrics.h"
+#include "tracer.h"
+
+
+using namespace std;
+
+
+struct TraceEvent
+{
+    const char* name;
+    uint64_t begin_us;
+    uint64_t duration_us;
+};
+
+
+/**
+ * Single producer (the owning thread), single consumer (Tracer::flush, which
+ * is serialized by the registry mutex) ring of trace events. Events recorded
+ * while the ring is full are dropped and counted.
+ */
+struct ThreadTraceBuffer
+{
+    static const size_t capacity = 1 << 15;
+
+    long thread_id;
+    string thread_name;
+
+    atomic<size_t> written;
+    atomic<size_t> consumed;
+    atomic<size_t> dropped;
+
+    TraceEvent events[capacity];
+
+    ThreadTraceBuffer()
+        : thread_id(syscall(SYS_gettid))
+        , written(0)
+        , consumed(0)
+        , dropped(0)
+    {
+    }
+};
+
+
+struct TraceRegistry
+{
+    mutex registry_mutex;
+    vector<ThreadTraceBuffer*> buffers;
+    set<string> interned_names;
+};
+
+
+atomic<bool> Tracer::enabled_(false);
+
+
+static thread_local ThreadTraceBuffer* local_trace_buffer = nullptr;
+
+
+static TraceRegistry& get_trace_registry()
+{
+    // Never destroyed: threads owned by the debugger may still record spans
+    // while the library is being unloaded
+    static TraceRegistry* registry = new TraceRegistry();
+    return *registry;
+}
+
+
+static ThreadTraceBuffer* get_thread_trace_buffer()
+{
+    if (local_trace_buffer == nullptr) {
+        // Buffers are kept alive after their threads finish so that their
+        // events can still be flushed
+        local_trace_buffer = new ThreadTraceBuffer();
+
+        TraceRegistry& registry = get_trace_registry();
+        unique_lock<mutex> lock(registry.registry_mutex);
+        registry.buffers.push_back(local_trace_buffer);
+    }
+
+    return local_trace_buffer;
+}
+
+
+static void write_json_string(FILE* output, const char* str)
+{
+    fputc('"', output);
+    for (const char* c = str; *c != '\0'; ++c) {
+        if (*c == '"' || *c == '\\') {
+            fputc('\\', output);
+            fputc(*c, output);
+        } else if (static_cast<unsigned char>(*c) < 0x20) {
+            fprintf(output, "\\u%04x", static_cast<unsigned char>(*c));
+        } else {
+            fputc(*c, output);
+        }
+    }
+    fputc('"', output);
+}
+
+
+void Tracer::set_enabled(bool enabled)
+{
+    enabled_.store(enabled, memory_order_relaxed);
+}
+
+
+uint64_t Tracer::now_us()
+{
+    return chrono::duration_cast<chrono::microseconds>(
+               chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+
+void Tracer::set_thread_name(const string& name)
+{
+    ThreadTraceBuffer* buffer = get_thread_trace_buffer();
+
+    TraceRegistry& registry = get_trace_registry();
+    unique_lock<mutex> lock(registry.registry_mutex);
+    buffer->thread_name = name;
+}
+
+
+void Tracer::record_span(const char* name, uint64_t begin_us, uint64_t end_us)
+{
+    if (!is_enabled()) {
+        return;
+    }
+
+    ThreadTraceBuffer* buffer = get_thread_trace_buffer();
+
+    const size_t written = buffer->written.load(memory_order_relaxed);
+    if (written - buffer->consumed.load(memory_order_acquire) >=
+        ThreadTraceBuffer::capacity) {
+        buffer->dropped.fetch_add(1, memory_order_relaxed);
+        return;
+    }
+
+    TraceEvent& event = buffer->events[written % ThreadTraceBuffer::capacity];
+    event.name        = name;
+    event.begin_us    = begin_us;
+    event.duration_us = end_us > begin_us ? end_us - begin_us : 0;
+
+    buffer->written.store(written + 1, memory_order_release);
+}
+
+
+void Tracer::record_dynamic_span(const string& name,
+                                 uint64_t begin_us,
+                                 uint64_t end_us)
+{
+    if (!is_enabled()) {
+        return;
+    }
+
+    const char* interned_name;
+    {
+        TraceRegistry& registry = get_trace_registry();
+        unique_lock<mutex> lock(registry.registry_mutex);
+        interned_name = registry.interned_names.insert(name).first->c_str();
+    }
+
+    record_span(interned_name, begin_us, end_us);
+}
+
+
+bool Tracer::flush(const string& path)
+{
+    TraceRegistry& registry = get_trace_registry();
+    unique_lock<mutex> lock(registry.registry_mutex);
+
+    FILE* output = fopen(path.c_str(), "w");
+    if (output == nullptr) {
+        return false;
+    }
+
+    const long process_id = getpid();
+    bool is_first_event   = true;
+
+    const auto begin_event = [&]() {
+        fputs(is_first_event ? "\n" : ",\n", output);
+        is_first_event = false;
+    };
+
+    fputs("{\"traceEvents\":[", output);
+
+    for (ThreadTraceBuffer* buffer : registry.buffers) {
+        if (!buffer->thread_name.empty()) {
+            begin_event();
+            fprintf(output,
+                    "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%ld,"
+                    "\"tid\":%ld,\"args\":{\"name\":",
+                    process_id,
+                    buffer->thread_id);
+            write_json_string(output, buffer->thread_name.c_str());
+            fputs("}}", output);
+        }
+
+        const size_t first = buffer->consumed.load(memory_order_relaxed);
+        const size_t last  = buffer->written.load(memory_order_acquire);
+
+        for (size_t i = first; i < last; ++i) {
+            const TraceEvent& event =
+                buffer->events[i % ThreadTraceBuffer::capacity];
+
+            begin_event();
+            fputs("{\"name\":", output);
+            write_json_string(output, event.name);
+            fprintf(output,
+                    ",\"cat\":\"giw\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%llu,"
+                    "\"pid\":%ld,\"tid\":%ld}",
+                    static_cast<unsigned long long>(event.begin_us),
+                    static_cast<unsigned long long>(event.duration_us),
+                    process_id,
+                    buffer->thread_id);
+        }
+
+        buffer->consumed.store(last, memory_order_release);
+
+        const size_t dropped = buffer->dropped.exchange(0);
+        if (dropped > 0) {
+            begin_event();
+            fprintf(output,
+                    "{\"name\":\"dropped_events\",\"cat\":\"giw\","
+                    "\"ph\":\"i\",\"s\":\"t\",\"ts\":%llu,\"pid\":%ld,"
+                    "\"tid\":%ld,\"args\":{\"count\":%zu}}",
+                    static_cast<unsigned long long>(now_us()),
+                    process_id,
+                    buffer->thread_id,
+                    dropped);
+        }
+    }
+
+    fputs("\n],\"displayTimeUnit\":\"ms\"}\n", output);
+
+    return fclose(output) == 0;
+}
+
+
+TraceScope::TraceScope(const char* name, Metrics::LatencySlot& latencies)
+    : name_(name)
+    , latencies_(latencies)
+    , begin_us_(Tracer::now_us())
+{
+}
+
+
+TraceScope::~TraceScope()
+{
+    const uint64_t end_us = Tracer::now_us();
+
+    latencies_.add(end_us - begin_us_);
+    Tracer::record_span(name_, begin_us_, end_us);
+}
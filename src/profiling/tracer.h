@@ -0,0 +1,126 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef TRACER_H_
+#define TRACER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "metrics.h"
+
+
+/**
+ * Collects timed spans from every thread that touches the plot pipeline and
+ * writes them as Chrome trace-event JSON (loadable in chrome://tracing or
+ * Perfetto).
+ *
+ * Each thread appends to its own single-producer ring, so recording a span
+ * never takes a lock. Tracing is disabled by default, in which case recording
+ * costs a single relaxed atomic load.
+ */
+class Tracer
+{
+  public:
+    static void set_enabled(bool enabled);
+
+    static bool is_enabled()
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Microseconds on the monotonic clock. Matches Python's
+     * time.monotonic(), so spans recorded by the debugger scripts line up
+     * with the native ones.
+     */
+    static uint64_t now_us();
+
+    static void set_thread_name(const std::string& name);
+
+    /**
+     * Record a span with a static name (string literals only: the pointer is
+     * kept until the next flush)
+     */
+    static void
+    record_span(const char* name, uint64_t begin_us, uint64_t end_us);
+
+    /**
+     * Record a span whose name is not a string literal (e.g. received from
+     * Python). The name is interned, which takes a lock.
+     */
+    static void record_dynamic_span(const std::string& name,
+                                    uint64_t begin_us,
+                                    uint64_t end_us);
+
+    /**
+     * Write all spans recorded since the last flush to path. The consumed
+     * spans are released.
+     *
+     * @return  true if the file was written
+     */
+    static bool flush(const std::string& path);
+
+  private:
+    static std::atomic<bool> enabled_;
+};
+
+
+/**
+ * Times the enclosing scope. The duration is always added to the stage
+ * latency metrics, through a slot of the call site which takes no lock (see
+ * Metrics::LatencySlot); a trace span is recorded only while tracing is
+ * enabled.
+ */
+class TraceScope
+{
+  public:
+    TraceScope(const char* name, Metrics::LatencySlot& latencies);
+
+    ~TraceScope();
+
+    TraceScope(const TraceScope&) = delete;
+
+    TraceScope& operator=(const TraceScope&) = delete;
+
+  private:
+    const char* name_;
+    Metrics::LatencySlot& latencies_;
+    uint64_t begin_us_;
+};
+
+
+#define GIW_TRACE_CONCAT_IMPL(a, b) a##b
+#define GIW_TRACE_CONCAT(a, b) GIW_TRACE_CONCAT_IMPL(a, b)
+
+#define GIW_TRACE_SCOPE(name)                                          \
+    static Metrics::LatencySlot& GIW_TRACE_CONCAT(giw_trace_latencies_, \
+                                                  __LINE__) =           \
+        Metrics::register_latency_slot(name);                          \
+    TraceScope GIW_TRACE_CONCAT(giw_trace_scope_, __LINE__)(            \
+        name, GIW_TRACE_CONCAT(giw_trace_latencies_, __LINE__))
+
+#endif // TRACER_H_
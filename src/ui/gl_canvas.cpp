@@ -23,12 +23,20 @@
  * IN THE SOFTWARE.
  */
 
+#include <cstring>
+
+#include <QPainter>
+
 #include "gl_canvas.h"
 
 #include "main_window/main_window.h"
+#include "profiling/metrics.h"
+#include "profiling/tracer.h"
 #include "ui/gl_text_renderer.h"
+#include "ui/gl_texture_pool.h"
 #include "visualization/components/camera.h"
 #include "visualization/game_object.h"
+#include "visualization/software_renderer.h"
 
 
 using namespace std;
@@ -40,7 +48,11 @@ GLCanvas::GLCanvas(QWidget* parent)
     , mouse_x_(0)
     , mouse_y_(0)
     , initialized_(false)
+    , last_paint_us_(0)
+    , requested_renderer_(Renderer::Auto)
+    , software_rendering_(false)
     , text_renderer_(new GLTextRenderer(this))
+    , texture_pool_(new GLTexturePool(this))
 {
     mouse_down_[0] = mouse_down_[1] = false;
 }
@@ -91,6 +103,8 @@ void GLCanvas::mouseReleaseEvent(QMouseEvent* ev)
 
 void GLCanvas::initializeGL()
 {
+    GIW_TRACE_SCOPE("gl_initialization");
+
     this->makeCurrent();
     initializeOpenGLFunctions();
 
@@ -142,6 +156,8 @@ void GLCanvas::initializeGL()
 
     glBindFramebuffer(GL_FRAMEBUFFER_EXT, 0);
 
+    select_renderer(status == GL_FRAMEBUFFER_COMPLETE);
+
     // Initialize text renderer
     text_renderer_->initialize();
 
@@ -151,8 +167,86 @@ void GLCanvas::initializeGL()
 
 void GLCanvas::paintGL()
 {
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    GIW_TRACE_SCOPE("paint");
+
+    // Only consecutive frames (e.g. while panning) tell anything about the
+    // frame rate; the canvas is not repainted while idle
+    const uint64_t paint_us = Tracer::now_us();
+    if (last_paint_us_ != 0 && paint_us - last_paint_us_ < 1000000) {
+        Metrics::record_sample("frame_interval_us", paint_us - last_paint_us_);
+    }
+    last_paint_us_ = paint_us;
+
+    if (!software_rendering_) {
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        main_window_->draw();
+        return;
+    }
+
+    if (software_frame_.width() != width() ||
+        software_frame_.height() != height()) {
+        software_frame_ = QImage(width(), height(), QImage::Format_RGB32);
+    }
+
+    // Same color as glClearColor, shown when no buffer is selected
+    software_frame_.fill(qRgb(26, 26, 26));
     main_window_->draw();
+
+    QPainter painter(this);
+    painter.drawImage(0, 0, software_frame_);
+}
+
+
+void GLCanvas::select_renderer(bool fbo_supported)
+{
+    const char* gl_renderer =
+        reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+    if (gl_renderer == nullptr) {
+        gl_renderer = "";
+    }
+
+    // Renderer strings of the Mesa software rasterizers
+    const char* software_rasterizers[] = {
+        "llvmpipe", "softpipe", "Software Rasterizer", "SWR"};
+
+    bool software_rasterizer = false;
+    for (const char* rasterizer : software_rasterizers) {
+        if (strstr(gl_renderer, rasterizer) != nullptr) {
+            software_rasterizer = true;
+        }
+    }
+
+    // Buffers are uploaded as float textures
+    const bool float_textures_supported =
+        context()->format().majorVersion() >= 3 ||
+        context()->hasExtension("GL_ARB_texture_float");
+
+    switch (requested_renderer_) {
+    case Renderer::OpenGL:
+        software_rendering_ = false;
+        break;
+    case Renderer::Software:
+        software_rendering_ = true;
+        break;
+    case Renderer::Auto:
+        software_rendering_ = software_rasterizer || !fbo_supported ||
+                              !float_textures_supported;
+        break;
+    }
+
+    Metrics::set_gauge("software_rendering", software_rendering_ ? 1 : 0);
+}
+
+
+void GLCanvas::set_requested_renderer(Renderer renderer)
+{
+    requested_renderer_ = renderer;
+}
+
+
+QImage& GLCanvas::get_software_frame()
+{
+    return software_frame_;
 }
 
 
@@ -168,11 +262,15 @@ const GLTextRenderer* GLCanvas::get_text_renderer()
 }
 
 
-void GLCanvas::render_buffer_icon(Stage* stage, int icon_width, int icon_height)
+GLTexturePool* GLCanvas::get_texture_pool()
 {
-    glBindFramebuffer(GL_FRAMEBUFFER_EXT, icon_fbo_);
+    return texture_pool_.get();
+}
 
-    glViewport(0, 0, icon_width, icon_height);
+
+void GLCanvas::render_buffer_icon(Stage* stage, int icon_width, int icon_height)
+{
+    GIW_TRACE_SCOPE("icon_render");
 
     GameObject* camera = stage->get_game_object("camera");
     Camera* cam        = camera->get_component<Camera>("camera_component");
@@ -182,26 +280,50 @@ void GLCanvas::render_buffer_icon(Stage* stage, int icon_width, int icon_height)
 
     // Adapt camera to the thumbnail dimentions
     cam->window_resized(icon_width, icon_height);
-    // Flips the projected image along the horizontal axis
-    cam->projection.set_ortho_projection(
-        icon_width / 2.0, -icon_height / 2.0, -1.0f, 1.0f);
-    // Reposition buffer in the center of the canvas
-    cam->recenter_camera();
 
-    stage->draw();
     stage->buffer_icon.resize(3 * icon_width * icon_height);
-    glPixelStorei(GL_PACK_ALIGNMENT, 1);
-    glReadPixels(0,
-                 0,
-                 icon_width,
-                 icon_height,
-                 GL_RGB,
-                 GL_UNSIGNED_BYTE,
-                 stage->buffer_icon.data());
+
+    if (software_rendering_) {
+        // Rendered from the top row, so that the projection is not flipped
+        cam->recenter_camera();
+
+        QImage icon(icon_width, icon_height, QImage::Format_RGB32);
+        SoftwareRenderer::render(stage, icon);
+
+        uint8_t* icon_pixel = stage->buffer_icon.data();
+        for (int y = 0; y < icon_height; ++y) {
+            const QRgb* row = reinterpret_cast<const QRgb*>(icon.scanLine(y));
+            for (int x = 0; x < icon_width; ++x) {
+                *icon_pixel++ = qRed(row[x]);
+                *icon_pixel++ = qGreen(row[x]);
+                *icon_pixel++ = qBlue(row[x]);
+            }
+        }
+    } else {
+        glBindFramebuffer(GL_FRAMEBUFFER_EXT, icon_fbo_);
+        glViewport(0, 0, icon_width, icon_height);
+
+        // Flips the projected image along the horizontal axis
+        cam->projection.set_ortho_projection(
+            icon_width / 2.0, -icon_height / 2.0, -1.0f, 1.0f);
+        // Reposition buffer in the center of the canvas
+        cam->recenter_camera();
+
+        stage->draw();
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glReadPixels(0,
+                     0,
+                     icon_width,
+                     icon_height,
+                     GL_RGB,
+                     GL_UNSIGNED_BYTE,
+                     stage->buffer_icon.data());
+
+        glBindFramebuffer(GL_FRAMEBUFFER_EXT, 0);
+        glViewport(0, 0, width(), height());
+    }
 
     // Reset stage camera
-    glBindFramebuffer(GL_FRAMEBUFFER_EXT, 0);
-    glViewport(0, 0, width(), height());
     *cam = original_pose;
     cam->window_resized(width(), height());
 }
@@ -26,8 +26,10 @@
 #ifndef GL_CANVAS_H_
 #define GL_CANVAS_H_
 
+#include <cstdint>
 #include <memory>
 
+#include <QImage>
 #include <QMouseEvent>
 #include <QOpenGLFunctions>
 #include <QOpenGLWidget>
@@ -36,12 +38,21 @@
 class MainWindow;
 class Stage;
 class GLTextRenderer;
+class GLTexturePool;
 
 
 class GLCanvas : public QOpenGLWidget, public QOpenGLFunctions
 {
     Q_OBJECT
   public:
+    /**
+     * Renderer of the stages. Auto selects the SoftwareRenderer when the
+     * OpenGL implementation is itself a software rasterizer (e.g. Mesa's
+     * llvmpipe in virtual machines and remote desktops) or lacks the features
+     * we need, and OpenGL otherwise
+     */
+    enum class Renderer { Auto, OpenGL, Software };
+
     explicit GLCanvas(QWidget* parent = 0);
 
     ~GLCanvas();
@@ -82,10 +93,29 @@ class GLCanvas : public QOpenGLWidget, public QOpenGLFunctions
 
     const GLTextRenderer* get_text_renderer();
 
+    GLTexturePool* get_texture_pool();
+
     void set_main_window(MainWindow* mw);
 
     void render_buffer_icon(Stage* stage, int icon_width, int icon_height);
 
+    /**
+     * Must be called before the canvas is first shown; the renderer is
+     * selected once, when OpenGL is initialized
+     */
+    void set_requested_renderer(Renderer renderer);
+
+    bool is_software_rendering() const
+    {
+        return software_rendering_;
+    }
+
+    /**
+     * Image into which Stage::draw() renders the current frame when the
+     * software renderer is selected
+     */
+    QImage& get_software_frame();
+
   private:
     bool mouse_down_[2];
 
@@ -99,9 +129,18 @@ class GLCanvas : public QOpenGLWidget, public QOpenGLFunctions
 
     bool initialized_;
 
+    Renderer requested_renderer_;
+    bool software_rendering_;
+    QImage software_frame_;
+
+    uint64_t last_paint_us_;
+
     std::unique_ptr<GLTextRenderer> text_renderer_;
+    std::unique_ptr<GLTexturePool> texture_pool_;
 
     void generate_icon_texture();
+
+    void select_renderer(bool fbo_supported);
 };
 
 #endif // GL_CANVAS_H_
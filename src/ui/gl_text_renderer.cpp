@@ -23,16 +23,20 @@
  * IN THE SOFTWARE.
  */
 
-#include <QPainter>
-#include <QPixmap>
+#include <vector>
 
 #include "gl_text_renderer.h"
+
+#include "profiling/tracer.h"
+#include "ui/glyph_atlas.h"
 #include "visualization/shaders/giw_shaders.h"
 
 
+using namespace std;
+
+
 GLTextRenderer::GLTextRenderer(GLCanvas* gl_canvas)
-    : font("Times New Roman", font_size)
-    , text_prog(gl_canvas)
+    : text_prog(gl_canvas)
     , gl_canvas_(gl_canvas)
 {
 }
@@ -70,138 +74,47 @@ bool GLTextRenderer::initialize()
 
 void GLTextRenderer::generate_glyphs_texture()
 {
-    // Required characters for numbers, scientific notation (e), nan, inf
-    const char text[] = "0123456789., -+enaif";
-    const unsigned char* p;
-    const int border_size = 0;
-
-    QFontMetrics g(font);
+    GIW_TRACE_SCOPE("glyph_atlas_upload");
 
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, text_tex);
 
-    // Generate text bitmap
-    QSize texture_size(g.size(Qt::TextSingleLine, text));
-
-    text_texture_width = text_texture_height = 1.0f;
-    while (text_texture_width < texture_size.width())
-        text_texture_width *= 2.f;
-    while (text_texture_height < texture_size.height())
-        text_texture_height *= 2.f;
-
-    const int mipmap_levels = 5;
-
-    {
-        int tex_level_width = text_texture_width;
-        int tex_level_height = text_texture_height;
-
-        for (int i = 0; i < mipmap_levels; ++i) {
-            gl_canvas_->glTexImage2D(GL_TEXTURE_2D,
-                                     i,
-                                     GL_R8,
-                                     tex_level_width,
-                                     tex_level_height,
-                                     0,
-                                     GL_RED,
-                                     GL_UNSIGNED_BYTE,
-                                     nullptr);
-
-            tex_level_width = std::max(1, tex_level_width / 2);
-            tex_level_height = std::max(1, tex_level_height / 2);
-        }
-    }
+    text_texture_width  = glyph_atlas::texture_width;
+    text_texture_height = glyph_atlas::texture_height;
 
-    QPixmap pixmap(texture_size);
-    pixmap.fill(QColor(0, 0, 0));
-    QPainter painter(&pixmap);
-    painter.setPen(QColor(255, 255, 255));
-    painter.setFont(font);
-    painter.drawText(0, g.ascent(), text);
-    QImage img = pixmap.toImage().convertToFormat(QImage::Format_Grayscale8);
-
-    std::vector<uint8_t> packed_texture(text_texture_width *
-                                        text_texture_height);
-    uint8_t* packed_texture_ptr = packed_texture.data();
-
-    int real_ascent  = texture_size.height() - 1;
-    int real_descent = 0;
-
-    bool found_real_descent = false;
-    bool found_real_ascent  = false;
-    // Pack bitmap and compute real ascent and descent lines
-    for (int y = 0; y < texture_size.height(); ++y) {
-        uint8_t* imgptr = img.scanLine(y);
-        int x;
-
-        bool found_filled_pixel = false;
-        for (x = 0; x < texture_size.width(); ++x) {
-            packed_texture_ptr[x] = imgptr[x];
-
-            found_filled_pixel = found_filled_pixel || imgptr[x] > 0;
-        }
+    for (int i = 0; i < glyph_atlas::num_characters; ++i) {
+        const unsigned char c = glyph_atlas::characters[i];
 
-        // If the row was completely empty...
-        if (!found_filled_pixel) {
-            if (!found_real_descent) {
-                real_descent = y;
-            } else if (!found_real_ascent) {
-                real_ascent       = y;
-                found_real_ascent = true;
-            }
-        } else {
-            found_real_descent = true;
+        for (int j = 0; j < 2; ++j) {
+            text_texture_offsets[c][j]  = glyph_atlas::offsets[i][j];
+            text_texture_advances[c][j] = glyph_atlas::advances[i][j];
+            text_texture_sizes[c][j]    = glyph_atlas::sizes[i][j];
+            text_texture_tls[c][j]      = glyph_atlas::tls[i][j];
         }
-
-        for (; x < text_texture_width; ++x) {
-            packed_texture_ptr[x] = 0;
-        }
-        packed_texture_ptr += static_cast<int>(text_texture_width);
-    }
-
-
-    // Compute text box size
-    float box_w = 0;
-    float box_h = 0;
-
-    const int cropped_bitmap_height = real_ascent - real_descent;
-
-    for (p = reinterpret_cast<const unsigned char*>(text); *p; p++) {
-        int advance_x     = g.width(*p);
-        int bitmap_height = g.height();
-
-        text_texture_advances[*p][0] = advance_x;
-        text_texture_advances[*p][1] = 0;
-        text_texture_sizes[*p][0]    = advance_x;
-        text_texture_sizes[*p][1]    = cropped_bitmap_height;
-        text_texture_tls[*p][0]      = 0;
-        text_texture_tls[*p][1]      = cropped_bitmap_height;
-
-        box_w += advance_x + 2 * border_size;
-        box_h = std::max(box_h, (float)bitmap_height + 2 * border_size);
     }
 
-    // Clears generated buffer
-    {
-        gl_canvas_->glTexSubImage2D(GL_TEXTURE_2D,
-                                    0,
-                                    0,
-                                    0,
-                                    text_texture_width,
-                                    text_texture_height,
-                                    GL_RED,
-                                    GL_UNSIGNED_BYTE,
-                                    packed_texture.data());
+    // Expand the runs of zeros of the precomputed atlas
+    vector<uint8_t> texture(glyph_atlas::texture_width *
+                            glyph_atlas::texture_height);
+    size_t texture_pos = 0;
+    for (size_t i = 0; i < glyph_atlas::compressed_texture_size; ++i) {
+        const uint8_t value = glyph_atlas::compressed_texture[i];
+        if (value == 0) {
+            texture_pos += glyph_atlas::compressed_texture[++i];
+        } else {
+            texture[texture_pos++] = value;
+        }
     }
 
-    int x = 0;
-    for (p = reinterpret_cast<const unsigned char*>(text); *p; p++) {
-        int advance_x = g.width(*p);
-
-        text_texture_offsets[*p][0] = x + border_size;
-        text_texture_offsets[*p][1] = real_descent + border_size;
-
-        x += advance_x + border_size * 2;
-    }
+    gl_canvas_->glTexImage2D(GL_TEXTURE_2D,
+                             0,
+                             GL_R8,
+                             glyph_atlas::texture_width,
+                             glyph_atlas::texture_height,
+                             0,
+                             GL_RED,
+                             GL_UNSIGNED_BYTE,
+                             texture.data());
 
     gl_canvas_->glGenerateMipmap(GL_TEXTURE_2D);
     gl_canvas_->glTexParameteri(
@@ -34,9 +34,6 @@
 class GLTextRenderer
 {
   public:
-    static constexpr float font_size = 96.0f;
-
-    QFont font;
     GLuint text_vbo;
     GLuint text_tex;
 
@@ -0,0 +1,154 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "gl_texture_pool.h"
+
+#include "profiling/metrics.h"
+
+
+using namespace std;
+
+
+bool GLTexturePool::TextureShape::operator==(const TextureShape& other) const
+{
+    return width == other.width && height == other.height &&
+           internal_format == other.internal_format;
+}
+
+
+size_t GLTexturePool::TextureShape::size_in_bytes() const
+{
+    size_t texel_size = 4 * sizeof(float);
+    if (internal_format != GL_RGBA32F) {
+        texel_size = 4;
+    }
+
+    return static_cast<size_t>(width) * height * texel_size;
+}
+
+
+GLTexturePool::GLTexturePool(GLCanvas* gl_canvas)
+    : gl_canvas_(gl_canvas)
+    , pooled_bytes_(0)
+{
+}
+
+
+GLTexturePool::~GLTexturePool()
+{
+    for (const auto& texture : texture_shapes_) {
+        gl_canvas_->glDeleteTextures(1, &texture.first);
+    }
+}
+
+
+GLuint GLTexturePool::acquire(int width, int height, GLint internal_format)
+{
+    const TextureShape shape{width, height, internal_format};
+
+    // The most recently released textures are the most likely to still be
+    // resident in video memory
+    for (auto it = free_textures_.rbegin(); it != free_textures_.rend();
+         ++it) {
+        if (it->shape == shape) {
+            const GLuint texture = it->texture;
+            pooled_bytes_ -= shape.size_in_bytes();
+            free_textures_.erase(next(it).base());
+
+            Metrics::record_cache_access("texture_pool", true);
+            Metrics::set_gauge("pooled_texture_bytes", pooled_bytes_);
+
+            return texture;
+        }
+    }
+
+    Metrics::record_cache_access("texture_pool", false);
+
+    GLuint texture;
+    gl_canvas_->glGenTextures(1, &texture);
+    gl_canvas_->glBindTexture(GL_TEXTURE_2D, texture);
+    gl_canvas_->glTexImage2D(GL_TEXTURE_2D,
+                             0,
+                             internal_format,
+                             width,
+                             height,
+                             0,
+                             GL_RGBA,
+                             GL_FLOAT,
+                             nullptr);
+
+    gl_canvas_->glTexParameteri(
+        GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    gl_canvas_->glTexParameteri(
+        GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    gl_canvas_->glTexParameteri(
+        GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    gl_canvas_->glTexParameteri(
+        GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    gl_canvas_->glTexParameteri(
+        GL_TEXTURE_2D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+
+    texture_shapes_[texture] = shape;
+
+    return texture;
+}
+
+
+void GLTexturePool::release(GLuint texture)
+{
+    auto shape = texture_shapes_.find(texture);
+    if (shape == texture_shapes_.end()) {
+        // Not created by the pool
+        gl_canvas_->glDeleteTextures(1, &texture);
+        return;
+    }
+
+    free_textures_.push_back({shape->second, texture});
+    pooled_bytes_ += shape->second.size_in_bytes();
+
+    evict_textures();
+
+    Metrics::set_gauge("pooled_texture_bytes", pooled_bytes_);
+}
+
+
+size_t GLTexturePool::pooled_bytes() const
+{
+    return pooled_bytes_;
+}
+
+
+void GLTexturePool::evict_textures()
+{
+    while (pooled_bytes_ > max_pooled_bytes) {
+        const PooledTexture& oldest = free_textures_.front();
+
+        pooled_bytes_ -= oldest.shape.size_in_bytes();
+        texture_shapes_.erase(oldest.texture);
+        gl_canvas_->glDeleteTextures(1, &oldest.texture);
+
+        free_textures_.pop_front();
+    }
+}
@@ -0,0 +1,97 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GL_TEXTURE_POOL_H_
+#define GL_TEXTURE_POOL_H_
+
+#include <cstddef>
+#include <list>
+#include <map>
+
+#include "ui/gl_canvas.h"
+
+
+/**
+ * Recycles the tile textures of buffers that are removed or re-uploaded, so
+ * that a buffer with the same tile sizes doesn't need to allocate video memory
+ * (nor to set up the texture parameters) again.
+ *
+ * Must only be used from the thread that owns the GL context.
+ */
+class GLTexturePool
+{
+  public:
+    // Upper bound of the video memory kept by unused textures
+    static const size_t max_pooled_bytes = 256 * 1024 * 1024;
+
+    GLTexturePool(GLCanvas* gl_canvas);
+
+    ~GLTexturePool();
+
+    /**
+     * Get a texture with storage for width x height texels in the given
+     * internal format. If a released texture is reused, its contents are
+     * undefined.
+     */
+    GLuint acquire(int width, int height, GLint internal_format);
+
+    /**
+     * Give back a texture obtained with acquire()
+     */
+    void release(GLuint texture);
+
+    size_t pooled_bytes() const;
+
+  private:
+    struct TextureShape
+    {
+        int width;
+        int height;
+        GLint internal_format;
+
+        bool operator==(const TextureShape& other) const;
+
+        size_t size_in_bytes() const;
+    };
+
+    struct PooledTexture
+    {
+        TextureShape shape;
+        GLuint texture;
+    };
+
+    GLCanvas* gl_canvas_;
+
+    // Shapes of all textures created by the pool, including those in use
+    std::map<GLuint, TextureShape> texture_shapes_;
+
+    // Released textures, from the least to the most recently released
+    std::list<PooledTexture> free_textures_;
+    size_t pooled_bytes_;
+
+    void evict_textures();
+};
+
+#endif // GL_TEXTURE_POOL_H_
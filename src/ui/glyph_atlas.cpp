@@ -0,0 +1,2836 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+// Generated by tools/generate_glyph_atlas.py. Do not edit.
+
+#include "glyph_atlas.h"
+
+
+namespace glyph_atlas
+{
+
+const char characters[] = "0123456789., -+enaif";
+
+const int texture_width  = 2048;
+const int texture_height = 256;
+
+const int offsets[num_characters][2] = {
+    {0, 20}, // '0'
+    {81, 20}, // '1'
+    {162, 20}, // '2'
+    {243, 20}, // '3'
+    {324, 20}, // '4'
+    {405, 20}, // '5'
+    {486, 20}, // '6'
+    {567, 20}, // '7'
+    {648, 20}, // '8'
+    {729, 20}, // '9'
+    {810, 20}, // '.'
+    {851, 20}, // ','
+    {892, 20}, // ' '
+    {933, 20}, // '-'
+    {976, 20}, // '+'
+    {1083, 20}, // 'e'
+    {1159, 20}, // 'n'
+    {1241, 20}, // 'a'
+    {1317, 20}, // 'i'
+    {1358, 20}, // 'f'
+};
+
+const int advances[num_characters][2] = {
+    {81, 0}, // '0'
+    {81, 0}, // '1'
+    {81, 0}, // '2'
+    {81, 0}, // '3'
+    {81, 0}, // '4'
+    {81, 0}, // '5'
+    {81, 0}, // '6'
+    {81, 0}, // '7'
+    {81, 0}, // '8'
+    {81, 0}, // '9'
+    {41, 0}, // '.'
+    {41, 0}, // ','
+    {41, 0}, // ' '
+    {43, 0}, // '-'
+    {107, 0}, // '+'
+    {76, 0}, // 'e'
+    {82, 0}, // 'n'
+    {76, 0}, // 'a'
+    {41, 0}, // 'i'
+    {47, 0}, // 'f'
+};
+
+const int sizes[num_characters][2] = {
+    {81, 117}, // '0'
+    {81, 117}, // '1'
+    {81, 117}, // '2'
+    {81, 117}, // '3'
+    {81, 117}, // '4'
+    {81, 117}, // '5'
+    {81, 117}, // '6'
+    {81, 117}, // '7'
+    {81, 117}, // '8'
+    {81, 117}, // '9'
+    {41, 117}, // '.'
+    {41, 117}, // ','
+    {41, 117}, // ' '
+    {43, 117}, // '-'
+    {107, 117}, // '+'
+    {76, 117}, // 'e'
+    {82, 117}, // 'n'
+    {76, 117}, // 'a'
+    {41, 117}, // 'i'
+    {47, 117}, // 'f'
+};
+
+const int tls[num_characters][2] = {
+    {0, 117}, // '0'
+    {0, 117}, // '1'
+    {0, 117}, // '2'
+    {0, 117}, // '3'
+    {0, 117}, // '4'
+    {0, 117}, // '5'
+    {0, 117}, // '6'
+    {0, 117}, // '7'
+    {0, 117}, // '8'
+    {0, 117}, // '9'
+    {0, 117}, // '.'
+    {0, 117}, // ','
+    {0, 117}, // ' '
+    {0, 117}, // '-'
+    {0, 117}, // '+'
+    {0, 117}, // 'e'
+    {0, 117}, // 'n'
+    {0, 117}, // 'a'
+    {0, 117}, // 'i'
+    {0, 117}, // 'f'
+};
+
+const size_t compressed_texture_size = 43195;
+
+const uint8_t compressed_texture[] = {
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 31, 43, 64,
+    64, 64, 64, 64, 49, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 250, 26, 97, 148, 191, 254, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 209, 191, 128, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 242, 16, 103, 209, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255,
+    0, 166, 48, 95, 129, 191, 191, 231, 255, 255, 255, 255, 192, 191, 154, 120,
+    64, 9, 0, 69, 113, 243, 255, 255, 255, 255, 255, 255, 255, 255, 0, 61,
+    54, 91, 128, 171, 191, 206, 255, 255, 255, 255, 255, 255, 243, 191, 191, 150,
+    128, 69, 32, 0, 64, 38, 65, 128, 137, 191, 191, 217, 255, 255, 255, 255,
+    255, 255, 240, 191, 191, 164, 128, 75, 43, 0, 76, 130, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 142, 49, 77, 128, 162, 191,
+    191, 233, 255, 255, 255, 255, 255, 233, 191, 191, 155, 128, 88, 63, 0, 136,
+    30, 65, 128, 155, 191, 191, 246, 255, 255, 255, 255, 255, 255, 206, 191, 179,
+    128, 88, 54, 0, 62, 31, 82, 128, 161, 191, 208, 255, 255, 255, 255, 255,
+    234, 191, 191, 137, 114, 64, 1, 0, 255, 0, 255, 0, 47, 23, 64, 30,
+    0, 44, 14, 128, 242, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 163, 74,
+    152, 228, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 253, 178, 103, 23, 0, 64, 41, 198, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 0, 56, 10, 76, 140, 197, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 235, 169, 103,
+    29, 0, 55, 29, 87, 142, 191, 254, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 239, 179, 109, 31,
+    0, 71, 45, 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    48, 0, 38, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 24, 0, 50, 33, 101, 169, 236, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 217,
+    170, 116, 58, 0, 29, 16, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 12, 0, 35, 10, 92, 158, 223, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 182, 116,
+    34, 0, 54, 13, 90, 166, 235, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 251, 182, 113, 27, 0, 255, 0, 255,
+    0, 41, 10, 126, 227, 255, 255, 255, 232, 135, 14, 0, 40, 69, 230, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 160, 9, 105, 223, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 249, 157, 36, 0, 60, 4, 125, 249, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 0, 53, 26, 104, 183, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 193, 100, 12, 0, 48, 17, 88, 155, 221,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 207, 101, 11,
+    0, 67, 3, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 96, 0, 47, 2, 90, 188, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 251, 184, 115, 44, 0, 25, 64, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 33, 61, 164,
+    246, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 202, 101, 8, 0, 49,
+    62, 167, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 72, 0, 255, 0,
+    255, 0, 38, 34, 215, 255, 255, 255, 255, 255, 255, 255, 223, 42, 0, 38,
+    132, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 159, 102,
+    236, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 166, 22, 0, 57, 52,
+    209, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 50,
+    9, 96, 188, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 237, 130, 20, 0, 43, 35, 113, 197, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 239,
+    133, 15, 0, 65, 115, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 96, 0, 45, 12, 128, 234, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 224,
+    148, 39, 0, 22, 64, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 48, 0, 31, 73, 198, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 233, 123, 10, 0, 45, 78, 211, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 201, 58, 0, 255, 0, 255,
+    0, 35, 21, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 231, 29, 0,
+    36, 160, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0,
+    157, 42, 195, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    239, 104, 0, 54, 9, 136, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 0, 48, 38, 152, 242, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 241,
+    115, 2, 0, 38, 32, 118, 211, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 235,
+    106, 0, 63, 34, 246, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 96, 0, 44, 103, 232, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 128, 0, 22, 64, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 48, 0, 29, 33, 180, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 228, 80, 0, 42, 50,
+    192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 170, 21, 0, 255, 0, 255, 0, 33, 167, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 183, 0, 35, 140, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 179, 96, 44, 0, 5, 21, 79, 157, 245, 255,
+    255, 0, 255, 0, 255, 0, 156, 91, 247, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 177, 12, 0, 51, 63, 220, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0,
+    46, 65, 181, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 211, 48, 0,
+    35, 72, 196, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    189, 27, 0, 61, 189, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 96, 0, 42, 45, 209, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 128, 0, 22, 64, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 48, 0, 28, 95, 244, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 166, 13, 0, 38, 1, 126, 252, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 232, 62, 0, 255, 0,
+    255, 0, 31, 33, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 48, 0, 33, 86, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    189, 38, 0, 11, 22, 166, 255, 0, 255, 0, 255, 0, 155, 137, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 200, 138, 81, 64, 64,
+    64, 64, 121, 178, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 210, 33, 0, 48, 15, 151, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 44, 68, 197, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 228, 181,
+    128, 102, 64, 64, 64, 64, 64, 72, 128, 160, 216, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 104, 0, 34, 143, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 237, 187, 128, 106, 64, 64, 64, 64, 64, 64, 116, 137, 191, 252, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 234, 53,
+    0, 59, 99, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 96, 0, 41, 105, 246, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 230, 184, 128, 94, 64, 64, 64, 64,
+    64, 80, 128, 173, 235, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 128, 0, 22, 64, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 48, 0, 26, 4, 157, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 154, 122, 64, 64, 64,
+    64, 64, 97, 129, 191, 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 218, 38, 0, 36, 25, 197, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 212, 144, 117, 64, 64, 64, 64, 64,
+    113, 141, 211, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    254, 119, 0, 255, 0, 255, 0, 30, 104, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 120, 0, 32, 25, 238, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 149, 0, 15, 125, 0, 255, 0, 255, 0, 153, 1,
+    166, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 245, 140, 33, 0,
+    9, 9, 97, 216, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 234,
+    40, 0, 46, 74, 230, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 0, 43, 136, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 222, 124, 41, 0, 13,
+    35, 122, 228, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 151, 0, 33, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 234, 144, 48, 0, 13, 5, 82, 170, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 75, 0, 57, 25, 239,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    48, 0, 38, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 96, 0, 39, 10, 173, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 225, 125, 46, 0, 13, 61, 160, 253, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 128, 0, 22, 64, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 25, 9, 178, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 239, 136, 37, 0,
+    11, 11, 91, 205, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 234, 48, 0, 34, 42, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 230, 126, 27, 0, 11, 26, 128, 230, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 140, 0, 255, 0, 255, 0, 29, 138, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 154, 0, 32, 152,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 181, 0, 255, 0, 255, 0,
+    170, 154, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184, 31, 0,
+    13, 4, 122, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 227, 32,
+    0, 43, 20, 167, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 43, 159, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 220, 88, 0, 18, 2, 107,
+    237, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 165, 4,
+    0, 31, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    239, 112, 9, 0, 18, 37, 176, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 246, 61, 0, 56, 174, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 96, 0,
+    38, 15, 197, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 84, 0,
+    18, 31, 180, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 128,
+    0, 22, 64, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 242,
+    14, 0, 24, 3, 183, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 145, 16, 0, 16, 80, 230, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 241, 41, 0, 32, 56, 240, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 247, 125, 10, 0, 15, 11, 131, 249, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 147, 0, 255, 0, 255, 0, 28, 136,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 152, 0, 31,
+    34, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 29, 0, 255, 0,
+    255, 0, 169, 138, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 135,
+    0, 17, 57, 237, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 220, 24,
+    0, 41, 90, 236, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 43, 159, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 137, 8, 0, 21, 19, 185,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 155, 0, 31,
+    143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 186, 21, 0,
+    22, 89, 244, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 239,
+    30, 0, 54, 83, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 96, 0, 37, 20, 207, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 244, 116, 2, 0, 21, 106, 253, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 128, 0, 22, 64, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 149, 0, 25, 150, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 239, 71, 0, 19, 18, 187, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 223, 22, 0, 30, 43,
+    240, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 217, 47, 0, 19,
+    53, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 0, 255,
+    0, 255, 0, 27, 99, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 116, 0, 31, 136, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    159, 0, 255, 0, 255, 0, 169, 89, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 113, 0, 19, 38, 235, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 191, 2, 0, 38, 26, 183, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 243, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    0, 43, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 83,
+    0, 25, 146, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    119, 0, 30, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 149,
+    0, 25, 50, 237, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    195, 3, 0, 52, 17, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 96, 0, 36, 15,
+    214, 255, 255, 255, 255, 255, 255, 255, 255, 255, 221, 46, 0, 24, 82, 253,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 128, 0, 22, 64, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 42, 0, 24, 89, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 236, 46, 0, 21, 5, 172, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 185, 0, 29, 32, 229,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 207, 18, 0, 21, 25,
+    216, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 79, 0, 255, 0,
+    255, 0, 26, 27, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 40, 0, 30, 3, 232, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    68, 0, 255, 0, 255, 0, 168, 36, 243, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 144, 0, 21, 57, 246, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 129, 0, 37, 106, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 236, 90, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    0, 43, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 74, 0,
+    27, 142, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 57,
+    0, 29, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 153, 0, 27,
+    55, 246, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 103, 0,
+    52, 158, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 96, 0, 35, 4, 187, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 202, 17, 0, 26, 115, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 128, 0, 22, 64, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 190, 0, 24, 24, 236, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 248, 57, 0, 23, 6, 196, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 100, 0, 27, 6, 202, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 218, 16, 0, 23, 24, 226, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 243, 41, 0, 255, 0, 255, 0, 26, 152, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172, 0, 31, 57, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 245, 6, 0, 255, 0, 255, 0, 167,
+    7, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 197, 2, 0, 22,
+    104, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 65, 0, 34, 37,
+    194, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 168, 20, 0, 1,
+    143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 43, 159,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 108, 0, 28, 1, 179, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 217, 9, 0, 28, 143,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 196, 5, 0, 28, 106, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 231, 11, 0, 50, 68, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 159, 0, 78, 150,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 211, 17, 0, 28, 192, 255, 255,
+    255, 255, 255, 255, 255, 255, 128, 0, 22, 64, 255, 255, 255, 255, 255, 255,
+    255, 16, 0, 41, 20, 248, 255, 255, 255, 255, 255, 255, 255, 255, 83, 0,
+    24, 155, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 111, 0,
+    25, 26, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 236, 14,
+    0, 26, 141, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 244, 39,
+    0, 25, 52, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 202, 3,
+    0, 255, 0, 255, 0, 25, 11, 208, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 221, 21, 0, 31, 129, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    192, 0, 255, 0, 255, 0, 168, 122, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 247, 39, 0, 24, 190, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 219, 7, 0, 31, 2, 121, 247, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 230, 74, 0, 3, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 0, 43, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 179,
+    0, 30, 19, 232, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    124, 0, 28, 143, 255, 255, 255, 255, 255, 255, 255, 255, 247, 37, 0, 30,
+    200, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 106, 0, 49,
+    10, 223, 255, 255, 255, 255, 255, 255, 255, 250, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 159,
+    0, 77, 102, 255, 255, 255, 255, 255, 255, 255, 255, 255, 232, 25, 0, 29,
+    48, 255, 255, 255, 255, 255, 255, 255, 255, 128, 0, 22, 64, 255, 255, 255,
+    255, 255, 255, 255, 16, 0, 41, 119, 255, 255, 255, 255, 255, 255, 255, 255,
+    227, 4, 0, 23, 34, 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 202, 2, 0, 26, 104, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 125, 0, 25, 60, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 108, 0, 27, 122, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 113, 0, 255, 0, 255, 0, 26, 17, 188, 255, 255, 255, 255, 255, 255,
+    255, 203, 28, 0, 32, 184, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    147, 0, 255, 0, 255, 0, 167, 29, 246, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 128, 0, 25, 37, 251, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 122, 0, 30, 36, 204, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 151, 15, 0, 4, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 0, 43, 159, 255, 255, 255, 255, 255, 255, 255, 255, 248, 30,
+    0, 31, 90, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 238,
+    16, 0, 27, 143, 255, 255, 255, 255, 255, 255, 255, 255, 141, 0, 31, 65,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 207, 0, 49, 142,
+    255, 255, 255, 255, 255, 255, 255, 253, 134, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 159, 0,
+    76, 32, 244, 255, 255, 255, 255, 255, 255, 255, 255, 254, 69, 0, 31, 186,
+    255, 255, 255, 255, 255, 255, 255, 128, 0, 22, 64, 255, 255, 255, 255, 255,
+    255, 255, 16, 0, 40, 3, 223, 255, 255, 255, 255, 255, 255, 255, 255, 124,
+    0, 24, 146, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 70,
+    0, 27, 5, 221, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 236,
+    6, 0, 23, 2, 206, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    203, 1, 0, 27, 5, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    245, 31, 0, 228, 24, 64, 64, 64, 64, 64, 64, 64, 64, 64, 40, 0,
+    255, 0, 43, 82, 176, 244, 255, 252, 184, 96, 0, 34, 233, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 111, 0, 255, 0, 255, 0, 167, 172, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 237, 14, 0, 26, 155, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 246, 28, 0, 29, 96, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 219, 63, 0, 6, 143, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 0, 43, 159, 255, 255, 255, 255, 255,
+    255, 255, 255, 148, 0, 32, 1, 210, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 123, 0, 27, 143, 255, 255, 255, 255, 255, 255, 255, 250,
+    24, 0, 32, 212, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    39, 0, 47, 55, 253, 255, 255, 255, 255, 255, 255, 255, 144, 80, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255,
+    255, 255, 255, 159, 0, 76, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    144, 0, 32, 92, 255, 255, 255, 255, 255, 255, 255, 128, 0, 22, 64, 255,
+    255, 255, 255, 255, 255, 255, 16, 0, 40, 78, 255, 255, 255, 255, 255, 255,
+    255, 255, 249, 22, 0, 23, 5, 235, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 211, 0, 29, 113, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 81, 0, 23, 101, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 72, 0, 29, 85, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 163, 0, 228, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159,
+    0, 255, 0, 83, 16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    83, 0, 255, 0, 255, 0, 166, 56, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 122, 0, 27, 31, 250, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 158, 0, 29, 96, 255, 255, 255, 255, 255, 255, 255, 255, 254, 135,
+    9, 0, 7, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    0, 43, 159, 255, 255, 255, 255, 255, 255, 255, 254, 33, 0, 33, 95, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 221, 0, 27, 143, 255,
+    255, 255, 255, 255, 255, 255, 172, 0, 33, 124, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 107, 0, 46, 6, 211, 255, 255, 255, 255, 255,
+    255, 255, 224, 10, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 159, 0, 75, 107, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 235, 16, 0, 32, 18, 253, 255, 255, 255,
+    255, 255, 255, 128, 0, 22, 64, 255, 255, 255, 255, 255, 255, 255, 16, 0,
+    40, 185, 255, 255, 255, 255, 255, 255, 255, 255, 164, 0, 24, 75, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 115, 0, 29, 21, 252, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 0, 22, 3, 221, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 206, 0, 30, 1, 214, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 39, 0, 227, 96, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 159, 0, 255, 0, 83, 44, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 63, 0, 255, 0, 255, 0, 166, 177,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 19, 0, 28, 172, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 29, 0, 28, 96, 255, 255,
+    255, 255, 255, 255, 255, 208, 52, 0, 9, 143, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 0, 43, 159, 255, 255, 255, 255, 255, 255, 255,
+    191, 0, 34, 10, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 61, 0, 26, 143, 255, 255, 255, 255, 255, 255, 255, 88, 0, 33, 51,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 168, 0, 46, 127,
+    255, 255, 255, 255, 255, 255, 255, 255, 71, 0, 1, 80, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255,
+    255, 159, 0, 74, 18, 240, 255, 255, 255, 255, 255, 255, 255, 255, 255, 106,
+    0, 34, 212, 255, 255, 255, 255, 255, 255, 128, 0, 22, 64, 255, 255, 255,
+    255, 255, 255, 255, 16, 0, 39, 38, 254, 255, 255, 255, 255, 255, 255, 255,
+    255, 57, 0, 24, 141, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 40, 0, 30, 198, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    235, 1, 0, 21, 82, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 104, 0, 31, 113, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    164, 0, 227, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 255,
+    0, 83, 69, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 47, 0,
+    255, 0, 255, 0, 165, 43, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 166, 0, 29, 71, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    143, 0, 28, 96, 255, 255, 255, 255, 255, 248, 124, 3, 0, 10, 143, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 43, 159, 255, 255,
+    255, 255, 255, 255, 255, 108, 0, 35, 170, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 136, 0, 26, 143, 255, 255, 255, 255, 255, 255, 253,
+    17, 0, 33, 5, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    208, 0, 45, 43, 249, 255, 255, 255, 255, 255, 255, 255, 162, 0, 2, 80,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38, 255,
+    255, 255, 255, 255, 255, 159, 0, 74, 138, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 232, 6, 0, 34, 168, 255, 255, 255, 255, 255, 255, 128, 0, 22,
+    64, 255, 255, 255, 255, 255, 255, 255, 16, 0, 39, 144, 255, 255, 255, 255,
+    255, 255, 255, 255, 205, 0, 25, 204, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 229, 0, 31, 132, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 45, 0, 21, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 250, 15, 0, 31, 20, 251, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 252, 33, 0, 226, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    159, 0, 255, 0, 83, 81, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 39, 0, 255, 0, 255, 0, 165, 162, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 68, 0, 29, 2, 225, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 244, 18, 0, 27, 96, 255, 255, 255, 255, 197, 40, 0, 12,
+    143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 43, 159,
+    255, 255, 255, 255, 255, 255, 255, 37, 0, 35, 99, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 200, 0, 26, 143, 255, 255, 255, 255, 255,
+    255, 214, 0, 35, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    245, 1, 0, 43, 2, 199, 255, 255, 255, 255, 255, 255, 255, 234, 20, 0,
+    2, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0,
+    38, 255, 255, 255, 255, 255, 255, 159, 0, 73, 25, 247, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 126, 0, 65, 64, 255, 255, 255, 255, 255, 255, 255,
+    16, 0, 38, 11, 239, 255, 255, 255, 255, 255, 255, 255, 255, 98, 0, 24,
+    2, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 181, 0, 31,
+    84, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 91, 0, 20,
+    25, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 188, 0, 33,
+    191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 131, 0, 226, 96,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 255, 0, 83, 89, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 34, 0, 255, 0, 255, 0,
+    164, 16, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 238, 4, 0,
+    30, 146, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 109, 0, 27,
+    96, 255, 255, 243, 111, 0, 14, 143, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 0, 43, 159, 255, 255, 255, 255, 255, 255, 234, 0, 36,
+    44, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 9, 0,
+    25, 143, 255, 255, 255, 255, 255, 255, 167, 0, 35, 178, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 10, 0, 43, 111, 255, 255, 255, 255,
+    255, 255, 255, 255, 90, 0, 3, 80, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 159, 0, 73,
+    151, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 21, 0, 65, 64, 255,
+    255, 255, 255, 255, 255, 255, 16, 0, 38, 102, 255, 255, 255, 255, 255, 255,
+    255, 255, 237, 9, 0, 24, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 140, 0, 31, 44, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 126, 0, 20, 106, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 115, 0, 33, 117, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 228, 3, 0, 225, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    159, 0, 255, 0, 83, 95, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 32, 0, 255, 0, 255, 0, 164, 103, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 163, 0, 31, 67, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 202, 0, 27, 96, 255, 186, 29, 0, 15, 143, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 43, 159, 255, 255, 255, 255,
+    255, 255, 183, 0, 36, 4, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 45, 0, 25, 143, 255, 255, 255, 255, 255, 255, 131, 0, 35,
+    158, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 22, 0, 42,
+    31, 245, 255, 255, 255, 255, 255, 255, 255, 181, 0, 4, 80, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255,
+    255, 255, 159, 0, 72, 19, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    180, 0, 66, 64, 255, 255, 255, 255, 255, 255, 255, 16, 0, 38, 209, 255,
+    255, 255, 255, 255, 255, 255, 255, 139, 0, 25, 63, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 114, 0, 31, 18, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 158, 0, 20, 185, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 57, 0, 33, 53, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 75, 0, 225, 96, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 159, 0, 255, 0, 83, 96, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 164, 197, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 86, 0, 31, 5, 240, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 41, 0, 26, 78, 94, 0, 17, 143,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 43, 159, 255,
+    255, 255, 255, 255, 255, 144, 0, 37, 218, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 81, 0, 68, 149, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 29, 0, 42, 186, 255, 255, 255, 255, 255, 255, 255,
+    243, 29, 0, 4, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 159, 0, 72, 116, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 94, 0, 66, 64, 255, 255, 255, 255,
+    255, 255, 255, 16, 0, 37, 61, 255, 255, 255, 255, 255, 255, 255, 255, 253,
+    34, 0, 25, 77, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    94, 0, 32, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172,
+    0, 19, 2, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249,
+    8, 0, 33, 6, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    163, 0, 225, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 255,
+    0, 83, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0,
+    255, 0, 255, 0, 163, 35, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 22, 0, 32, 182, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 134, 0, 45, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 0, 43, 159, 255, 255, 255, 255, 255, 255, 110, 0, 37, 191, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 111, 0, 68, 148, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 20, 0, 41, 95, 255, 255,
+    255, 255, 255, 255, 255, 255, 108, 0, 5, 80, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 159,
+    0, 71, 1, 219, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 15, 0,
+    66, 32, 128, 128, 128, 128, 128, 128, 128, 8, 0, 37, 168, 255, 255, 255,
+    255, 255, 255, 255, 255, 180, 0, 26, 88, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 85, 0, 32, 245, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 183, 0, 19, 44, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 213, 0, 35, 204, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 235, 3, 0, 224, 96, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 159, 0, 255, 0, 83, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 32, 0, 255, 0, 255, 0, 163, 112, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 217, 0, 33, 121, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 211, 0, 45, 143, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 0, 88, 174, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 124, 0, 68, 158, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 254, 7, 0, 40, 23, 237, 255, 255, 255, 255, 255, 255, 255, 198,
+    1, 0, 5, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    48, 0, 38, 255, 255, 255, 255, 255, 255, 159, 0, 71, 70, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 195, 0, 112, 25, 250, 255, 255, 255, 255,
+    255, 255, 255, 255, 73, 0, 26, 92, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 83, 0, 32, 242, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 188, 0, 19, 97, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 177, 0, 35, 166, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 58, 0, 224, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    159, 0, 255, 0, 83, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 32, 0, 255, 0, 255, 0, 163, 183, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 157, 0, 33, 61, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 27, 0, 44, 143, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 0, 88, 166, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 135, 0, 68, 173, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 230, 0, 41, 170, 255, 255, 255, 255, 255, 255, 255, 249, 42, 0,
+    6, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0,
+    38, 255, 255, 255, 255, 255, 255, 159, 0, 71, 163, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 131, 0, 112, 127, 255, 255, 255, 255, 255, 255, 255,
+    255, 219, 2, 0, 26, 83, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 91, 0, 32, 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 179, 0, 19, 132, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 142, 0, 35, 130, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 133, 0, 224, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0,
+    255, 0, 83, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32,
+    0, 255, 0, 255, 0, 162, 9, 246, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 103, 0, 33, 10, 253, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 98, 0, 44, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 0, 88, 162, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 137, 0, 68, 204, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 193, 0, 40, 80, 255, 255, 255, 255, 255, 255, 255, 255, 127, 0, 7,
+    80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38,
+    255, 255, 255, 255, 255, 255, 159, 0, 70, 4, 238, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 66, 0, 111, 5, 229, 255, 255, 255, 255, 255, 255,
+    255, 255, 114, 0, 27, 68, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 104, 0, 31, 8, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 163, 0, 19, 163, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 119, 0, 35, 100, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 200, 0, 224, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159,
+    0, 83, 63, 64, 64, 64, 64, 64, 2, 0, 78, 8, 64, 64, 64, 64,
+    64, 8, 0, 61, 8, 64, 64, 64, 64, 64, 64, 46, 0, 94, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0,
+    162, 71, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 59, 0,
+    34, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 168, 0, 44,
+    143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 88, 169,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 116, 0, 67, 2,
+    240, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 138, 0, 39, 15,
+    229, 255, 255, 255, 255, 255, 255, 255, 212, 6, 0, 7, 80, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255,
+    255, 255, 159, 0, 70, 66, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    253, 12, 0, 111, 85, 255, 255, 255, 255, 255, 255, 255, 255, 245, 17, 0,
+    27, 38, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 130, 0,
+    31, 34, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 134, 0,
+    19, 195, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 99, 0,
+    35, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 248, 6,
+    0, 223, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 76, 1,
+    64, 126, 188, 204, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 191,
+    138, 81, 25, 0, 68, 65, 137, 191, 252, 255, 255, 255, 255, 255, 255, 255,
+    255, 205, 157, 103, 26, 0, 49, 7, 64, 119, 155, 191, 234, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 202, 176, 128, 73, 14, 0, 87, 96,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255,
+    0, 162, 133, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 15,
+    0, 34, 173, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 230, 0,
+    44, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 88,
+    179, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 95, 0, 67,
+    41, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 75, 0, 39,
+    154, 255, 255, 255, 255, 255, 255, 255, 253, 56, 0, 8, 80, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255,
+    255, 255, 159, 0, 70, 145, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    218, 0, 112, 192, 255, 255, 255, 255, 255, 255, 255, 255, 155, 0, 28, 7,
+    249, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 162, 0, 31, 66,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 97, 0, 19, 211,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 82, 0, 35, 60,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 53, 0, 223,
+    96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 73, 7, 90, 174,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 216, 128, 39, 0, 29, 48, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    16, 0, 9, 20, 128, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 196, 91, 0, 43, 7, 78, 145, 206, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 199, 116, 28, 0, 32, 48, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    16, 0, 17, 48, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 175, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 143, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 88, 0, 255, 0,
+    255, 0, 144, 184, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 224,
+    0, 35, 128, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 27,
+    0, 43, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0,
+    88, 200, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 72, 0,
+    67, 106, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 242, 7, 0,
+    38, 64, 255, 255, 255, 255, 255, 255, 255, 255, 146, 0, 9, 80, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255,
+    255, 255, 255, 159, 0, 70, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 171, 0, 111, 44, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0,
+    29, 204, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 209, 0, 31,
+    112, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 45, 0, 19,
+    221, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 75, 0, 35,
+    48, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 107, 0,
+    223, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 71, 23, 139,
+    242, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 200, 81, 0, 27, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 32, 0, 7, 6, 125, 242, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 224,
+    75, 0, 38, 19, 100, 177, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 181, 67, 0, 30, 96, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0,
+    17, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 175, 0, 255, 0, 255, 0,
+    144, 236, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 187, 0, 35,
+    92, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 78, 0, 43,
+    143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 88, 225,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 22, 0, 67, 191,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 154, 0, 38, 9, 220,
+    255, 255, 255, 255, 255, 255, 255, 225, 11, 0, 9, 80, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255,
+    255, 159, 0, 69, 29, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    125, 0, 111, 151, 255, 255, 255, 255, 255, 255, 255, 255, 196, 0, 30, 142,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 14, 0, 30, 168,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 234, 3, 0, 19, 232,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 69, 0, 35, 41,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 158, 0, 223,
+    96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 69, 15, 142, 247,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 217, 73, 0,
+    25, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 6, 46, 213, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 169, 12, 0, 33, 2, 89, 174, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 192, 54,
+    0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 17, 96, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 175, 0, 255, 0, 255, 0, 143, 32, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 155, 0, 35, 60, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 129, 0, 43, 143, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 87, 8, 253, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 214, 0, 67, 39, 253, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 43, 0, 38, 139, 255, 255, 255, 255,
+    255, 255, 255, 255, 73, 0, 10, 80, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 159, 0, 69,
+    86, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 90, 0, 110, 15,
+    243, 255, 255, 255, 255, 255, 255, 255, 255, 89, 0, 30, 64, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 81, 0, 29, 3, 236, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 20, 236, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 66, 0, 35, 35, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 196, 0, 223, 96, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 159, 0, 68, 78, 231, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 174, 24, 0,
+    23, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 5, 86, 247, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 209, 26, 0, 30, 32, 140, 234, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 136, 9, 0, 26, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32,
+    0, 17, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 175, 0, 255, 0, 255,
+    0, 143, 83, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 123,
+    0, 35, 27, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 180,
+    0, 43, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0,
+    87, 45, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 151, 0,
+    67, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 164, 0, 38,
+    52, 252, 255, 255, 255, 255, 255, 255, 255, 164, 0, 11, 80, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255,
+    255, 255, 159, 0, 69, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 58, 0, 110, 110, 255, 255, 255, 255, 255, 255, 255, 255, 231, 5, 0,
+    30, 2, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 170, 0,
+    29, 72, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 65, 0,
+    20, 228, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 72, 0,
+    35, 35, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 232,
+    0, 223, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 66, 9,
+    162, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 237, 66, 0, 22, 96, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    32, 0, 4, 105, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 214, 18, 0, 29, 128, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 207,
+    27, 0, 25, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 17, 96, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 175, 0, 255, 0, 255, 0, 143, 121, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 91, 0, 35, 2, 249, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218, 0, 43, 143, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 87, 96, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 83, 0, 66, 57, 254, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 242, 28, 0, 37, 5, 208, 255, 255,
+    255, 255, 255, 255, 255, 235, 21, 0, 11, 80, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 159,
+    0, 69, 200, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 26, 0,
+    110, 216, 255, 255, 255, 255, 255, 255, 255, 255, 129, 0, 32, 116, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 24, 0, 28, 174, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 0, 21, 219, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 78, 0, 35, 42, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 13, 0, 222, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 65, 28, 204, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 197, 119, 64, 21, 0, 4,
+    25, 64, 118, 185, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 253, 112, 0, 21, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 3, 96,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 190,
+    1, 0, 28, 128, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 242, 169, 108, 64, 17, 0, 5, 22, 64, 106, 158, 227, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 231, 47, 0, 24, 96,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 32, 0, 17, 96, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 175, 0, 255, 0, 255, 0, 143, 156, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 64, 0, 36, 224, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 249, 3, 0, 42, 143, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 0, 87, 150, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 236, 6, 0, 65, 15, 218, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 95, 0, 38, 123, 255, 255, 255, 255, 255, 255, 255,
+    255, 92, 0, 12, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 159, 0, 9, 52, 87, 128,
+    143, 191, 191, 191, 191, 191, 191, 191, 191, 135, 128, 85, 59, 0, 43, 7,
+    249, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 2, 0, 13, 4,
+    64, 96, 128, 128, 179, 191, 191, 183, 128, 128, 128, 72, 64, 2, 0, 81,
+    69, 255, 255, 255, 255, 255, 255, 255, 255, 251, 27, 0, 32, 10, 230, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 143, 0, 27, 45, 254, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 80, 0, 21, 209, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 89, 0, 35, 48, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 49, 0, 222, 96,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 64, 40, 231, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 147, 33, 0, 12, 24, 124,
+    239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 129, 0, 20,
+    96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 32, 0, 2, 65, 250, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 0, 28, 128,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 207, 92, 3, 0,
+    14, 58, 159, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 234,
+    38, 0, 23, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 17, 96, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 175, 0, 255, 0, 255, 0, 143, 190, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 43, 0, 36, 203, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 31, 0, 42, 143, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 87, 217, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 143, 0, 65, 9, 187, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 150, 0, 38, 40, 248, 255, 255, 255,
+    255, 255, 255, 255, 183, 0, 13, 80, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 159, 0, 5,
+    43, 121, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 203, 154, 80, 6, 0, 38, 42, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 228, 0, 11, 65, 142, 206, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 203, 150, 83, 5,
+    0, 77, 175, 255, 255, 255, 255, 255, 255, 255, 255, 170, 0, 34, 92, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 44, 0, 26, 193, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 187, 0, 22, 186, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 109, 0, 35, 64, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 80, 0, 222, 96,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 63, 40, 231, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 203, 39, 0, 16, 18, 161, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 123, 0, 19, 24, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 135, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 32, 0, 1, 24, 231, 255, 255, 255, 255, 255, 255,
+    255, 211, 143, 96, 64, 64, 64, 64, 64, 81, 132, 201, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 26, 0, 27, 128,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 240, 99, 0, 19, 33, 184,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 225, 21, 0, 22, 24,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 135, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 32, 0, 17, 24, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 135, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    88, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 44, 0, 255, 0, 255, 0, 143, 224, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 22, 0, 36, 181, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 66, 0, 42, 143, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 0, 86, 33, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 44, 0, 64, 16, 191, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 176, 3, 0, 37, 1, 197, 255, 255, 255, 255, 255,
+    255, 255, 244, 30, 0, 13, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255, 255, 159, 0, 2, 12,
+    106, 215, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 172, 79, 0, 36, 80,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 209, 0, 8, 26, 135,
+    230, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 246, 168, 64, 0, 74, 30, 252, 255, 255, 255,
+    255, 255, 255, 255, 255, 63, 0, 35, 174, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 206, 9, 0, 24, 113, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 240, 29, 0, 22, 158, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 130, 0, 35, 85, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 100, 0, 222, 96, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 159, 0, 62, 31, 231, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 158, 5, 0, 19, 95, 251, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 92, 0, 29, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 32, 0, 1, 177, 255, 255, 255, 255, 255, 251, 150, 38,
+    0, 11, 29, 141, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 156, 0, 27, 128, 255, 255, 255, 255, 255, 255, 255, 255, 255, 216,
+    36, 0, 22, 105, 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 182,
+    0, 33, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0,
+    28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255,
+    0, 255, 0, 160, 5, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 253, 3, 0, 36, 160, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 99, 0, 42, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 0, 86, 115, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    191, 0, 64, 59, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    169, 5, 0, 38, 108, 255, 255, 255, 255, 255, 255, 255, 255, 110, 0, 14,
+    80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38,
+    255, 255, 255, 255, 255, 255, 159, 6, 119, 237, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 225, 115, 8, 0, 33, 118, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 191, 0, 6, 25, 151, 252, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 208, 86, 0, 72, 134, 255, 255, 255,
+    255, 255, 255, 255, 255, 211, 0, 36, 13, 214, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 171, 3, 0, 22, 74, 252, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 252, 71, 0, 23, 129, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 159, 0, 35, 107, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 120, 0, 222, 96, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 159, 0, 61, 10, 207, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 148, 0, 22, 75, 251, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 245, 44, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 32, 84, 255, 255, 255, 255, 255, 195, 34, 0, 15, 41,
+    211, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 21, 0,
+    26, 128, 255, 255, 255, 255, 255, 255, 255, 255, 220, 25, 0, 24, 72, 248,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 107, 0, 32, 96, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 160, 25,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 236, 0, 37, 140,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 121, 0, 42, 143,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 86, 202, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 59, 0, 62, 32, 166, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 129, 0, 39, 29, 243,
+    255, 255, 255, 255, 255, 255, 255, 200, 2, 0, 14, 80, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255,
+    255, 201, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 229, 101, 0, 32, 156, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 172, 0, 4, 1, 119, 243, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 196, 51, 0, 69, 7, 234, 255, 255,
+    255, 255, 255, 255, 255, 255, 104, 0, 37, 31, 222, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 169, 8, 0, 20, 80, 248, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 254, 95, 0, 24, 92, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 195, 0, 35, 142, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 140, 0, 222, 96, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 159, 0, 61, 170, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 176, 1, 0, 23, 100, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 217, 8, 0, 27, 96, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 39, 224, 255, 255, 255, 255, 146, 2, 0, 17, 16,
+    208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 121, 0, 26,
+    128, 255, 255, 255, 255, 255, 255, 255, 246, 44, 0, 26, 86, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 236, 17, 0, 31, 96, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 160, 44, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 223, 0, 37, 127, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 140, 0, 42, 143, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 85, 46, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 181, 0, 60, 8, 86, 175, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 226, 66, 0, 40, 182, 255,
+    255, 255, 255, 255, 255, 255, 249, 44, 0, 15, 80, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 198, 36, 0, 30, 194, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 159, 0, 3, 32, 199, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 130, 1, 0, 67,
+    93, 255, 255, 255, 255, 255, 255, 255, 255, 240, 12, 0, 38, 30, 212, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 206, 41, 0, 17, 7, 134,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 248, 90, 0, 25, 41,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 233, 0, 35, 179,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 161, 0,
+    222, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 60, 97, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 226, 15, 0, 25, 165, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 131, 0, 27, 96, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 142, 255, 255, 255, 255, 137, 0,
+    20, 32, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 209, 0,
+    26, 128, 255, 255, 255, 255, 255, 255, 255, 120, 0, 28, 150, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 140, 0, 31, 96, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 160, 64, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 211, 0, 37, 116, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 160, 0, 42, 143, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 85, 150, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 49, 0, 56, 45, 69, 128, 190, 249, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 134, 14, 0, 40,
+    92, 255, 255, 255, 255, 255, 255, 255, 255, 129, 0, 16, 80, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 229, 191, 134,
+    128, 128, 128, 128, 128, 128, 166, 194, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 244, 102, 0, 29, 221, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 151, 0, 2, 69, 238, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 241, 191, 160, 128, 128, 128, 128, 180,
+    202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 195, 23, 0, 66, 200, 255, 255, 255, 255, 255, 255, 255, 255, 145, 0,
+    40, 13, 173, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 143,
+    27, 0, 13, 1, 94, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 228, 55, 0, 26, 2, 243, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 30, 0, 34, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 176, 0, 222, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 159, 0, 59, 26, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 70, 0, 26, 17, 235, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 248, 38, 0, 26, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 247, 255, 255, 255, 176, 0, 22, 118, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 33, 0, 25, 128, 255, 255, 255, 255, 255, 255, 230,
+    7, 0, 28, 16, 234, 255, 255, 255, 255, 255, 255, 255, 255, 255, 241, 13,
+    0, 30, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0,
+    28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255,
+    0, 255, 0, 160, 83, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 199, 0, 37, 104, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 179, 0, 42, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 0, 84, 21, 246, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 162,
+    0, 48, 108, 191, 191, 191, 191, 191, 201, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 243, 144, 28, 0, 41, 21,
+    235, 255, 255, 255, 255, 255, 255, 255, 213, 7, 0, 16, 80, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 103, 32, 0, 12, 68,
+    152, 235, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    146, 1, 0, 27, 242, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    144, 0, 1, 97, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 222, 122,
+    48, 0, 9, 10, 78, 163, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 221, 35, 0, 64, 52, 255, 255, 255, 255, 255, 255, 255,
+    255, 254, 39, 0, 42, 91, 235, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 178, 101, 45, 0, 7, 19, 75, 151, 230, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 153, 15, 0, 28, 187, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 84, 0, 33, 26, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 182, 0, 222, 96,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 59, 173, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 179, 0, 28, 112, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 175, 0, 26, 96, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 232, 17, 0, 22, 12, 241, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 104, 0, 25, 128, 255, 255,
+    255, 255, 255, 255, 123, 0, 30, 124, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 108, 0, 30, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    32, 0, 255, 0, 255, 0, 160, 102, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 188, 0, 37, 92, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 198, 0, 42, 143, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 0, 84, 134, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 234, 20, 0, 48, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 199, 100, 15, 0, 43,
+    166, 255, 255, 255, 255, 255, 255, 255, 254, 58, 0, 17, 80, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 254, 156, 35, 0, 17, 5, 106, 228, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 176, 7, 0, 25,
+    9, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 136, 106, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 219, 83, 0, 15, 20, 146, 253, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 231, 42, 0, 63, 159,
+    255, 255, 255, 255, 255, 255, 255, 255, 186, 0, 44, 14, 132, 240, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218, 191, 191, 191,
+    193, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    183, 49, 0, 30, 112, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 150, 0, 33, 85, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 189, 0, 222, 96, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 159, 0, 58, 56, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 46, 0, 28, 7, 234, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    254, 43, 0, 25, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 91, 0, 24, 154, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 160, 0, 25, 128, 255, 255, 255, 255, 255, 255, 31, 0, 30, 23,
+    252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 201, 0, 30, 96, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 160, 113,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 178, 0, 37, 82,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 209, 0, 42, 143,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 83, 24, 244,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 90, 0, 49, 143, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 226,
+    166, 99, 24, 0, 45, 76, 255, 255, 255, 255, 255, 255, 255, 255, 148, 0,
+    18, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0,
+    38, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 196, 43, 0, 21, 12,
+    145, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 173, 3,
+    0, 24, 30, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 211,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 141, 7, 0, 18, 50, 219, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 225, 26, 0, 61, 19,
+    247, 255, 255, 255, 255, 255, 255, 255, 255, 79, 0, 46, 13, 107, 212, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 238, 155, 42, 0,
+    32, 37, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 225, 0,
+    33, 161, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 195, 0, 222, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0,
+    58, 188, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 187, 0, 30,
+    133, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 163, 0, 25, 96,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 2, 0,
+    24, 76, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 216, 0, 25,
+    128, 255, 255, 255, 255, 255, 211, 0, 32, 193, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 254, 25, 0, 29, 96, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 32, 0, 255, 0, 255, 0, 160, 119, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 174, 0, 37, 78, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 215, 0, 42, 143, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 0, 83, 153, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 181, 0, 50, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 198, 162, 118, 56, 0, 44, 14, 227,
+    255, 255, 255, 255, 255, 255, 255, 226, 12, 0, 18, 80, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255, 255, 255,
+    255, 255, 255, 254, 124, 0, 25, 79, 244, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 158, 0, 24, 52, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 90, 0,
+    21, 13, 194, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 206,
+    11, 0, 60, 117, 255, 255, 255, 255, 255, 255, 255, 255, 224, 3, 0, 49,
+    40, 115, 185, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 216, 148, 78, 2, 0, 35,
+    207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 53, 0, 31,
+    5, 236, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 201, 0, 222, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0,
+    57, 60, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 81, 0,
+    30, 37, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 23, 0,
+    24, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 96,
+    0, 25, 11, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 6,
+    0, 24, 128, 255, 255, 255, 255, 255, 153, 0, 32, 131, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 99, 0, 29, 96, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 160, 126, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 170, 0, 37, 75, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 221, 0, 42, 143, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 0, 82, 53, 253, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 239, 29, 0, 50, 143, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249,
+    174, 96, 17, 0, 40, 151, 255, 255, 255, 255, 255, 255, 255, 255, 75, 0,
+    19, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0,
+    38, 255, 255, 255, 255, 255, 255, 255, 245, 78, 0, 27, 52, 242, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 108, 0, 23, 71, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 254, 81, 0, 23, 10, 193, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 155, 0, 59, 2, 222, 255, 255, 255, 255, 255, 255, 255, 255,
+    120, 0, 52, 63, 110, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 235, 140, 74, 26, 0, 37, 104,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 153, 0, 31, 84,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    206, 0, 222, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 57,
+    165, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 239, 6, 0, 31,
+    209, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 111, 0, 24, 96,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 242, 11, 0, 26,
+    208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 40, 0, 24, 32,
+    64, 64, 64, 64, 64, 30, 0, 32, 82, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 155, 0, 29, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 32, 0, 255, 0, 255, 0, 160, 132, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 167, 0, 37, 71, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 227, 0, 42, 143, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 0, 81, 4, 205, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 78, 0, 51, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252,
+    163, 58, 0, 37, 61, 255, 255, 255, 255, 255, 255, 255, 255, 166, 0, 20,
+    80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38,
+    255, 255, 255, 255, 255, 255, 245, 63, 0, 29, 64, 248, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 248, 50, 0, 22, 79, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119,
+    0, 25, 20, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    76, 0, 58, 76, 255, 255, 255, 255, 255, 255, 255, 255, 248, 20, 0, 48,
+    36, 116, 193, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 219, 155,
+    74, 0, 34, 13, 242, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    242, 19, 0, 30, 190, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 200, 0, 222, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 159, 0, 56, 18, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 160, 0, 32, 134, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 203, 0, 24, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 165, 0, 27, 160, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    75, 0, 63, 49, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 207, 0,
+    29, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 28,
+    96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0,
+    255, 0, 160, 138, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    163, 0, 37, 67, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    233, 0, 42, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    0, 81, 123, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 140, 0, 52,
+    72, 128, 128, 128, 128, 128, 167, 191, 191, 191, 219, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 193, 60, 0, 34,
+    8, 217, 255, 255, 255, 255, 255, 255, 255, 236, 22, 0, 20, 80, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 38, 255, 255, 255,
+    255, 255, 252, 73, 0, 31, 110, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 213, 5, 0, 21, 85, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 0, 27, 57, 253, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 231, 11, 0, 57, 183, 255,
+    255, 255, 255, 255, 255, 255, 255, 161, 0, 46, 6, 96, 205, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 236, 140,
+    31, 0, 32, 133, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    134, 0, 29, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 193, 0, 222, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 159, 0, 56, 109, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 87, 0, 32, 72, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 36, 0, 23, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 91, 0, 27, 122, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 97, 0, 63, 29, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250,
+    4, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32,
+    0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0,
+    255, 0, 255, 0, 160, 142, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 160, 0, 37, 65, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 238, 0, 42, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 0, 80, 48, 249, 255, 255, 255, 255, 255, 255, 255, 255, 255, 197,
+    5, 0, 64, 44, 87, 153, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 171, 22, 0, 32, 135, 255, 255, 255, 255, 255, 255,
+    255, 255, 94, 0, 21, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 48, 0, 38, 128, 128, 128, 128, 128, 81, 0, 33, 184, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112, 0, 21, 92, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249,
+    34, 0, 28, 145, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    126, 0, 56, 36, 254, 255, 255, 255, 255, 255, 255, 255, 255, 54, 0, 44,
+    3, 107, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 193, 172, 128, 128, 128, 128, 128, 148, 191, 233, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 157, 28, 0, 30, 15, 236, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 245, 31, 0, 27, 2, 200,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 187, 0, 222, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0,
+    56, 187, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 19, 0,
+    32, 15, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 105, 0,
+    23, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 25, 0,
+    27, 88, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 118, 0, 63,
+    19, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 30, 0, 28, 96,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0,
+    160, 137, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 163, 0,
+    37, 68, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 233, 0,
+    42, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 79,
+    11, 216, 255, 255, 255, 255, 255, 255, 255, 255, 255, 235, 29, 0, 69, 54,
+    158, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 238, 82,
+    0, 30, 49, 251, 255, 255, 255, 255, 255, 255, 255, 185, 0, 22, 80, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 77, 38, 249,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 240, 20, 0, 20, 99,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 147, 0, 29, 20, 242, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 242, 21, 0, 55, 142, 255, 255, 255, 255, 255, 255, 255, 255, 202, 0,
+    44, 57, 215, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 228,
+    145, 60, 0, 11, 34, 105, 198, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 247, 121, 1, 0, 29, 111, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 185, 0, 27, 114, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 180, 0, 187, 28, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 135, 255, 255, 255, 255, 255, 255, 255, 255, 255, 183, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 44, 0,
+    20, 13, 249, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 216, 0,
+    34, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172, 0, 23,
+    96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 227, 0, 28, 63,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 137, 0, 63, 16, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 59, 0, 28, 96, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 160, 131,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 167, 0, 37, 71,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 227, 0, 42, 143,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 79, 162, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 248, 60, 0, 72, 26, 153, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 136, 0, 28, 4, 206,
+    255, 255, 255, 255, 255, 255, 255, 245, 31, 0, 22, 80, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 78, 147, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 127, 0, 20, 106, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 27, 0, 30,
+    134, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 125, 0, 54,
+    10, 238, 255, 255, 255, 255, 255, 255, 255, 255, 94, 0, 43, 132, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 225, 95, 2, 0, 16, 50,
+    177, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 201, 28, 0,
+    28, 2, 195, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 122,
+    0, 25, 56, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 173, 0, 187, 112, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 175, 0, 20, 80, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 161, 0, 34, 180, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 237, 3, 0, 22, 96, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 178, 0, 28, 39, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 145, 0, 63, 16, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 83, 0, 28, 96, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 160, 125, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 171, 0, 37, 75, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 220, 0, 42, 143, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 0, 78, 106, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 88, 0, 75, 60, 222, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 163, 3, 0, 26, 120, 255, 255, 255, 255, 255,
+    255, 255, 255, 112, 0, 23, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 48, 0, 78, 34, 252, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 234, 7, 0, 19, 110, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 174, 0, 31, 31, 253, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 226, 4, 0, 53, 100, 255, 255, 255,
+    255, 255, 255, 255, 255, 235, 7, 0, 41, 12, 182, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 136, 10, 0, 20, 73, 233, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 235, 56, 0, 28, 33, 244, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 86, 0, 23, 37, 232, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 164, 0, 187, 112, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 175, 0, 20, 138, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 114, 0, 34, 146, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 40, 0, 22, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 142, 0, 28, 22, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 151, 0, 63, 16, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 93, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    32, 0, 255, 0, 255, 0, 160, 119, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 174, 0, 37, 79, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 214, 0, 42, 143, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 0, 77, 62, 250, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 124, 0, 77, 16, 194, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 168, 0, 25, 38, 247, 255, 255, 255, 255, 255, 255, 255, 201, 2,
+    0, 23, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48,
+    0, 79, 178, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 95,
+    0, 19, 104, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 79, 0, 32, 184, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 78, 0, 53, 207, 255, 255, 255, 255, 255, 255, 255, 255, 135,
+    0, 41, 14, 198, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 244,
+    77, 0, 23, 24, 201, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    244, 63, 0, 28, 79, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 253, 97, 0, 21, 47, 233, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 143, 0, 187, 112, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 175, 0,
+    20, 188, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 74, 0,
+    34, 118, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 86, 0,
+    22, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 108, 0, 28,
+    9, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 158, 0, 63, 16,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 102, 0, 28, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 160,
+    112, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 179, 0, 37,
+    83, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 0, 42,
+    143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 76, 34,
+    234, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 79, 7, 185, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 134, 0, 24, 194, 255,
+    255, 255, 255, 255, 255, 255, 250, 45, 0, 24, 80, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 48, 0, 79, 90, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 181, 0, 19, 98, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 10, 0, 32, 103, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 52, 59, 255,
+    255, 255, 255, 255, 255, 255, 255, 252, 31, 0, 40, 7, 194, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 243, 61, 0, 25, 12, 196, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 245, 51, 0, 28, 113, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 154, 10, 0, 18, 106,
+    246, 255, 255, 255, 255, 255, 255, 255, 255, 179, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 122, 0, 187, 112, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 175, 0, 20, 238, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 34, 0, 34, 91, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 133, 0, 22, 96, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 84, 0, 29, 252, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 159, 0, 40, 34, 64, 87, 128, 128, 128, 128,
+    139, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+    195, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 110, 0, 28, 96,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0,
+    160, 100, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 189, 0,
+    37, 94, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 195, 0,
+    42, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 75,
+    17, 217, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184, 6, 0, 80, 12,
+    207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 82, 0, 22,
+    104, 255, 255, 255, 255, 255, 255, 255, 255, 131, 0, 25, 80, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 79, 13, 248, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 15, 0, 18, 92, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 183, 0, 33,
+    27, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 233, 2, 0,
+    51, 166, 255, 255, 255, 255, 255, 255, 255, 255, 176, 0, 41, 160, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 75, 0, 27, 15, 219, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 229, 27, 0, 28, 129, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 230, 99, 2, 0,
+    14, 67, 201, 255, 255, 255, 255, 255, 255, 255, 255, 255, 158, 42, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 100, 0, 187, 112, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 175, 0, 19,
+    27, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 6, 0,
+    34, 75, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 178, 0,
+    22, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 64, 0, 29,
+    247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 35, 30, 94,
+    151, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 112, 0, 28, 96, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 160, 80, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 201, 0, 37, 106, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 176, 0, 42, 143, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 0, 74, 9, 194, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 192, 9, 0, 82, 36, 245, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 235, 24, 0, 20, 27, 241, 255, 255, 255, 255,
+    255, 255, 255, 215, 7, 0, 25, 80, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 48, 0, 80, 194, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 87, 0, 18, 85, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 125, 0, 34, 219, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 54, 0, 50, 23, 249, 255, 255, 255, 255,
+    255, 255, 255, 255, 69, 0, 40, 92, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 132, 0, 29, 44, 248, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 188, 0, 29, 111, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 233, 145, 70, 2, 0, 8, 54, 124, 218, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 143, 0, 1, 49, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 79, 0, 136, 24, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 40, 0, 18, 112,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 175,
+    0, 19, 56, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 232,
+    0, 35, 60, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 210,
+    0, 22, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0,
+    29, 243, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 32, 26,
+    119, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112, 0, 28, 96, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 160, 61,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 0, 37, 117,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 157, 0, 42, 143,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 73, 4, 178,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 200, 12, 0, 84, 111, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 162, 0, 20, 179, 255, 255,
+    255, 255, 255, 255, 255, 254, 59, 0, 26, 80, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 48, 0, 80, 133, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 144, 0, 18, 78, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 70, 0, 34, 164, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 109, 0, 50, 125, 255, 255, 255,
+    255, 255, 255, 255, 255, 217, 1, 0, 39, 24, 239, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 215, 7, 0, 30, 126, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 104, 0, 29, 81, 239, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218, 191, 191, 191,
+    191, 191, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249,
+    103, 0, 2, 57, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    57, 0, 136, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 159, 0, 18, 112, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 175, 0, 19, 85, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 245, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+    191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+    191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 204, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 238, 0, 22, 96, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 41, 0, 29, 239, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 159, 0, 30, 53, 167, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 112, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 32, 0, 255, 0, 255, 0, 160, 41, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 225, 0, 37, 129, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 137, 0, 42, 143, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 0, 73, 162, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 208, 15, 0, 85, 5, 220, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 254, 48, 0, 18, 88, 255, 255, 255, 255, 255, 255, 255, 255,
+    149, 0, 27, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    48, 0, 80, 79, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    200, 0, 18, 61, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 28, 0, 34, 115, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 160, 0, 49, 4, 227, 255, 255, 255, 255, 255, 255, 255, 255,
+    110, 0, 40, 152, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    78, 0, 31, 7, 230, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    234, 14, 0, 29, 32, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 216, 52, 0, 3, 65, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 28, 0, 136, 96, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 18, 112, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 175, 0,
+    19, 113, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    11, 0, 21, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 35,
+    0, 29, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 28,
+    31, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112,
+    0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0,
+    28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255,
+    0, 255, 0, 160, 22, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 239, 0, 37, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 118, 0, 42, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 0, 72, 153, 255, 255, 255, 255, 255, 255, 255, 255, 255, 214, 20, 0,
+    87, 99, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 0,
+    17, 20, 233, 255, 255, 255, 255, 255, 255, 255, 227, 13, 0, 27, 80, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 80, 38, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 248, 5, 0, 17, 41,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 245, 1,
+    0, 34, 77, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 211,
+    0, 49, 83, 255, 255, 255, 255, 255, 255, 255, 255, 243, 15, 0, 39, 35,
+    251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 0, 33, 112,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 0, 31, 100,
+    234, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 130,
+    9, 0, 4, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 244,
+    1, 0, 136, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 159, 0, 18, 112, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 175, 0, 19, 130, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 38, 0, 21, 96, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 32, 0, 29, 239, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 159, 0, 27, 104, 243, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 112, 0, 28, 96, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 160, 3, 250, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 5, 0, 36, 164, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 94, 0, 42, 143, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 71, 146, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 211, 23, 0, 88, 10, 240, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 251, 28, 0, 16, 163, 255, 255, 255,
+    255, 255, 255, 255, 255, 77, 0, 28, 80, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 48, 0, 80, 4, 249, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 33, 0, 17, 20, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 214, 0, 35, 41, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 245, 0, 49, 190, 255, 255, 255, 255,
+    255, 255, 255, 255, 151, 0, 40, 142, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 104, 0, 33, 16, 247, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 232, 6, 0, 31, 15, 121, 230, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 251, 155, 28, 0, 6, 98, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 206, 0, 137, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 18, 112, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 175, 0, 19, 139, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 54, 0, 21,
+    96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 29, 239,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 25, 9, 169, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112,
+    0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0,
+    28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255,
+    0, 255, 0, 161, 219, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 25, 0, 36, 185, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 60, 0, 42, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 0, 70, 144, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 18, 0,
+    90, 156, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 120, 0,
+    15, 73, 255, 255, 255, 255, 255, 255, 255, 255, 168, 0, 29, 80, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 81, 226, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 64, 0, 17, 3, 253, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 192, 0, 35, 15,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 19, 0, 47,
+    42, 255, 255, 255, 255, 255, 255, 255, 255, 255, 44, 0, 39, 6, 239, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 16, 0, 34, 170, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 85, 0, 33, 3, 95,
+    175, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 219, 122, 25, 0, 8, 117, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 168, 0, 137, 96, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 53, 96, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 159, 0, 54, 148, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 66, 0, 21, 96, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 29, 239, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 159, 0, 24, 14, 200, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 198, 136, 102, 64, 64,
+    0, 16, 16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112, 0,
+    28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 28,
+    96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0,
+    255, 0, 161, 185, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    47, 0, 36, 206, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    26, 0, 42, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    0, 69, 144, 255, 255, 255, 255, 255, 255, 255, 255, 255, 207, 16, 0, 91,
+    81, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 199, 0, 14,
+    12, 226, 255, 255, 255, 255, 255, 255, 255, 237, 23, 0, 29, 80, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 81, 203, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 96, 0, 18, 234, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 0, 36, 249, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 47, 149, 255,
+    255, 255, 255, 255, 255, 255, 255, 192, 0, 40, 71, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 192, 0, 35, 97, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 167, 0, 36, 12, 86, 140, 194, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 235, 181, 115, 43, 0,
+    11, 136, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 130, 0, 137,
+    96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    159, 0, 53, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 54,
+    157, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 78,
+    0, 21, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0,
+    29, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 23, 9,
+    195, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 203,
+    96, 15, 0, 21, 16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    112, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32,
+    0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0,
+    255, 0, 255, 0, 161, 150, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 68, 0, 36, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 246, 1, 0, 42, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 0, 68, 145, 255, 255, 255, 255, 255, 255, 255, 255, 255, 207, 16,
+    0, 92, 14, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253,
+    20, 0, 13, 147, 255, 255, 255, 255, 255, 255, 255, 255, 96, 0, 30, 80,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 81, 182,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 114, 0, 18, 201,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 36,
+    229, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 68, 0, 46,
+    14, 242, 255, 255, 255, 255, 255, 255, 255, 255, 85, 0, 40, 148, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 125, 0, 35, 29, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 240, 3, 0, 40, 23, 64,
+    78, 128, 128, 128, 128, 128, 128, 65, 64, 14, 0, 15, 159, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 87, 0, 137, 96, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 53, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 54, 153, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 90, 0, 21, 96, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 29, 239, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 159, 0, 23, 167, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 219, 71, 0, 24, 16, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 112, 0, 28, 96, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 161, 116, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 96, 0, 35, 4, 251, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 0, 43, 143, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 67, 145, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 207, 16, 0, 94, 216, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 73, 0, 12, 12, 254, 255, 255, 255, 255,
+    255, 255, 255, 253, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+    191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+    191, 191, 191, 211, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    203, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+    191, 191, 0, 64, 173, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 124, 0, 18, 165, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 152, 0, 36, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 77, 0, 46, 108, 255, 255, 255, 255, 255, 255, 255, 255, 228, 4,
+    0, 40, 205, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 74,
+    0, 36, 234, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 46,
+    0, 67, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 30, 0,
+    137, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 159, 0, 53, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0,
+    54, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 0,
+    71, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 29,
+    239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 22, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 169, 12, 0, 25,
+    16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112, 0, 28, 96,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0,
+    161, 75, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 128, 0,
+    35, 33, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 172, 0,
+    43, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 66,
+    146, 255, 255, 255, 255, 255, 255, 255, 255, 255, 207, 16, 0, 95, 168, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 125, 0, 12, 16, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 0, 64, 166, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 134, 0, 18, 129, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 146, 0, 36, 214, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 86, 0, 46, 215, 255, 255, 255, 255, 255, 255,
+    255, 255, 126, 0, 40, 8, 250, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 29, 0, 36, 188, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 98, 0, 67, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 228, 0, 138, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 159, 0, 53, 96, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 159, 0, 54, 134, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 213, 0, 71, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    32, 0, 29, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0,
+    21, 18, 238, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 162,
+    0, 27, 16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112, 0,
+    28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 28,
+    96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0,
+    255, 0, 161, 24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    161, 0, 35, 65, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    121, 0, 43, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    0, 65, 147, 255, 255, 255, 255, 255, 255, 255, 255, 255, 207, 16, 0, 96,
+    135, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 162, 0, 12,
+    16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 0, 64, 161, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 141, 0, 18, 93, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 148, 0, 36, 209, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 93, 0, 45, 67, 255, 255, 255, 255,
+    255, 255, 255, 255, 250, 24, 0, 40, 40, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 250, 2, 0, 36, 156, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 135, 0, 66, 3, 251, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 171, 0, 138, 48, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 80, 0, 53, 96, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 159, 0, 54, 124, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 220, 0, 71, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 32, 0, 29, 239, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 159, 0, 21, 139, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 200, 6, 0, 27, 16, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 112, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    32, 0, 255, 0, 255, 0, 162, 227, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 193, 0, 35, 97, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 69, 0, 43, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 0, 64, 147, 255, 255, 255, 255, 255, 255, 255, 255, 255, 207,
+    16, 0, 97, 107, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    192, 0, 12, 16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 64, 167, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 133, 0, 18, 53, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 154, 0, 36, 213, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 86, 0, 45, 173, 255,
+    255, 255, 255, 255, 255, 255, 255, 167, 0, 41, 70, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 226, 0, 37, 130, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 166, 0, 66, 36, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 114, 0, 224, 96, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 159, 0, 54, 99, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 226, 0, 71, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 32, 0, 29, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    159, 0, 20, 12, 242, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    251, 44, 0, 28, 16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    112, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32,
+    0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0,
+    255, 0, 255, 0, 162, 176, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 232, 0, 35, 136, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 18, 0, 43, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 0, 63, 148, 255, 255, 255, 255, 255, 255, 255, 255, 255, 207, 16, 0,
+    98, 85, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 216, 0,
+    12, 16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 64, 174, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 123, 0, 18, 7, 248, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 160, 0, 36, 220, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 76, 0, 44, 29, 251, 255, 255,
+    255, 255, 255, 255, 255, 255, 59, 0, 41, 92, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 208, 0, 37, 112, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 188, 0, 66, 83, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 50, 0, 224, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 159, 0, 54, 70, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 242, 0, 71, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 32, 0, 29, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159,
+    0, 20, 100, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 162,
+    0, 29, 16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112, 0,
+    28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 28,
+    96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0,
+    255, 0, 162, 124, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    22, 0, 34, 181, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 221,
+    0, 44, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0,
+    62, 148, 255, 255, 255, 255, 255, 255, 255, 255, 255, 207, 16, 0, 99, 76,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 226, 0, 12, 16,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 0, 64, 184, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 113, 0, 19, 201, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 176, 0, 36, 228, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 66, 0, 44, 132, 255, 255, 255, 255, 255, 255,
+    255, 255, 207, 0, 42, 102, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 199, 0, 37, 104, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 197, 0, 66, 130, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    226, 0, 225, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 54,
+    41, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 7, 0,
+    70, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 29,
+    239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 20, 183, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 56, 0, 29, 16, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112, 0, 28, 96, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 162, 58,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 67, 0, 34, 226,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 156, 0, 44, 143, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 61, 149, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 207, 16, 0, 100, 67, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 236, 0, 12, 16, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 0, 64, 206, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 94, 0, 19, 146, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 196, 0, 36, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 46, 0, 43, 6, 233, 255, 255, 255, 255, 255, 255, 255, 255, 100,
+    0, 42, 109, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 193,
+    0, 37, 98, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 205,
+    0, 66, 177, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 147, 0, 225,
+    96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 54, 10, 252, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 27, 0, 70, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 29, 239, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 19, 6, 244, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 228, 1, 0, 29, 16, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 112, 0, 28, 96, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 162, 3, 239, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112, 0, 33, 17, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 85, 0, 44, 143, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 60, 149, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 207, 16, 0, 101, 69, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 231, 0, 53, 80, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 48, 0, 81, 229, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 63, 0, 19, 91, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 216, 0, 35, 12, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 14, 0, 43, 91, 255, 255, 255, 255,
+    255, 255, 255, 255, 238, 10, 0, 42, 101, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 199, 0, 37, 104, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 197, 0, 65, 1, 234, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 68, 0, 225, 96, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 159, 0, 55, 212, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 57, 0, 70, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    32, 0, 29, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0,
+    19, 52, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 167, 0,
+    30, 16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112, 0, 28,
+    96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 28, 96,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255,
+    0, 163, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 168, 0,
+    33, 72, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 17, 0,
+    44, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 59,
+    150, 255, 255, 255, 255, 255, 255, 255, 255, 255, 207, 16, 0, 102, 78, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 220, 0, 53, 80, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 80, 6, 251,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 19, 23,
+    253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 2, 0, 34,
+    37, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 237, 0, 44,
+    198, 255, 255, 255, 255, 255, 255, 255, 255, 141, 0, 43, 91, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 207, 0, 37, 112, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 186, 0, 65, 45, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 238, 5, 0, 225, 96, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 159, 0, 55, 162, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 93, 0, 70, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 32, 0, 29, 239, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 159, 0, 19, 90, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 117, 0, 30, 16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 112, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32,
+    0, 255, 0, 255, 0, 163, 100, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 228, 0, 33, 132, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 198, 0, 45, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 0, 58, 151, 255, 255, 255, 255, 255, 255, 255, 255, 255, 207, 16, 0,
+    54, 48, 191, 191, 191, 191, 191, 191, 149, 0, 41, 93, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 209, 0, 53, 80, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 33, 24, 191, 191, 191, 191,
+    191, 191, 184, 0, 39, 43, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 248, 4, 0, 20, 201, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 29, 0, 34, 73, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 200, 0, 43, 50, 255, 255, 255, 255, 255, 255, 255, 255, 254,
+    36, 0, 43, 79, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    225, 0, 37, 130, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    175, 0, 65, 109, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 146, 0,
+    226, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 55, 110, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 129, 0, 70, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 29, 239, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 19, 125, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 85, 0, 30, 16, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 112, 0, 28, 96, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 163, 23, 251, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 33, 0, 32, 193, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 118, 0, 45, 143, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 0, 57, 151, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 207, 16, 0, 26, 84, 191, 191, 191, 191, 191, 191, 167,
+    0, 21, 64, 255, 255, 255, 255, 255, 255, 222, 0, 41, 122, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 186, 0, 53, 80, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 33, 32, 255, 255, 255,
+    255, 255, 255, 255, 12, 0, 38, 84, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 199, 0, 21, 126, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 69, 0, 34, 109, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 145, 0, 43, 157, 255, 255, 255, 255, 255, 255, 255, 255,
+    182, 0, 44, 51, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    250, 1, 0, 36, 156, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 147, 0, 65, 181, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 41,
+    0, 226, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 55, 43,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 179, 0, 70, 96,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 29, 239, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 19, 141, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 62, 0, 30, 16, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 112, 0, 28, 96, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 164, 180, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 99, 0, 31, 11, 247, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 252, 27, 0, 45, 143, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 56, 152, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 207, 16, 0, 27, 112, 255, 255, 255, 255, 255, 255,
+    223, 0, 21, 64, 255, 255, 255, 255, 255, 255, 248, 3, 0, 40, 155, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 151, 0, 53, 80, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 33, 32, 255,
+    255, 255, 255, 255, 255, 255, 39, 0, 38, 139, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 144, 0, 21, 50, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 121, 0, 34, 158, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 89, 0, 42, 18, 246, 255, 255, 255, 255, 255,
+    255, 255, 255, 75, 0, 44, 18, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 28, 0, 36, 187, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 114, 0, 64, 17, 250, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 192, 0, 227, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159,
+    0, 56, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 233, 0,
+    38, 64, 64, 64, 64, 64, 64, 64, 64, 64, 16, 0, 22, 96, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 29, 239, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 159, 0, 19, 153, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 53, 0, 30, 20, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 112, 0, 28, 96, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 164, 86, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 177, 0, 31, 82, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 185, 0, 46, 143, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 0, 55, 152, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 207, 16, 0, 28, 112, 255, 255, 255, 255, 255, 255, 223, 0, 21,
+    64, 255, 255, 255, 255, 255, 255, 255, 40, 0, 40, 205, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 115, 0, 53, 80, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 33, 32, 255, 255, 255, 255,
+    255, 255, 255, 81, 0, 38, 200, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 87, 0, 22, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 175, 0, 34, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 28, 0, 42, 115, 255, 255, 255, 255, 255, 255, 255, 255, 221, 2,
+    0, 45, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 73,
+    0, 36, 232, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 80,
+    0, 64, 97, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 87, 0, 227,
+    96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 56, 147, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 37, 0, 36, 45, 255, 255,
+    255, 255, 255, 255, 255, 255, 253, 20, 0, 22, 96, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 32, 0, 29, 239, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 159, 0, 19, 155, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 52, 0, 30, 30, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 112, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 32, 0, 255, 0, 255, 0, 164, 8, 239, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 246, 10, 0, 30, 161, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 92, 0, 46, 143, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 0, 54, 153, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    207, 16, 0, 29, 112, 255, 255, 255, 255, 255, 255, 223, 0, 21, 64, 255,
+    255, 255, 255, 255, 255, 255, 90, 0, 39, 10, 250, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 65, 0, 53, 80, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 48, 0, 33, 32, 255, 255, 255, 255, 255,
+    255, 255, 128, 0, 37, 18, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 249, 15, 0, 22, 113, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 238, 4, 0, 32, 20, 253, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 202, 0, 42, 2, 220, 255, 255, 255, 255, 255, 255, 255, 255,
+    116, 0, 46, 185, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    122, 0, 35, 27, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 27, 0, 64, 190, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218, 4,
+    0, 227, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 56, 60,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 110, 0, 36, 116,
+    255, 255, 255, 255, 255, 255, 255, 255, 200, 0, 23, 96, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 32, 0, 29, 239, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 159, 0, 19, 144, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 63, 0, 30, 54, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 112, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 32, 0, 255, 0, 255, 0, 165, 141, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 85, 0, 29, 7, 238, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 233, 8, 0, 46, 143, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 0, 53, 153, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 207, 16, 0, 30, 112, 255, 255, 255, 255, 255, 255, 223, 0, 21, 64,
+    255, 255, 255, 255, 255, 255, 255, 157, 0, 39, 80, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 249, 9, 0, 53, 80, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 33, 32, 255, 255, 255, 255,
+    255, 255, 255, 191, 0, 37, 98, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 182, 0, 23, 19, 249, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 61, 0, 32, 93, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 119, 0, 42, 74, 255, 255, 255, 255, 255, 255, 255, 255, 246,
+    18, 0, 46, 126, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    189, 0, 35, 94, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    223, 0, 21, 8, 128, 128, 128, 128, 128, 128, 123, 0, 35, 47, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 88, 0, 228, 96, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 159, 0, 57, 212, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 186, 0, 36, 200, 255, 255, 255, 255, 255, 255, 255, 255,
+    124, 0, 23, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32,
+    0, 29, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 19,
+    131, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 89, 0, 30,
+    88, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112, 0, 28, 96,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0,
+    165, 27, 249, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 185, 0, 29,
+    90, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 121, 0, 47, 143,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 52, 154, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 207, 16, 0, 31, 112, 255, 255, 255,
+    255, 255, 255, 223, 0, 21, 64, 255, 255, 255, 255, 255, 255, 255, 229, 2,
+    0, 38, 161, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 194,
+    0, 54, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48,
+    0, 33, 32, 255, 255, 255, 255, 255, 255, 255, 248, 14, 0, 36, 187, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 97, 0, 24, 165, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 145, 0, 32, 173, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 32, 0, 42, 181, 255, 255,
+    255, 255, 255, 255, 255, 255, 157, 0, 47, 63, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 248, 14, 0, 34, 166, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 160, 0, 21, 16, 255, 255, 255, 255, 255,
+    255, 255, 24, 0, 34, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 207,
+    1, 0, 228, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 57,
+    109, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 27, 0, 34,
+    37, 255, 255, 255, 255, 255, 255, 255, 255, 255, 34, 0, 23, 96, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 29, 239, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 159, 0, 19, 100, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 125, 0, 30, 141, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 112, 0, 28, 96, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 166, 155, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 253, 34, 0, 28, 191, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 240, 15, 0, 47, 143, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 0, 51, 154, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 207, 16, 0, 32, 112, 255, 255, 255, 255, 255, 255, 223, 0, 21,
+    64, 255, 255, 255, 255, 255, 255, 255, 255, 71, 0, 37, 19, 247, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 109, 0, 54, 80, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 33, 32, 255, 255,
+    255, 255, 255, 255, 255, 255, 97, 0, 35, 42, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 235, 9, 0, 24, 42, 253, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 237, 6, 0, 30, 21, 249, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 173, 0, 42, 35, 253, 255, 255, 255, 255,
+    255, 255, 255, 255, 50, 0, 47, 3, 230, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 100, 0, 33, 14, 245, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 75, 0, 21, 16, 255, 255, 255, 255, 255, 255,
+    255, 74, 0, 33, 38, 249, 255, 255, 255, 255, 255, 255, 255, 255, 255, 73,
+    0, 229, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 57, 14,
+    236, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 124, 0, 34, 144,
+    255, 255, 255, 255, 255, 255, 255, 255, 196, 0, 24, 96, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 32, 0, 29, 239, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 159, 0, 19, 66, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 180, 0, 30, 208, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 112, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 32, 0, 255, 0, 255, 0, 166, 37, 251, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 145, 0, 27, 49, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 134, 0, 48, 143, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 0, 50, 155, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    207, 16, 0, 33, 112, 255, 255, 255, 255, 255, 255, 223, 0, 21, 64, 255,
+    255, 255, 255, 255, 255, 255, 255, 177, 0, 37, 125, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 250, 20, 0, 54, 80, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 33, 32, 255, 255, 255, 255,
+    255, 255, 255, 255, 198, 0, 35, 158, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 130, 0, 26, 166, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 94, 0, 30, 119, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 59, 0, 42, 140, 255, 255, 255, 255, 255, 255, 255, 255, 198,
+    0, 49, 144, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 202,
+    0, 33, 106, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 237,
+    5, 0, 21, 16, 255, 255, 255, 255, 255, 255, 255, 140, 0, 33, 178, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 171, 0, 32, 12, 101, 175, 191, 191,
+    191, 155, 71, 0, 33, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 20, 0, 144, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0,
+    58, 116, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 231, 9, 0,
+    32, 19, 242, 255, 255, 255, 255, 255, 255, 255, 255, 91, 0, 24, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 29, 239, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 19, 16, 253, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 244, 10, 0, 28, 38, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 112, 0, 28, 96, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 167, 143, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 248, 28, 0, 26, 180, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 231, 14, 0, 48, 143, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 49, 156, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 207, 16, 0, 34, 112, 255, 255, 255, 255, 255, 255,
+    223, 0, 21, 64, 255, 255, 255, 255, 255, 255, 255, 255, 255, 51, 0, 35,
+    23, 243, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 168, 0,
+    55, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0,
+    33, 32, 255, 255, 255, 255, 255, 255, 255, 255, 255, 65, 0, 33, 47, 252,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 243, 22, 0, 26, 40,
+    252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 217, 3, 0, 28, 11,
+    234, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 186, 0, 42, 9,
+    237, 255, 255, 255, 255, 255, 255, 255, 255, 91, 0, 49, 43, 254, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 71, 0, 31, 6, 224, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 140, 0, 22, 16, 255,
+    255, 255, 255, 255, 255, 255, 223, 0, 32, 74, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 234, 22, 0, 31, 87, 235, 255, 255, 255, 255, 255, 255, 255,
+    200, 39, 0, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    67, 0, 144, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 58,
+    8, 229, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 115, 0, 32,
+    140, 255, 255, 255, 255, 255, 255, 255, 255, 226, 5, 0, 24, 96, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 29, 239, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 159, 0, 20, 210, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 90, 0, 28, 146, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 112, 0, 28, 96, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 167, 15, 231, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 154, 0, 25, 59, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 94, 0, 49, 143, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 0, 48, 156, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 207, 16, 0, 35, 112, 255, 255, 255, 255, 255, 255, 223, 0,
+    21, 64, 255, 255, 255, 255, 255, 255, 255, 255, 255, 200, 3, 0, 34, 170,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 42, 0, 55,
+    80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 33,
+    32, 255, 255, 255, 255, 255, 255, 255, 255, 255, 206, 3, 0, 31, 2, 194,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 118, 0, 28, 143,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 103, 0, 28, 126, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 42, 0, 42, 98, 255,
+    255, 255, 255, 255, 255, 255, 255, 233, 6, 0, 50, 175, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 208, 4, 0, 30, 117, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 248, 25, 0, 22, 16, 255, 255,
+    255, 255, 255, 255, 255, 255, 71, 0, 30, 25, 233, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 85, 0, 31, 122, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 240, 57, 0, 30, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 49, 0, 144, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159,
+    0, 59, 86, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 239, 26,
+    0, 30, 44, 250, 255, 255, 255, 255, 255, 255, 255, 255, 108, 0, 25, 96,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 29, 239, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 20, 135, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 206, 0, 27, 29, 246, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112, 0, 28, 96, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255, 0, 255, 0, 168, 94,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 62, 0, 23, 7, 214,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 197, 0, 50, 143, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 47, 157, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 207, 16, 0, 36, 112, 255, 255, 255, 255, 255,
+    255, 223, 0, 21, 64, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 123,
+    0, 33, 100, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    162, 0, 56, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    48, 0, 33, 32, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 120, 0,
+    31, 123, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 216, 6,
+    0, 28, 10, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 239, 25,
+    0, 26, 41, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 142,
+    0, 43, 205, 255, 255, 255, 255, 255, 255, 255, 255, 131, 0, 51, 50, 253,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 121, 0, 29, 35,
+    246, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 146, 0, 23,
+    16, 255, 255, 255, 255, 255, 255, 255, 255, 195, 0, 29, 5, 189, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 162, 0, 31, 88, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 237, 31, 0, 28, 2, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 29, 0, 144, 96, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 159, 0, 60, 171, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 177, 0, 29, 7, 205, 255, 255, 255, 255, 255, 255, 255,
+    255, 217, 5, 0, 25, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 32, 0, 29, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159,
+    0, 20, 47, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    95, 0, 26, 176, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 112, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32,
+    0, 255, 0, 255, 0, 169, 179, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 221, 12, 0, 22, 137, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    244, 39, 0, 50, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 0, 46, 157, 255, 255, 255, 255, 255, 255, 255, 255, 255, 239, 80, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 147, 255, 255, 255, 255, 255, 255, 223, 0, 21, 64, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 78, 0, 31, 69, 249, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 234, 22, 0, 56, 80,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 33, 32,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 66, 0, 29, 76, 251,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 56, 0, 30, 71,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 190, 4, 0, 24, 10,
+    206, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 209, 8, 0, 42,
+    57, 255, 255, 255, 255, 255, 255, 255, 255, 251, 28, 0, 52, 146, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 66, 0, 27, 11, 211,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 230, 15, 0, 23,
+    16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 94, 0, 27, 2, 170, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 198, 8, 0, 30, 14, 234, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 178, 0, 28, 7, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 3, 0, 144, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 60, 22, 232, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 121, 0, 28, 158, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 74, 0, 26, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 32, 0, 29, 239, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 159, 0, 21, 198, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 239, 32, 0, 24, 109, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 112, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 32, 0, 255, 0, 255, 0, 169, 18, 225, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 182, 3, 0, 20, 90, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 93, 0, 51, 143, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 0, 45, 158, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 223, 0, 21, 64, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    248, 80, 0, 29, 71, 243, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 83, 0, 57, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 48, 0, 33, 32, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 243, 55, 0, 27, 64, 246, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 112, 0, 32, 142, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 149, 0, 23, 2, 172, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 245, 39, 0, 43, 164, 255, 255, 255, 255, 255, 255, 255, 255,
+    172, 0, 53, 12, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 239, 49, 0, 25, 8, 184, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 82, 0, 24, 16, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 241, 40, 0, 25, 7, 164, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    224, 22, 0, 31, 107, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 40, 0, 27, 17, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 221, 0, 145, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    159, 0, 61, 60, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    91, 0, 26, 136, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 27,
+    96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 29, 239,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 21, 77, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 18, 0, 22, 81,
+    253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112,
+    0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0,
+    28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 255,
+    0, 255, 0, 170, 57, 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    159, 1, 0, 18, 71, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    158, 0, 52, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    0, 44, 158, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 223, 0, 21, 64,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 122, 0, 27,
+    107, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 138,
+    0, 58, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48,
+    0, 33, 32, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 244,
+    82, 0, 25, 91, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 165, 0, 33, 3, 187, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 146, 0, 21, 5, 169, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 252, 78, 0, 43, 22, 249, 255, 255, 255, 255, 255, 255, 255, 255, 65,
+    0, 54, 51, 246, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    240, 62, 0, 23, 17, 189, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 142, 0, 25, 16, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 223, 34, 0, 23, 26, 201, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    238, 43, 0, 32, 182, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 117, 0, 27, 33, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 182, 0, 145, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    159, 0, 62, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    107, 0, 23, 5, 154, 255, 255, 255, 255, 255, 255, 255, 255, 255, 220, 14,
+    0, 27, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0,
+    29, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 22, 190,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 211, 30, 0,
+    20, 98, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 112, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    32, 0, 255, 0, 255, 0, 171, 94, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 179, 12, 0, 16, 99, 251, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 191, 9, 0, 52, 143, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 0, 43, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 223, 0, 21, 64, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 194, 45, 0, 23, 28, 182, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 168, 0, 59, 80, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 48, 0, 33, 32, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 150, 14, 0, 21, 16, 158, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 175, 4, 0, 34,
+    18, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 181, 17, 0,
+    18, 29, 197, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 96,
+    0, 44, 123, 255, 255, 255, 255, 255, 255, 255, 255, 213, 0, 56, 86, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 122, 3, 0,
+    20, 60, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    185, 3, 0, 25, 16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    233, 61, 0, 21, 103, 236, 255, 255, 255, 255, 255, 255, 255, 255, 255, 230,
+    43, 0, 33, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 159, 0, 27, 55, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 136, 0, 145, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159,
+    0, 63, 125, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 168,
+    15, 0, 20, 39, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 242, 40,
+    0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0,
+    29, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 22, 38,
+    246, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 236, 84,
+    0, 17, 17, 159, 255, 255, 255, 255, 255, 252, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 112, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 32, 0, 28, 96, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 32, 0, 255, 0, 255, 0, 172, 109, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 221, 70, 0, 13, 24, 171, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 202, 12, 0, 37, 155, 191, 191, 191, 191,
+    191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 227, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 191, 191, 191, 191, 191, 191, 191, 191,
+    191, 191, 191, 191, 191, 191, 191, 191, 48, 0, 25, 76, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 223, 0, 21, 64, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 165, 49, 0, 19, 29,
+    141, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    163, 5, 0, 44, 60, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+    191, 191, 191, 211, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    203, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 36,
+    0, 18, 32, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 234, 116, 13, 0, 17, 9, 114, 232, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 177, 7, 0, 36, 29, 218, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 232, 97, 0, 15, 6, 117, 239, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 103, 0, 44, 4, 226,
+    255, 255, 255, 255, 255, 255, 255, 255, 106, 0, 57, 96, 254, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 80, 0, 17, 34, 163,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 186, 10,
+    0, 26, 16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    146, 21, 0, 17, 90, 204, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    222, 35, 0, 34, 236, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 172, 0, 27, 84, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 87, 0, 145, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    159, 0, 64, 120, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    234, 111, 4, 0, 16, 24, 140, 250, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 246, 66, 0, 19, 143, 191, 191, 191, 191, 191, 191, 191, 191, 191, 215,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 199, 191, 191, 191, 191,
+    191, 191, 191, 191, 191, 24, 0, 9, 167, 191, 191, 191, 191, 191, 191, 191,
+    191, 191, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 231, 191, 191,
+    191, 191, 191, 191, 191, 191, 191, 167, 0, 13, 94, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 193, 72, 0, 13, 16, 116,
+    236, 255, 255, 255, 255, 255, 255, 103, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 219, 191, 191, 191, 191, 191, 191, 191, 191, 191, 131, 0, 7,
+    72, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 215, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 199, 191, 191, 191, 191, 191, 191, 191, 191,
+    191, 191, 0, 7, 72, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 215,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 199, 191, 191, 191, 191,
+    191, 191, 191, 191, 191, 191, 191, 191, 191, 167, 0, 255, 0, 255, 0, 159,
+    119, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 185, 85, 0,
+    9, 38, 151, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208,
+    17, 0, 38, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    64, 0, 25, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 223,
+    0, 21, 64, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 216, 132, 61, 0, 13, 26, 99, 178, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 137, 0, 46,
+    80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 18, 32, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    246, 160, 85, 15, 0, 11, 3, 72, 155, 238, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 142, 1, 0, 38, 25, 214, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 223, 114, 33, 0, 10, 44,
+    134, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 245, 79,
+    0, 45, 82, 255, 255, 255, 255, 255, 255, 255, 255, 241, 13, 0, 58, 87,
+    248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 219,
+    123, 40, 0, 11, 16, 93, 177, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 175, 8, 0, 27, 16, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 155, 67, 0, 12, 71, 142,
+    229, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 195, 25, 0, 35,
+    223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    159, 0, 27, 119, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 27,
+    0, 145, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 65, 108,
+    253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 235, 148, 58,
+    0, 11, 12, 82, 166, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    245, 67, 0, 20, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 32, 0, 9, 223, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 223, 0, 14, 137, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 222, 148, 81, 34, 0, 6,
+    55, 104, 171, 249, 255, 255, 255, 255, 255, 255, 255, 106, 16, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 175, 0, 7, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 0, 7, 96, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 223, 0,
+    255, 0, 255, 0, 160, 88, 246, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 248, 191, 128, 128, 128, 128, 128, 167, 224, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 174, 11, 0, 39, 207, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 64, 0, 25, 80, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 223, 0, 21, 32, 216, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 206, 183, 128, 128, 128, 128, 128, 128, 128, 138, 191, 230, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    235, 77, 0, 47, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 48,
+    0, 18, 16, 198, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 218, 188, 128, 128, 128, 128, 128, 128,
+    128, 168, 197, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 241, 95, 0, 41, 19, 187, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 218, 179, 128, 128, 128, 128, 128, 128, 191,
+    230, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 219,
+    52, 0, 46, 188, 255, 255, 255, 255, 255, 255, 255, 255, 147, 0, 60, 50,
+    221, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 239, 191, 140, 128, 128, 128, 128, 128, 128, 180, 215, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 122, 0, 29,
+    16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 247, 191, 142, 128, 128, 128, 128, 128, 128, 172, 198, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 128, 1, 0, 36, 182,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 115,
+    0, 27, 162, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 220, 0, 146,
+    96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 66, 62, 235, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 248, 191, 154,
+    128, 128, 128, 128, 128, 128, 164, 205, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 227, 50, 0, 21, 191, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 0, 9, 223, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 223, 0, 15, 143, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 254, 100, 0, 1, 16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 175, 0, 7, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    0, 7, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 223, 0, 255, 0, 255, 0, 161, 51, 228,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    130, 0, 41, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    64, 0, 25, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 223,
+    0, 23, 73, 177, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 171, 22, 0, 48, 80, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 48, 0, 20, 52, 160, 248, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 186, 28, 0, 44, 124, 254, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 156, 12, 0, 46,
+    40, 255, 255, 255, 255, 255, 255, 255, 255, 255, 40, 0, 61, 15, 157, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 216, 62, 0, 30, 16, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 219, 61, 0, 38, 106, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 254, 36, 0, 27, 214, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 146, 0, 146, 96, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 159, 0, 67, 27, 187, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 184, 21, 0,
+    22, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 32, 0, 9, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 223, 0, 16, 112, 253, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 240, 73, 0, 2, 16, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 175, 0, 7, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 0, 7, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 223, 0, 255,
+    0, 255, 0, 162, 15, 146, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 210, 57, 0, 42, 207, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 64, 0, 25, 80, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 223, 0, 25, 30, 127, 222, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 196, 57, 0, 50, 80, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 48, 0, 22, 17, 103, 207, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 216,
+    84, 0, 47, 57, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 205, 65, 0, 48, 147, 255, 255, 255, 255, 255, 255,
+    255, 255, 188, 0, 64, 56, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 241, 119, 4, 0,
+    31, 16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 235, 110, 2, 0, 39, 13, 233, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 170, 0, 27, 19,
+    254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 67, 0, 146, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 159, 0, 69, 87, 233, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 234, 97, 0,
+    24, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 32, 0, 9, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 223, 0, 17, 64, 224, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 196, 32, 0, 3, 16, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 175,
+    0, 7, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 0, 7, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 223, 0, 255, 0, 255,
+    0, 164, 55, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 236, 121, 3,
+    0, 43, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 64,
+    0, 25, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 223, 0,
+    28, 54, 147, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 254, 164, 57, 0, 52, 80, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 48, 0, 25, 37, 125, 213, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    209, 91, 0, 51, 91, 229, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 212, 90, 0, 49, 13, 241, 255, 255, 255, 255, 255, 255, 255, 255,
+    81, 0, 66, 70, 187, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 230, 118, 15, 0, 34, 61, 146, 220, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 229,
+    127, 15, 0, 42, 84, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 231, 25, 0, 27, 88, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    230, 4, 0, 146, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0,
+    70, 14, 119, 232, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    238, 128, 13, 0, 25, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 32, 0, 9, 223, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 223, 0, 18, 11, 137, 247, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 233, 103, 0, 5, 16, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    175, 0, 7, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 0, 7, 96, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 223, 0, 255, 0,
+    255, 0, 166, 59, 173, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 223, 105, 9, 0, 45, 207,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 64, 0, 25, 80,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 223, 0, 31, 44, 118,
+    186, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    183, 102, 24, 0, 54, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    48, 0, 28, 32, 107, 176, 245, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 230, 152, 45, 0, 55, 86, 185, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    245, 166, 62, 0, 51, 106, 255, 255, 255, 255, 255, 255, 255, 255, 225, 3,
+    0, 68, 38, 130, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    246, 164, 83, 1, 0, 39, 37, 108, 174, 238, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 179, 83, 0, 46, 114, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 235, 46, 0, 28, 166, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 137, 0, 147, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    159, 0, 72, 7, 101, 197, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 205, 100,
+    9, 0, 27, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 32, 0, 9, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 223, 0, 20, 24, 142, 235, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    223, 113, 11, 0, 6, 16, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 175, 0, 7, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    0, 7, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 223, 0, 255, 0, 255, 0, 168, 27, 102,
+    177, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    214, 139, 53, 0, 215, 59, 115, 166, 206, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 248, 191,
+    131, 72, 13, 0, 133, 52, 111, 165, 208, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 233, 188, 117, 46,
+    0, 60, 34, 105, 174, 243, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 205, 154, 79, 3, 0, 135, 40, 105, 169, 225,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 251, 191, 131, 67, 3, 0, 46, 43, 98, 147, 191, 251, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 218, 150, 82, 14, 0, 49, 75, 230, 255, 255, 255, 255, 255, 255, 255,
+    186, 28, 0, 28, 12, 244, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252,
+    36, 0, 233, 30, 111, 179, 238, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 236, 175, 109, 30, 0, 126, 3, 88, 159,
+    230, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    219, 151, 65, 0, 255, 0, 255, 0, 255, 0, 35, 54, 89, 128, 178, 191,
+    191, 191, 191, 191, 191, 139, 114, 64, 16, 0, 223, 41, 64, 110, 128, 133,
+    191, 191, 191, 191, 191, 191, 191, 191, 191, 178, 128, 128, 106, 64, 17, 0,
+    143, 49, 64, 127, 128, 164, 191, 191, 191, 191, 191, 191, 191, 191, 147, 128,
+    107, 64, 21, 0, 68, 48, 71, 128, 158, 191, 191, 191, 191, 191, 191, 191,
+    152, 128, 95, 64, 2, 0, 143, 3, 64, 97, 128, 128, 183, 191, 191, 191,
+    191, 191, 191, 191, 191, 144, 128, 123, 64, 29, 0, 56, 24, 64, 97, 128,
+    130, 191, 191, 191, 191, 191, 191, 191, 191, 153, 128, 88, 64, 3, 0, 54,
+    5, 90, 159, 191, 191, 191, 139, 51, 0, 30, 106, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 171, 0, 238, 43, 69, 128, 141, 191, 191, 191, 191,
+    191, 191, 191, 170, 128, 124, 64, 31, 0, 134, 31, 75, 128, 137, 191, 191,
+    191, 191, 191, 191, 191, 136, 128, 65, 23, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 102, 3, 217, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 254, 48, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 250, 96, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 163,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 250,
+    13, 230, 255, 255, 255, 255, 255, 255, 255, 255, 255, 242, 28, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 250, 151, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 107, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 250, 77, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 187, 1, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 249, 38, 241, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 230, 23, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 249, 25, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 55,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 249,
+    24, 214, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 84, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 249, 36, 218, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 97, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 0, 249, 63, 237, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 254, 99, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 249, 31, 249, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 248, 83, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 251, 84, 251, 255, 255, 255, 255, 255, 255, 255, 232, 55, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 253, 84,
+    251, 255, 255, 255, 255, 255, 198, 26, 0, 255, 0, 255, 0, 255, 0, 255,
+    0, 255, 0, 255, 0, 255, 0, 255, 84, 251, 255, 255, 255, 131, 2, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    2, 84, 251, 214, 57, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 5, 54, 7, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+    255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 98,
+};
+
+} // namespace glyph_atlas
@@ -0,0 +1,60 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef GLYPH_ATLAS_H_
+#define GLYPH_ATLAS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+
+/**
+ * Font atlas with the characters used to draw pixel values, rasterized ahead
+ * of time by tools/generate_glyph_atlas.py. The metrics of each character are
+ * given in the order of 'characters', in pixels.
+ */
+namespace glyph_atlas
+{
+
+const int num_characters = 20;
+
+extern const char characters[];
+
+extern const int texture_width;
+extern const int texture_height;
+
+extern const int offsets[num_characters][2];
+extern const int advances[num_characters][2];
+extern const int sizes[num_characters][2];
+extern const int tls[num_characters][2];
+
+// Single channel texture where each run of zeros is stored as a zero followed
+// by the length of the run
+extern const size_t compressed_texture_size;
+extern const uint8_t compressed_texture[];
+
+} // namespace glyph_atlas
+
+#endif // GLYPH_ATLAS_H_
@@ -0,0 +1,385 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include <cstdio>
+#include <iostream>
+
+#include <QCoreApplication>
+#include <QKeyEvent>
+
+#include "interaction_benchmark.h"
+
+#include "main_window/main_window.h"
+#include "profiling/tracer.h"
+#include "ui_main_window.h"
+#include "visualization/components/camera.h"
+#include "visualization/events.h"
+#include "visualization/game_object.h"
+
+
+using namespace std;
+
+
+// Inputs that don't produce a frame within this time are counted as missed
+static const int frame_timeout_ms = 1000;
+
+
+InteractionBenchmark::InteractionBenchmark(MainWindow* main_window,
+                                           const string& report_path)
+    : main_window_(main_window)
+    , report_path_(report_path)
+    , current_scenario_(0)
+    , current_event_(0)
+    , waiting_frame_(false)
+    , held_key_(0)
+    , event_begin_us_(0)
+    , last_present_us_(0)
+    , initial_link_views_enabled_(false)
+    , is_running_(false)
+{
+    const struct
+    {
+        const char* name;
+        bool link_views;
+        bool high_zoom;
+    } scenario_descriptions[] = {{"single_stage", false, false},
+                                 {"single_stage_high_zoom", false, true},
+                                 {"link_views", true, false},
+                                 {"link_views_high_zoom", true, true}};
+
+    for (const auto& description : scenario_descriptions) {
+        Scenario scenario;
+        scenario.name          = description.name;
+        scenario.link_views    = description.link_views;
+        scenario.high_zoom     = description.high_zoom;
+        scenario.events        = recorded_input_sequence();
+        scenario.missed_frames = 0;
+
+        scenarios_.push_back(scenario);
+    }
+
+    frame_timeout_timer_.setSingleShot(true);
+    connect(&frame_timeout_timer_,
+            SIGNAL(timeout()),
+            this,
+            SLOT(frame_timeout()));
+}
+
+
+vector<InteractionBenchmark::InputEvent>
+InteractionBenchmark::recorded_input_sequence()
+{
+    using Type = InputEvent::Type;
+
+    vector<InputEvent> events;
+
+    // The sequence is balanced (it zooms and pans back to where it started),
+    // so the high zoom scenarios stay above the BufferValues threshold
+    for (int i = 0; i < 10; ++i) {
+        events.push_back({Type::Wheel, 0.f, 0.5f});
+    }
+    for (int i = 0; i < 10; ++i) {
+        events.push_back({Type::Wheel, 0.f, -0.5f});
+    }
+    for (int i = 0; i < 30; ++i) {
+        events.push_back({Type::Drag, 12.f, 5.f});
+    }
+    for (int i = 0; i < 30; ++i) {
+        events.push_back({Type::Drag, -12.f, -5.f});
+    }
+    for (int i = 0; i < 5; ++i) {
+        events.push_back({Type::KeyZoomIn, 0.f, 0.f});
+    }
+    for (int i = 0; i < 5; ++i) {
+        events.push_back({Type::KeyZoomOut, 0.f, 0.f});
+    }
+    for (int i = 0; i < 10; ++i) {
+        events.push_back({Type::KeyPan, 1.f, 0.f});
+    }
+    for (int i = 0; i < 10; ++i) {
+        events.push_back({Type::KeyPan, -1.f, 0.f});
+    }
+
+    return events;
+}
+
+
+void InteractionBenchmark::start()
+{
+    is_running_                 = true;
+    initial_link_views_enabled_ = main_window_->link_views_enabled_;
+
+    connect(main_window_->gl_canvas(),
+            SIGNAL(frameSwapped()),
+            this,
+            SLOT(frame_presented()));
+
+    current_scenario_ = 0;
+    start_scenario();
+}
+
+
+bool InteractionBenchmark::is_running() const
+{
+    return is_running_;
+}
+
+
+void InteractionBenchmark::start_scenario()
+{
+    if (current_scenario_ >= scenarios_.size()) {
+        finish();
+        return;
+    }
+
+    prepare_stages(scenarios_[current_scenario_]);
+
+    current_event_   = 0;
+    last_present_us_ = 0;
+
+    // Let the stage settle before the first input
+    QTimer::singleShot(frame_timeout_ms, this, SLOT(inject_next_event()));
+}
+
+
+void InteractionBenchmark::prepare_stages(const Scenario& scenario)
+{
+    if (main_window_->link_views_enabled_ != scenario.link_views) {
+        main_window_->link_views_toggle();
+    }
+
+    main_window_->ui_->imageList->setCurrentRow(0);
+    main_window_->recenter_buffer();
+
+    if (scenario.high_zoom && main_window_->currently_selected_stage_) {
+        Camera* camera =
+            main_window_->currently_selected_stage_->get_game_object("camera")
+                ->get_component<Camera>("camera_component");
+
+        // Zoom in around the center of the view, like Ctrl+Plus does
+        for (int i = 0; i < 100 && camera->compute_zoom() <= 40.f; ++i) {
+            send_key(Qt::Key_Plus, true);
+            send_key(Qt::Key_Plus, false);
+        }
+    }
+
+    main_window_->request_render_update();
+}
+
+
+void InteractionBenchmark::send_key(int key, bool press)
+{
+    KeyboardState::simulated_modifiers_ = Qt::ControlModifier;
+
+    QKeyEvent event(press ? QEvent::KeyPress : QEvent::KeyRelease,
+                    key,
+                    Qt::ControlModifier);
+    QCoreApplication::sendEvent(main_window_, &event);
+
+    if (!press) {
+        KeyboardState::simulated_modifiers_ = 0;
+    }
+}
+
+
+void InteractionBenchmark::apply_event(const InputEvent& event)
+{
+    using Type = InputEvent::Type;
+
+    switch (event.type) {
+    case Type::Wheel:
+        main_window_->scroll_callback(event.y);
+        break;
+    case Type::Drag:
+        main_window_->mouse_drag_event(event.x, event.y);
+        break;
+    case Type::KeyZoomIn:
+        send_key(Qt::Key_Plus, true);
+        send_key(Qt::Key_Plus, false);
+        break;
+    case Type::KeyZoomOut:
+        send_key(Qt::Key_Minus, true);
+        send_key(Qt::Key_Minus, false);
+        break;
+    case Type::KeyPan:
+        // The key is kept pressed until the frame is presented, so that
+        // Camera::handle_key_events() sees it in the next update
+        held_key_ = event.x > 0 ? Qt::Key_Right : Qt::Key_Left;
+        send_key(held_key_, true);
+        break;
+    }
+}
+
+
+void InteractionBenchmark::inject_next_event()
+{
+    Scenario& scenario = scenarios_[current_scenario_];
+
+    if (current_event_ >= scenario.events.size()) {
+        ++current_scenario_;
+        start_scenario();
+        return;
+    }
+
+    waiting_frame_  = true;
+    event_begin_us_ = Tracer::now_us();
+
+    apply_event(scenario.events[current_event_]);
+
+    frame_timeout_timer_.start(frame_timeout_ms);
+}
+
+
+void InteractionBenchmark::frame_presented()
+{
+    if (!waiting_frame_) {
+        return;
+    }
+
+    Scenario& scenario       = scenarios_[current_scenario_];
+    const uint64_t present_us = Tracer::now_us();
+
+    scenario.latency_us.add(present_us - event_begin_us_);
+    if (last_present_us_ != 0) {
+        scenario.frame_time_us.add(present_us - last_present_us_);
+    }
+    last_present_us_ = present_us;
+
+    finish_event(true);
+}
+
+
+void InteractionBenchmark::frame_timeout()
+{
+    if (waiting_frame_) {
+        finish_event(false);
+    }
+}
+
+
+void InteractionBenchmark::finish_event(bool presented)
+{
+    waiting_frame_ = false;
+    frame_timeout_timer_.stop();
+
+    if (held_key_ != 0) {
+        send_key(held_key_, false);
+        held_key_ = 0;
+    }
+
+    if (!presented) {
+        scenarios_[current_scenario_].missed_frames++;
+        last_present_us_ = 0;
+    }
+
+    ++current_event_;
+
+    // Inject the next input from the event loop, after Qt is done with the
+    // current frame
+    QTimer::singleShot(0, this, SLOT(inject_next_event()));
+}
+
+
+void InteractionBenchmark::finish()
+{
+    disconnect(main_window_->gl_canvas(),
+               SIGNAL(frameSwapped()),
+               this,
+               SLOT(frame_presented()));
+
+    if (main_window_->link_views_enabled_ != initial_link_views_enabled_) {
+        main_window_->link_views_toggle();
+    }
+    main_window_->recenter_buffer();
+
+    write_report();
+
+    is_running_ = false;
+}
+
+
+static void write_histogram(FILE* output, const Metrics::Histogram& histogram)
+{
+    const double mean =
+        histogram.count > 0
+            ? static_cast<double>(histogram.sum) / histogram.count
+            : 0.0;
+
+    fprintf(output,
+            "{\"count\":%llu,\"mean\":%.1f,\"p50\":%llu,\"p90\":%llu,"
+            "\"p99\":%llu,\"max\":%llu}",
+            static_cast<unsigned long long>(histogram.count),
+            mean,
+            static_cast<unsigned long long>(histogram.quantile(0.50)),
+            static_cast<unsigned long long>(histogram.quantile(0.90)),
+            static_cast<unsigned long long>(histogram.quantile(0.99)),
+            static_cast<unsigned long long>(histogram.max));
+}
+
+
+void InteractionBenchmark::write_report()
+{
+    const size_t num_stages = main_window_->stages_.size();
+
+    for (const auto& scenario : scenarios_) {
+        cout << "[gdb-imagewatch] " << scenario.name << " (" << num_stages
+             << " stages): input to present p50="
+             << scenario.latency_us.quantile(0.5)
+             << "us p99=" << scenario.latency_us.quantile(0.99)
+             << "us, frame time p50=" << scenario.frame_time_us.quantile(0.5)
+             << "us, missed frames=" << scenario.missed_frames << endl;
+    }
+
+    FILE* output = fopen(report_path_.c_str(), "w");
+    if (output == nullptr) {
+        cerr << "[gdb-imagewatch] Could not write benchmark report to "
+             << report_path_ << endl;
+        return;
+    }
+
+    fprintf(output, "{\"stages\":%zu,\"scenarios\":[", num_stages);
+
+    for (size_t i = 0; i < scenarios_.size(); ++i) {
+        const Scenario& scenario = scenarios_[i];
+
+        fprintf(output,
+                "%s\n{\"name\":\"%s\",\"link_views\":%s,\"high_zoom\":%s,"
+                "\"inputs\":%zu,\"missed_frames\":%d,"
+                "\"input_to_present_us\":",
+                i == 0 ? "" : ",",
+                scenario.name.c_str(),
+                scenario.link_views ? "true" : "false",
+                scenario.high_zoom ? "true" : "false",
+                scenario.events.size(),
+                scenario.missed_frames);
+        write_histogram(output, scenario.latency_us);
+        fputs(",\"frame_time_us\":", output);
+        write_histogram(output, scenario.frame_time_us);
+        fputs("}", output);
+    }
+
+    fputs("\n]}\n", output);
+    fclose(output);
+}
@@ -0,0 +1,130 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef INTERACTION_BENCHMARK_H_
+#define INTERACTION_BENCHMARK_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <QObject>
+#include <QTimer>
+
+#include "profiling/metrics.h"
+
+
+class MainWindow;
+
+
+/**
+ * Replays a fixed sequence of wheel, drag and keyboard events on the stages
+ * of a MainWindow and measures the time from each input until the
+ * corresponding frame is presented (GLCanvas::frameSwapped), as well as the
+ * interval between presented frames.
+ *
+ * The benchmark runs in the GUI thread, driven by the Qt event loop. Each
+ * input is only injected after the frame of the previous one was presented
+ * (or after a timeout, in which case it is counted as a missed frame).
+ */
+class InteractionBenchmark : public QObject
+{
+    Q_OBJECT
+
+  public:
+    InteractionBenchmark(MainWindow* main_window,
+                         const std::string& report_path);
+
+    void start();
+
+    bool is_running() const;
+
+  private Q_SLOTS:
+    void inject_next_event();
+
+    void frame_presented();
+
+    void frame_timeout();
+
+  private:
+    struct InputEvent
+    {
+        enum class Type { Wheel, Drag, KeyZoomIn, KeyZoomOut, KeyPan };
+
+        Type type;
+        float x;
+        float y;
+    };
+
+    struct Scenario
+    {
+        std::string name;
+        bool link_views;
+        // Zoom in until BufferValues labels are drawn (zoom > 40)
+        bool high_zoom;
+        std::vector<InputEvent> events;
+
+        Metrics::Histogram latency_us;
+        Metrics::Histogram frame_time_us;
+        int missed_frames;
+    };
+
+    MainWindow* main_window_;
+    std::string report_path_;
+
+    std::vector<Scenario> scenarios_;
+    size_t current_scenario_;
+    size_t current_event_;
+
+    bool waiting_frame_;
+    int held_key_;
+    uint64_t event_begin_us_;
+    uint64_t last_present_us_;
+
+    bool initial_link_views_enabled_;
+
+    QTimer frame_timeout_timer_;
+
+    std::atomic<bool> is_running_;
+
+    static std::vector<InputEvent> recorded_input_sequence();
+
+    void start_scenario();
+
+    void prepare_stages(const Scenario& scenario);
+
+    void apply_event(const InputEvent& event);
+
+    void send_key(int key, bool press);
+
+    void finish_event(bool presented);
+
+    void finish();
+
+    void write_report();
+};
+
+#endif // INTERACTION_BENCHMARK_H_
@@ -56,6 +56,20 @@ void MainWindow::initialize_settings()
         render_framerate_ = 1.0;
     }
 
+    // Load renderer, which is selected when OpenGL is initialized
+    renderer_ = settings.value("Rendering/renderer", "auto")
+                    .value<QString>()
+                    .toLower();
+    if (renderer_ == "software") {
+        ui_->bufferPreview->set_requested_renderer(
+            GLCanvas::Renderer::Software);
+    } else if (renderer_ == "opengl") {
+        ui_->bufferPreview->set_requested_renderer(GLCanvas::Renderer::OpenGL);
+    } else {
+        renderer_ = "auto";
+        ui_->bufferPreview->set_requested_renderer(GLCanvas::Renderer::Auto);
+    }
+
     // Default save suffix: Image
     if (settings.contains("Export/default_export_suffix")) {
         default_export_suffix_ =
@@ -76,6 +90,10 @@ void MainWindow::initialize_settings()
                 previous_buffer.first.toStdString());
         }
     }
+    previous_session_selected_buffer_ =
+        settings.value("PreviousSession/selected_buffer")
+            .toString()
+            .toStdString();
 
     // Load window position/size
     settings.beginGroup("MainWindow");
@@ -178,6 +196,13 @@ void MainWindow::initialize_shortcuts()
             SIGNAL(go_to_requested(float, float)),
             this,
             SLOT(go_to_pixel(float, float)));
+
+    QShortcut* memory_usage_shortcut =
+        new QShortcut(QKeySequence(Qt::CTRL | Qt::SHIFT | Qt::Key_M), this);
+    connect(memory_usage_shortcut,
+            SIGNAL(activated()),
+            memory_usage_panel_->toggleViewAction(),
+            SLOT(trigger()));
 }
 
 
@@ -308,3 +333,11 @@ void MainWindow::initialize_go_to_widget()
 {
     go_to_widget_ = new GoToWidget(ui_->bufferPreview);
 }
+
+
+void MainWindow::initialize_memory_usage_panel()
+{
+    memory_usage_panel_ = new MemoryUsagePanel(this);
+    addDockWidget(Qt::BottomDockWidgetArea, memory_usage_panel_);
+    memory_usage_panel_->hide();
+}
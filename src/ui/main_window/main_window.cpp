@@ -23,17 +23,19 @@
  * IN THE SOFTWARE.
  */
 
+#include <algorithm>
 #include <iomanip>
 
 #include <QAction>
-#include <QDateTime>
+#include <QPainter>
 #include <QScreen>
-#include <QSettings>
 
 #include "main_window.h"
 
 #include "debuggerinterface/managed_pointer.h"
-#include "debuggerinterface/python_native_interface.h"
+#include "io/plot_capture.h"
+#include "profiling/metrics.h"
+#include "profiling/tracer.h"
 #include "ui_main_window.h"
 #include "visualization/components/camera.h"
 #include "visualization/game_object.h"
@@ -49,14 +51,21 @@ MainWindow::MainWindow(QWidget* parent)
     : QMainWindow(parent)
     , is_window_ready_(false)
     , request_render_update_(true)
-    , completer_updated_(false)
     , ac_enabled_(true)
     , link_views_enabled_(false)
     , icon_width_base_(100)
     , icon_height_base_(50)
     , currently_selected_stage_(nullptr)
+    , memory_high_water_mark_(0)
+    , restore_started_us_(0)
+    , restore_in_flight_since_us_(0)
+    , restore_begin_us_(0)
+    , restore_first_buffer_pending_(false)
+    , restore_first_frame_begin_us_(0)
+    , stale_badges_outdated_(false)
     , ui_(new Ui::MainWindowUi)
     , plot_callback_(nullptr)
+    , region_callback_(nullptr)
 {
     QCoreApplication::instance()->installEventFilter(this);
 
@@ -72,6 +81,7 @@ MainWindow::MainWindow(QWidget* parent)
     initialize_visualization_pane();
     initialize_settings();
     initialize_go_to_widget();
+    initialize_memory_usage_panel();
     initialize_shortcuts();
 
     is_window_ready_ = true;
@@ -80,6 +90,8 @@ MainWindow::MainWindow(QWidget* parent)
 
 MainWindow::~MainWindow()
 {
+    tasks_token_.cancel();
+
     held_buffers_.clear();
     is_window_ready_ = false;
 
@@ -98,6 +110,16 @@ void MainWindow::draw()
 {
     if (currently_selected_stage_ != nullptr) {
         currently_selected_stage_->draw();
+
+        if (restore_first_frame_begin_us_ != 0) {
+            // First frame in which a restored buffer can be inspected
+            const uint64_t now_us = Tracer::now_us();
+            Tracer::record_span(
+                "restore_first_frame", restore_first_frame_begin_us_, now_us);
+            Metrics::record_latency("restore_first_frame",
+                                    now_us - restore_first_frame_begin_us_);
+            restore_first_frame_begin_us_ = 0;
+        }
     }
 }
 
@@ -122,10 +144,78 @@ void MainWindow::set_plot_callback(int (*plot_cbk)(const char*))
 }
 
 
+void MainWindow::set_region_callback(
+    int (*region_cbk)(const char*, int, int, int, int, int))
+{
+    region_callback_ = region_cbk;
+}
+
+
 void MainWindow::plot_buffer(const BufferRequestMessage& buffer_metadata)
 {
+    Metrics::add_to_counter("plot_requests", 1);
+
+    if (buffer_metadata.has_dirty_rows) {
+        // Only the modified rows were read from the debuggee
+        const size_t row_size =
+            buffer_metadata.height_i > 0
+                ? buffer_metadata.buffer_size / buffer_metadata.height_i
+                : 0;
+        uint64_t num_dirty_rows = 0;
+        for (const auto& rows : buffer_metadata.dirty_rows) {
+            num_dirty_rows += rows.second - rows.first;
+        }
+        Metrics::add_to_counter("bytes_fetched", num_dirty_rows * row_size);
+    } else {
+        Metrics::add_to_counter("bytes_fetched", buffer_metadata.buffer_size);
+    }
+
+    // Regions only make sense along with the debugger that provided them
+    if (!buffer_metadata.is_region) {
+        PlotCapture::record(buffer_metadata);
+    }
+
     std::unique_lock<std::mutex> lock(ui_mutex_);
     pending_updates_.push_back(buffer_metadata);
+    pending_updates_.back().queued_at_us = Tracer::now_us();
+
+    if (buffer_metadata.type == Buffer::BufferType::Float64) {
+        start_float_conversion(pending_updates_.back());
+    }
+
+    Metrics::set_gauge("queue_depth", pending_updates_.size());
+    Metrics::record_sample("queue_depth", pending_updates_.size());
+}
+
+
+void MainWindow::start_float_conversion(BufferRequestMessage& request)
+{
+    auto float_copy    = make_shared<BufferRequestMessage::FloatCopy>();
+    float_copy->ready  = false;
+    request.float_copy = float_copy;
+
+    // The task keeps the source buffer alive, in case the request is dropped
+    // before the conversion finishes
+    const shared_ptr<uint8_t> source = request.managed_buffer;
+    double* source_ptr = reinterpret_cast<double*>(request.buffer_ptr);
+    const int num_elements =
+        request.width_i * request.height_i * request.channels;
+
+    TaskScheduler::instance().submit(
+        [float_copy, source, source_ptr, num_elements]() {
+            float_copy->data =
+                make_float_buffer_from_double(source_ptr, num_elements);
+        },
+        TaskPriority::High,
+        tasks_token_,
+        [float_copy]() { float_copy->ready = true; });
+}
+
+
+size_t MainWindow::get_pending_update_count()
+{
+    std::unique_lock<std::mutex> lock(ui_mutex_);
+    return pending_updates_.size();
 }
 
 
@@ -141,6 +231,41 @@ deque<string> MainWindow::get_observed_symbols()
 }
 
 
+deque<string> MainWindow::get_buffers_to_refresh()
+{
+    const deque<string> observed_names = get_observed_symbols();
+    deque<string> refreshed_names;
+
+    std::unique_lock<std::mutex> lock(ui_mutex_);
+
+    for (const auto& name : observed_names) {
+        BufferRefreshState& state = refresh_states_[name];
+
+        bool is_due = false;
+        if (state.policy == RefreshPolicy::EveryStop) {
+            is_due = true;
+        } else if (state.policy == RefreshPolicy::WhenSelected) {
+            is_due = name == selected_buffer_name_;
+        } else if (state.policy == RefreshPolicy::EveryNthStop) {
+            is_due = state.stale_stops + 1 >= state.period;
+        }
+
+        if (is_due) {
+            refreshed_names.push_back(name);
+        } else {
+            // The buffer is refreshed later, when its policy allows it
+            ++state.stale_stops;
+            stale_badges_outdated_ = true;
+        }
+    }
+
+    Metrics::add_to_counter("skipped_refreshes",
+                            observed_names.size() - refreshed_names.size());
+
+    return refreshed_names;
+}
+
+
 bool MainWindow::is_window_ready()
 {
     return ui_->bufferPreview->is_ready() && is_window_ready_;
@@ -151,20 +276,103 @@ void MainWindow::set_available_symbols(const deque<string>& available_vars)
 {
     std::unique_lock<std::mutex> lock(ui_mutex_);
 
-    available_vars_.clear();
+    const set<string> available_set(available_vars.begin(),
+                                    available_vars.end());
 
-    for (const auto& var_name : available_vars) {
-        // Add symbol name to autocomplete list
-        available_vars_.push_back(var_name.c_str());
+    deque<string> removed_vars;
+    for (const auto& var_name : available_symbols_) {
+        if (available_set.find(var_name) == available_set.end()) {
+            removed_vars.push_back(var_name);
+        }
+    }
 
-        // Plot buffer if it was available in the previous session
-        if (previous_session_buffers_.find(var_name) !=
-            previous_session_buffers_.end()) {
-            plot_callback_(var_name.c_str());
+    for (const auto& var_name : removed_vars) {
+        remove_available_symbol(var_name);
+    }
+
+    for (const auto& var_name : available_set) {
+        add_available_symbol(var_name);
+    }
+}
+
+
+void MainWindow::update_available_symbols(const deque<string>& added_vars,
+                                          const deque<string>& removed_vars)
+{
+    std::unique_lock<std::mutex> lock(ui_mutex_);
+
+    for (const auto& var_name : removed_vars) {
+        remove_available_symbol(var_name);
+    }
+
+    for (const auto& var_name : added_vars) {
+        add_available_symbol(var_name);
+    }
+}
+
+
+void MainWindow::add_available_symbol(const string& var_name)
+{
+    if (!available_symbols_.insert(var_name).second) {
+        return;
+    }
+
+    // Add symbol name to autocomplete list, unless its removal is still
+    // pending
+    const QString symbol = QString::fromStdString(var_name);
+    if (!removed_symbols_.removeOne(symbol)) {
+        added_symbols_.append(symbol);
+    }
+
+    // Restore buffer if it was available in the previous session. The
+    // buffer is only fetched later by loop(), after a placeholder item was
+    // created for it and the buffer that was selected in the previous
+    // session was restored
+    auto previous_buffer = previous_session_buffers_.find(var_name);
+    if (previous_buffer != previous_session_buffers_.end()) {
+        if (scheduled_restores_.empty()) {
+            restore_started_us_ = Tracer::now_us();
+        }
+
+        if (var_name == previous_session_selected_buffer_) {
+            scheduled_restores_.push_front(var_name);
+        } else {
+            scheduled_restores_.push_back(var_name);
         }
+
+        previous_session_buffers_.erase(previous_buffer);
     }
+}
 
-    completer_updated_ = true;
+
+void MainWindow::remove_available_symbol(const string& var_name)
+{
+    if (available_symbols_.erase(var_name) == 0) {
+        return;
+    }
+
+    // Remove symbol name from autocomplete list, unless its addition is
+    // still pending
+    const QString symbol = QString::fromStdString(var_name);
+    if (!added_symbols_.removeOne(symbol)) {
+        removed_symbols_.append(symbol);
+    }
+}
+
+
+void MainWindow::start_interaction_benchmark(const string& report_path)
+{
+    std::unique_lock<std::mutex> lock(ui_mutex_);
+    pending_benchmark_report_path_ = report_path;
+}
+
+
+bool MainWindow::is_interaction_benchmark_running()
+{
+    std::unique_lock<std::mutex> lock(ui_mutex_);
+    return !pending_benchmark_report_path_.empty() ||
+           (interaction_benchmark_ != nullptr &&
+            interaction_benchmark_->is_running());
 }
 
 
@@ -176,38 +384,103 @@ void MainWindow::loop()
     int icon_height          = icon_size.height();
     const int bytes_per_line = icon_width * 3;
 
+    TaskScheduler::instance().run_completion_callbacks();
+
+    add_restore_placeholders();
+
+    // Plot requests are handled within a time budget, so that a burst of
+    // them doesn't hold back painting and input handling. The remaining
+    // requests are handled in the next iterations
+    const uint64_t requests_budget_us = 1000000 / (2 * render_framerate_);
+    const uint64_t requests_begin_us  = Tracer::now_us();
+
     // Handle buffer plot requests
-    while (!pending_updates_.empty()) {
-        const BufferRequestMessage& request = pending_updates_.front();
+    while (Tracer::now_us() - requests_begin_us < requests_budget_us) {
+        std::unique_lock<std::mutex> lock(ui_mutex_);
+        if (pending_updates_.empty()) {
+            Metrics::set_gauge("queue_depth", 0);
+            break;
+        }
+
+        // Requests are handled in order, so the others wait for the float
+        // copy of the first one
+        const auto& float_copy = pending_updates_.front().float_copy;
+        if (float_copy != nullptr && !float_copy->ready) {
+            break;
+        }
+
+        // The request is taken out of the queue so that new requests can be
+        // enqueued by other threads while it is processed
+        const BufferRequestMessage request = pending_updates_.front();
+        pending_updates_.pop_front();
+        lock.unlock();
+
+        Tracer::record_span(
+            "queue_wait", request.queued_at_us, Tracer::now_us());
 
         uint8_t* srcBuffer;
         shared_ptr<uint8_t> managedBuffer;
+        StageMemoryUsage memory_usage;
         if (request.type == Buffer::BufferType::Float64) {
-            managedBuffer = make_float_buffer_from_double(
-                static_cast<double*>(
-                    get_c_ptr_from_py_buffer(request.py_buffer)),
-                request.width_i * request.height_i * request.channels);
-            srcBuffer = managedBuffer.get();
+            const size_t num_elements =
+                request.width_i * request.height_i * request.channels;
+            managedBuffer           = request.float_copy->data;
+            srcBuffer               = managedBuffer.get();
+            memory_usage.float_copy = num_elements * sizeof(float);
         } else {
-            managedBuffer = make_shared_py_object(request.py_buffer);
-            srcBuffer     = static_cast<uint8_t*>(
-                get_c_ptr_from_py_buffer(request.py_buffer));
+            managedBuffer            = request.managed_buffer;
+            srcBuffer                = request.buffer_ptr;
+            memory_usage.host_buffer = request.buffer_size;
+        }
+
+        if (request.is_region) {
+            // Regions refine the overview of a downsampled buffer, and are
+            // dropped if the buffer is not visualized anymore
+            auto region_stage = stages_.find(request.variable_name_str);
+            if (region_stage != stages_.end()) {
+                BufferRegionRequest region;
+                region.x      = request.region_x;
+                region.y      = request.region_y;
+                region.width  = request.width_i * request.region_step;
+                region.height = request.height_i * request.region_step;
+                region.step   = request.region_step;
+
+                Buffer* buffer =
+                    region_stage->second->get_game_object("buffer")
+                        ->get_component<Buffer>("buffer_component");
+                buffer->add_region(region,
+                                   request.channels,
+                                   request.type,
+                                   managedBuffer,
+                                   srcBuffer);
+                request_render_update_ = true;
+            }
+            continue;
         }
 
+        QListWidgetItem* stage_item = nullptr;
+        QPixmap icon_pixmap;
+
         auto buffer_stage = stages_.find(request.variable_name_str);
         held_buffers_[request.variable_name_str] = managedBuffer;
 
+        Metrics::record_cache_access("stage", buffer_stage != stages_.end());
+
         if (buffer_stage == stages_.end()) { // New buffer request
-            shared_ptr<Stage> stage = make_shared<Stage>(this);
-            if (!stage->initialize(srcBuffer,
-                                   request.width_i,
-                                   request.height_i,
-                                   request.channels,
-                                   request.type,
-                                   request.step,
-                                   request.pixel_layout,
-                                   request.transpose_buffer)) {
-                cerr << "[error] Could not initialize opengl canvas!" << endl;
+            shared_ptr<Stage> stage = take_pooled_stage(request, srcBuffer);
+            if (stage == nullptr) {
+                stage = make_shared<Stage>(this);
+                if (!stage->initialize(srcBuffer,
+                                       request.width_i,
+                                       request.height_i,
+                                       request.channels,
+                                       request.type,
+                                       request.step,
+                                       request.pixel_layout,
+                                       request.transpose_buffer)) {
+                    cerr << "[error] Could not initialize opengl canvas!"
+                         << endl;
+                }
             }
             stage->contrast_enabled            = ac_enabled_;
             stages_[request.variable_name_str] = stage;
@@ -226,26 +499,52 @@ void MainWindow::loop()
                   << request.get_visualized_width() << "x"
                   << request.get_visualized_height() << "]\n"
                   << get_type_label(request.type, request.channels);
+            icon_pixmap = QPixmap::fromImage(bufferIcon);
+
+            // Restored buffers reuse their placeholder item
             QListWidgetItem* item =
-                new QListWidgetItem(QPixmap::fromImage(bufferIcon),
-                                    label.str().c_str(),
-                                    ui_->imageList);
-            item->setData(Qt::UserRole,
-                          QString(request.variable_name_str.c_str()));
-            item->setFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled |
-                           Qt::ItemIsDragEnabled);
-            ui_->imageList->addItem(item);
+                find_buffer_item(request.variable_name_str);
+            if (item == nullptr) {
+                item = new QListWidgetItem(icon_pixmap,
+                                           label.str().c_str(),
+                                           ui_->imageList);
+                item->setData(Qt::UserRole,
+                              QString(request.variable_name_str.c_str()));
+                item->setFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled |
+                               Qt::ItemIsDragEnabled);
+                ui_->imageList->addItem(item);
+            } else {
+                item->setIcon(icon_pixmap);
+                item->setText(label.str().c_str());
+            }
+            stage_item = item;
 
             persist_settings_deferred();
         } else { // Update buffer request
-            buffer_stage->second->buffer_update(srcBuffer,
-                                                request.width_i,
-                                                request.height_i,
-                                                request.channels,
-                                                request.type,
-                                                request.step,
-                                                request.pixel_layout,
-                                                request.transpose_buffer);
+            // If the debugger bridge knows which rows were modified, only
+            // these are uploaded
+            const bool rows_updated =
+                request.has_dirty_rows &&
+                buffer_stage->second->buffer_update_rows(
+                    srcBuffer,
+                    request.width_i,
+                    request.height_i,
+                    request.channels,
+                    request.type,
+                    request.step,
+                    request.pixel_layout,
+                    request.transpose_buffer,
+                    request.dirty_rows);
+            if (!rows_updated) {
+                buffer_stage->second->buffer_update(srcBuffer,
+                                                    request.width_i,
+                                                    request.height_i,
+                                                    request.channels,
+                                                    request.type,
+                                                    request.step,
+                                                    request.pixel_layout,
+                                                    request.transpose_buffer);
+            }
             // Update buffer icon
             shared_ptr<Stage>& stage = stages_[request.variable_name_str];
             ui_->bufferPreview->render_buffer_icon(
@@ -263,14 +562,11 @@ void MainWindow::loop()
                   << request.get_visualized_height() << "]\n"
                   << get_type_label(request.type, request.channels);
 
-            for (int i = 0; i < ui_->imageList->count(); ++i) {
-                QListWidgetItem* item = ui_->imageList->item(i);
-                if (item->data(Qt::UserRole) ==
-                    request.variable_name_str.c_str()) {
-                    item->setIcon(QPixmap::fromImage(bufferIcon));
-                    item->setText(label.str().c_str());
-                    break;
-                }
+            icon_pixmap = QPixmap::fromImage(bufferIcon);
+            stage_item  = find_buffer_item(request.variable_name_str);
+            if (stage_item != nullptr) {
+                stage_item->setIcon(icon_pixmap);
+                stage_item->setText(label.str().c_str());
             }
 
             // Update AC values
@@ -280,14 +576,56 @@ void MainWindow::loop()
             }
         }
 
-        pending_updates_.pop_front();
+        const shared_ptr<Stage>& stage = stages_[request.variable_name_str];
+        Buffer* buffer = stage->get_game_object("buffer")
+                             ->get_component<Buffer>("buffer_component");
+        buffer->downsample  = request.downsample;
+        buffer->full_width  = request.full_width_i;
+        buffer->full_height = request.full_height_i;
+        buffer->slice_x     = request.slice_x;
+        buffer->slice_y     = request.slice_y;
+        buffer->slice_step  = request.slice_step;
+        memory_usage.textures = buffer->texture_memory_usage();
+        memory_usage.icon     = stage->buffer_icon.size();
+        memory_usage.pixmap   = static_cast<size_t>(icon_pixmap.width()) *
+                              icon_pixmap.height() * icon_pixmap.depth() / 8;
+        update_stage_memory_usage(
+            request.variable_name_str, memory_usage, stage_item);
+
+        mark_buffer_refreshed(request.variable_name_str);
+        finish_restore(request.variable_name_str);
+
         request_render_update_ = true;
     }
 
-    if (completer_updated_) {
-        // Update auto-complete suggestion list
-        symbol_completer_->update_symbol_list(available_vars_);
-        completer_updated_ = false;
+    request_next_restore();
+
+    {
+        // Benchmarks only start once all requested buffers were plotted
+        std::unique_lock<std::mutex> lock(ui_mutex_);
+        if (!pending_benchmark_report_path_.empty() &&
+            pending_updates_.empty()) {
+            interaction_benchmark_.reset(new InteractionBenchmark(
+                this, pending_benchmark_report_path_));
+            pending_benchmark_report_path_.clear();
+            // Flagged as running before the lock is released, so that
+            // is_interaction_benchmark_running() never sees a gap
+            interaction_benchmark_->start();
+        }
+    }
+
+    {
+        // Patch the auto-complete suggestion list with the symbols that
+        // changed since the previous loop
+        std::unique_lock<std::mutex> lock(ui_mutex_);
+        if (!removed_symbols_.isEmpty()) {
+            symbol_completer_->remove_symbols(removed_symbols_);
+            removed_symbols_.clear();
+        }
+        if (!added_symbols_.isEmpty()) {
+            symbol_completer_->add_symbols(added_symbols_);
+            added_symbols_.clear();
+        }
     }
 
     // Run update for current stage
@@ -295,6 +633,10 @@ void MainWindow::loop()
         currently_selected_stage_->update();
     }
 
+    request_buffer_regions();
+
+    update_stale_badges();
+
     if (request_render_update_) {
         // Update visualization pane
         ui_->bufferPreview->update();
@@ -312,64 +654,425 @@ void MainWindow::request_render_update()
 
 void MainWindow::persist_settings()
 {
-    using BufferExpiration = QPair<QString, QDateTime>;
+    PersistedSettings settings;
 
-    QSettings settings(QSettings::Format::IniFormat,
-                       QSettings::Scope::UserScope,
-                       "gdbimagewatch");
+    for (const auto& held_buffer : held_buffers_) {
+        settings.held_buffers.insert(held_buffer.first);
+    }
 
-    QList<BufferExpiration> persisted_session_buffers;
+    {
+        // Removed buffers are not restored anymore
+        std::unique_lock<std::mutex> lock(ui_mutex_);
+        for (const auto& removed_buffer : removed_buffer_names_) {
+            previous_session_buffers_.erase(removed_buffer);
+        }
+    }
+    settings.removed_buffers.swap(removed_buffer_names_);
+
+    // The selected buffer is the first one to be restored
+    QListWidgetItem* selected_item = ui_->imageList->currentItem();
+    if (selected_item != nullptr) {
+        settings.selected_buffer =
+            selected_item->data(Qt::UserRole).toString();
+    }
 
-    // Load previous session symbols
-    QList<BufferExpiration> previous_session_buffers_qlist =
-        settings.value("PreviousSession/buffers")
-            .value<QList<BufferExpiration>>();
+    settings.default_export_suffix = default_export_suffix_;
+    settings.render_framerate      = render_framerate_;
+    settings.renderer              = renderer_;
+    settings.window_size           = size();
+    settings.window_pos            = pos();
+
+    // The settings file is written by a background thread
+    settings_writer_.write(settings);
+}
 
-    QDateTime now             = QDateTime::currentDateTime();
-    QDateTime next_expiration = now.addDays(1);
 
-    // Of the buffers not currently being visualized, only keep those whose
-    // timer hasn't expired yet and is not in the set of removed names
-    for (const auto& prev_buff : previous_session_buffers_qlist) {
-        const string buff_name_std_str = prev_buff.first.toStdString();
+void MainWindow::update_stage_memory_usage(const string& buffer_name,
+                                           const StageMemoryUsage& usage,
+                                           QListWidgetItem* item)
+{
+    stage_memory_usage_[buffer_name] = usage;
 
-        const bool being_viewed =
-            held_buffers_.find(buff_name_std_str) != held_buffers_.end();
-        const bool was_removed =
-            removed_buffer_names_.find(buff_name_std_str) !=
-            removed_buffer_names_.end();
+    size_t total_usage = 0;
+    for (const auto& stage_usage : stage_memory_usage_) {
+        total_usage += stage_usage.second.total();
+    }
+    memory_high_water_mark_ = std::max(memory_high_water_mark_, total_usage);
+
+    if (item != nullptr) {
+        item->setToolTip(
+            QString("Host copy: %1\nFloat copy: %2\nTextures: %3\n"
+                    "Icon: %4\nPixmap: %5\nTotal: %6")
+                .arg(format_memory_size(usage.host_buffer))
+                .arg(format_memory_size(usage.float_copy))
+                .arg(format_memory_size(usage.textures))
+                .arg(format_memory_size(usage.icon))
+                .arg(format_memory_size(usage.pixmap))
+                .arg(format_memory_size(usage.total())));
+    }
+
+    memory_usage_panel_->set_usage(stage_memory_usage_,
+                                   memory_high_water_mark_);
+
+    Metrics::set_buffer_memory(
+        buffer_name, usage.host_total(), usage.gpu_total());
+}
+
+
+void MainWindow::remove_stage_memory_usage(const string& buffer_name)
+{
+    stage_memory_usage_.erase(buffer_name);
+
+    memory_usage_panel_->set_usage(stage_memory_usage_,
+                                   memory_high_water_mark_);
+
+    Metrics::remove_buffer_memory(buffer_name);
+}
+
+
+void MainWindow::recycle_stage(const string& buffer_name)
+{
+    // Upper bound of the stages kept for reuse
+    const size_t max_pooled_stages = 4;
+
+    auto stage = stages_.find(buffer_name);
+    if (stage == stages_.end()) {
+        return;
+    }
+
+    // Pooled stages keep their shader programs and VBO, but their textures go
+    // back to the texture pool, whose size is bounded. The next buffer_update()
+    // of a reused stage acquires them again, usually without allocations
+    stage->second->get_game_object("buffer")
+        ->get_component<Buffer>("buffer_component")
+        ->release_video_memory();
+
+    stage_pool_.push_back(stage->second);
+    stages_.erase(stage);
+
+    if (stage_pool_.size() > max_pooled_stages) {
+        stage_pool_.pop_front();
+    }
+
+    Metrics::set_gauge("pooled_stages", stage_pool_.size());
+}
 
-        if (was_removed) {
-            previous_session_buffers_.erase(buff_name_std_str);
-        } else if (!being_viewed && prev_buff.second >= now) {
-            persisted_session_buffers.append(prev_buff);
+
+shared_ptr<Stage> MainWindow::take_pooled_stage(
+    const BufferRequestMessage& request,
+    uint8_t* buffer)
+{
+    for (auto it = stage_pool_.rbegin(); it != stage_pool_.rend(); ++it) {
+        Buffer* buffer_component =
+            (*it)->get_game_object("buffer")->get_component<Buffer>(
+                "buffer_component");
+        if (!buffer_component->has_layout(request.width_i,
+                                          request.height_i,
+                                          request.channels,
+                                          request.type,
+                                          request.step,
+                                          request.transpose_buffer)) {
+            continue;
         }
+
+        shared_ptr<Stage> stage = *it;
+        stage_pool_.erase(next(it).base());
+
+        Metrics::record_cache_access("stage_pool", true);
+        Metrics::set_gauge("pooled_stages", stage_pool_.size());
+
+        // Same layout: the game objects, components, shader programs and VBO
+        // are reused, the textures are taken from the texture pool, and only
+        // the buffer contents are uploaded
+        stage->buffer_update(buffer,
+                             request.width_i,
+                             request.height_i,
+                             request.channels,
+                             request.type,
+                             request.step,
+                             request.pixel_layout,
+                             request.transpose_buffer);
+
+        Camera* camera =
+            stage->get_game_object("camera")->get_component<Camera>(
+                "camera_component");
+        camera->recenter_camera();
+
+        return stage;
     }
 
-    for (const auto& held_buffer : held_buffers_) {
-        persisted_session_buffers.append(
-            BufferExpiration(held_buffer.first.c_str(), next_expiration));
+    Metrics::record_cache_access("stage_pool", false);
+
+    return nullptr;
+}
+
+
+QListWidgetItem* MainWindow::find_buffer_item(const string& buffer_name)
+{
+    for (int i = 0; i < ui_->imageList->count(); ++i) {
+        QListWidgetItem* item = ui_->imageList->item(i);
+        if (item->data(Qt::UserRole) == buffer_name.c_str()) {
+            return item;
+        }
+    }
+
+    return nullptr;
+}
+
+
+void MainWindow::add_restore_placeholders()
+{
+    deque<string> scheduled_restores;
+    uint64_t restore_started_us;
+    {
+        std::unique_lock<std::mutex> lock(ui_mutex_);
+        scheduled_restores.swap(scheduled_restores_);
+        restore_started_us = restore_started_us_;
+    }
+
+    if (scheduled_restores.empty()) {
+        return;
+    }
+
+    QSizeF icon_size = get_icon_size();
+    QPixmap placeholder_pixmap(icon_size.width(), icon_size.height());
+    placeholder_pixmap.fill(palette().color(QPalette::Mid));
+
+    for (const auto& buffer_name : scheduled_restores) {
+        if (stages_.find(buffer_name) != stages_.end() ||
+            find_buffer_item(buffer_name) != nullptr) {
+            continue;
+        }
+
+        QListWidgetItem* item = new QListWidgetItem(
+            placeholder_pixmap,
+            (buffer_name + "\n[restoring...]").c_str(),
+            ui_->imageList);
+        item->setData(Qt::UserRole, QString(buffer_name.c_str()));
+        item->setFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled |
+                       Qt::ItemIsDragEnabled);
+        ui_->imageList->addItem(item);
+
+        if (buffer_name == previous_session_selected_buffer_) {
+            // The buffer selected in the previous session is fetched first
+            restore_queue_.push_front(buffer_name);
+            if (currently_selected_stage_ == nullptr) {
+                ui_->imageList->setCurrentItem(item);
+            }
+        } else {
+            restore_queue_.push_back(buffer_name);
+        }
+    }
+
+    if (restore_begin_us_ == 0 && !restore_queue_.empty()) {
+        restore_begin_us_             = restore_started_us;
+        restore_first_buffer_pending_ = true;
     }
+}
 
-    // Write default suffix for buffer export
-    settings.setValue("Export/default_export_suffix", default_export_suffix_);
 
-    // Write maximum framerate
-    settings.setValue("Rendering/maximum_framerate", render_framerate_);
+void MainWindow::request_next_restore()
+{
+    // Restored buffers that couldn't be fetched (e.g. they went out of scope)
+    // are dropped after a while, so that the others are not blocked
+    const uint64_t restore_timeout_us = 5000000;
+
+    if (!restore_in_flight_.empty() &&
+        Tracer::now_us() - restore_in_flight_since_us_ > restore_timeout_us) {
+        QListWidgetItem* item = find_buffer_item(restore_in_flight_);
+        if (item != nullptr &&
+            stages_.find(restore_in_flight_) == stages_.end()) {
+            delete ui_->imageList->takeItem(ui_->imageList->row(item));
+        }
+        restore_in_flight_.clear();
+    }
 
-    // Write previous session symbols
-    settings.setValue("PreviousSession/buffers",
-                      QVariant::fromValue(persisted_session_buffers));
+    if (!restore_in_flight_.empty()) {
+        return;
+    }
 
-    // Write window position/size
-    settings.beginGroup("MainWindow");
-    settings.setValue("size", size());
-    settings.setValue("pos", pos());
-    settings.endGroup();
+    if (restore_queue_.empty()) {
+        if (restore_begin_us_ != 0) {
+            const uint64_t now_us = Tracer::now_us();
+            Tracer::record_span("restore_all", restore_begin_us_, now_us);
+            Metrics::record_latency("restore_all", now_us - restore_begin_us_);
+            restore_begin_us_             = 0;
+            restore_first_buffer_pending_ = false;
+        }
+        return;
+    }
 
-    settings.sync();
+    {
+        // Restores have the lowest priority: they wait for all other plot
+        // requests to be processed
+        std::unique_lock<std::mutex> lock(ui_mutex_);
+        if (!pending_updates_.empty()) {
+            return;
+        }
+    }
+
+    restore_in_flight_ = restore_queue_.front();
+    restore_queue_.pop_front();
+    restore_in_flight_since_us_ = Tracer::now_us();
+
+    plot_callback_(restore_in_flight_.c_str());
+}
+
+
+void MainWindow::finish_restore(const string& buffer_name)
+{
+    auto queued_restore =
+        find(restore_queue_.begin(), restore_queue_.end(), buffer_name);
+    if (queued_restore != restore_queue_.end()) {
+        // Plotted by other means before its turn
+        restore_queue_.erase(queued_restore);
+    } else if (buffer_name != restore_in_flight_) {
+        return;
+    }
+
+    if (buffer_name == restore_in_flight_) {
+        restore_in_flight_.clear();
+    }
+
+    QListWidgetItem* item = find_buffer_item(buffer_name);
+    if (item == nullptr) {
+        return;
+    }
+
+    if (item == ui_->imageList->currentItem()) {
+        // The placeholder was selected before its buffer was available
+        buffer_selected(item);
+    } else if (currently_selected_stage_ == nullptr) {
+        ui_->imageList->setCurrentItem(item);
+    }
+
+    if (restore_first_buffer_pending_ && currently_selected_stage_ != nullptr) {
+        // The next frame is the first one that can be interacted with
+        restore_first_frame_begin_us_ = restore_begin_us_;
+        restore_first_buffer_pending_ = false;
+    }
+}
+
+
+void MainWindow::request_buffer_regions()
+{
+    // The software renderer only draws the overview of large buffers, so
+    // their regions are never read from the debugger
+    if (currently_selected_stage_ == nullptr || region_callback_ == nullptr ||
+        ui_->bufferPreview->is_software_rendering()) {
+        return;
+    }
 
-    removed_buffer_names_.clear();
+    Buffer* buffer = currently_selected_stage_->get_game_object("buffer")
+                         ->get_component<Buffer>("buffer_component");
+    const vector<BufferRegionRequest> regions = buffer->take_missing_regions();
+    if (regions.empty()) {
+        return;
+    }
+
+    for (const auto& stage : stages_) {
+        if (stage.second.get() != currently_selected_stage_) {
+            continue;
+        }
+
+        for (const auto& region : regions) {
+            Metrics::add_to_counter("region_requests", 1);
+            region_callback_(stage.first.c_str(),
+                             region.x,
+                             region.y,
+                             region.width,
+                             region.height,
+                             region.step);
+        }
+        return;
+    }
+}
+
+
+void MainWindow::mark_buffer_refreshed(const string& buffer_name)
+{
+    std::unique_lock<std::mutex> lock(ui_mutex_);
+
+    auto refresh_state = refresh_states_.find(buffer_name);
+    if (refresh_state != refresh_states_.end()) {
+        refresh_state->second.stale_stops = 0;
+    }
+}
+
+
+void MainWindow::update_stale_badges()
+{
+    map<string, int> stale_stops;
+
+    {
+        std::unique_lock<std::mutex> lock(ui_mutex_);
+        if (!stale_badges_outdated_) {
+            return;
+        }
+        stale_badges_outdated_ = false;
+
+        for (const auto& refresh_state : refresh_states_) {
+            stale_stops[refresh_state.first] = refresh_state.second.stale_stops;
+        }
+    }
+
+    QSizeF icon_size           = get_icon_size();
+    const int icon_width       = icon_size.width();
+    const int icon_height      = icon_size.height();
+    const int badge_height     = icon_height / 3;
+    const QColor badge_color(230, 126, 34);
+
+    for (int row = 0; row < ui_->imageList->count(); ++row) {
+        QListWidgetItem* item = ui_->imageList->item(row);
+        const string buffer_name =
+            item->data(Qt::UserRole).toString().toStdString();
+
+        // Placeholders of restored buffers have no icon yet
+        auto stage = stages_.find(buffer_name);
+        if (stage == stages_.end() ||
+            stage->second->buffer_icon.size() <
+                static_cast<size_t>(icon_width * icon_height * 3)) {
+            continue;
+        }
+
+        QImage buffer_icon(stage->second->buffer_icon.data(),
+                           icon_width,
+                           icon_height,
+                           icon_width * 3,
+                           QImage::Format_RGB888);
+        QPixmap icon_pixmap = QPixmap::fromImage(buffer_icon);
+
+        auto buffer_stale_stops = stale_stops.find(buffer_name);
+        if (buffer_stale_stops != stale_stops.end() &&
+            buffer_stale_stops->second > 0) {
+            // The badge shows how many stops ago the buffer was refreshed
+            const QString badge_text =
+                QString::number(buffer_stale_stops->second);
+
+            QPainter painter(&icon_pixmap);
+            painter.setRenderHint(QPainter::Antialiasing);
+
+            QFont badge_font = painter.font();
+            badge_font.setPixelSize(badge_height - 4);
+            badge_font.setBold(true);
+            painter.setFont(badge_font);
+
+            const int badge_width = std::max(
+                badge_height,
+                painter.fontMetrics().boundingRect(badge_text).width() + 6);
+            const QRect badge_rect(
+                icon_width - badge_width - 2, 2, badge_width, badge_height);
+
+            painter.setPen(Qt::NoPen);
+            painter.setBrush(badge_color);
+            painter.drawRoundedRect(
+                badge_rect, badge_height / 2.0, badge_height / 2.0);
+            painter.setPen(Qt::white);
+            painter.drawText(badge_rect, Qt::AlignCenter, badge_text);
+        }
+
+        item->setIcon(icon_pixmap);
+    }
 }
 
 
@@ -416,16 +1119,19 @@ void MainWindow::update_status_bar()
         float mouse_x = ui_->bufferPreview->mouse_x();
         float mouse_y = ui_->bufferPreview->mouse_y();
 
-        vec4 mouse_pos = get_stage_coordinates(mouse_x, mouse_y);
+        // Stage coordinates of downsampled buffers are in overview pixels
+        vec4 mouse_pos  = get_stage_coordinates(mouse_x, mouse_y);
+        const int pos_x = floor(mouse_pos.x() * buffer->downsample);
+        const int pos_y = floor(mouse_pos.y() * buffer->downsample);
 
+        // Slices are shown with the coordinates of the sliced buffer
         message << std::fixed << std::setprecision(3) << "("
-                << static_cast<int>(floor(mouse_pos.x())) << ", "
-                << static_cast<int>(floor(mouse_pos.y())) << ")\t"
+                << buffer->slice_x + pos_x * buffer->slice_step << ", "
+                << buffer->slice_y + pos_y * buffer->slice_step << ")\t"
                 << cam->compute_zoom() * 100.0 << "%";
         message << " val=";
 
-        buffer->get_pixel_info(
-            message, floor(mouse_pos.x()), floor(mouse_pos.y()));
+        buffer->get_pixel_info(message, pos_x, pos_y);
 
         status_bar_->setText(message.str().c_str());
     }
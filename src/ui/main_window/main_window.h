@@ -26,6 +26,7 @@
 #ifndef MAIN_WINDOW_H_
 #define MAIN_WINDOW_H_
 
+#include <cstdint>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -37,9 +38,13 @@
 #include <QMainWindow>
 #include <QTimer>
 
+#include "concurrency/task_scheduler.h"
 #include "debuggerinterface/buffer_request_message.h"
+#include "io/settings_writer.h"
 #include "math/linear_algebra.h"
 #include "ui/go_to_widget.h"
+#include "ui/interaction_benchmark.h"
+#include "ui/memory_usage_panel.h"
 #include "ui/symbol_completer.h"
 #include "visualization/stage.h"
 
@@ -54,6 +59,8 @@ class MainWindow : public QMainWindow
 {
     Q_OBJECT
 
+    friend class InteractionBenchmark;
+
   public:
     ///
     // Constructor / destructor
@@ -74,14 +81,32 @@ class MainWindow : public QMainWindow
     // External interface
     void set_plot_callback(int (*plot_cbk)(const char*));
 
+    void set_region_callback(
+        int (*region_cbk)(const char*, int, int, int, int, int));
+
     void plot_buffer(const BufferRequestMessage& buffer_metadata);
 
+    size_t get_pending_update_count();
+
     std::deque<std::string> get_observed_symbols();
 
+    // Observed buffers that must be refreshed at a debugger stop, according
+    // to their refresh policies. Each call counts as one stop
+    std::deque<std::string> get_buffers_to_refresh();
+
     bool is_window_ready();
 
     void set_available_symbols(const std::deque<std::string>& available_set);
 
+    // Same as set_available_symbols, given only the symbols that appeared
+    // and disappeared since the previous call
+    void update_available_symbols(const std::deque<std::string>& added_set,
+                                  const std::deque<std::string>& removed_set);
+
+    void start_interaction_benchmark(const std::string& report_path);
+
+    bool is_interaction_benchmark_running();
+
     ///
     // Auto contrast pane - implemented in auto_contrast.cpp
     void reset_ac_min_labels();
@@ -160,6 +185,10 @@ class MainWindow : public QMainWindow
 
     void show_context_menu(const QPoint& pos);
 
+    void set_refresh_policy();
+
+    void refresh_buffer();
+
     void toggle_go_to_dialog();
 
     void go_to_pixel(float x, float y);
@@ -170,9 +199,24 @@ class MainWindow : public QMainWindow
     void persist_settings();
 
   private:
+    enum class RefreshPolicy {
+        EveryStop    = 0,
+        WhenSelected = 1,
+        EveryNthStop = 2,
+        Manual       = 3
+    };
+
+    struct BufferRefreshState
+    {
+        RefreshPolicy policy = RefreshPolicy::EveryStop;
+        // Number of stops between refreshes, for EveryNthStop
+        int period = 2;
+        // Number of stops since the buffer was last refreshed
+        int stale_stops = 0;
+    };
+
     bool is_window_ready_;
     bool request_render_update_;
-    bool completer_updated_;
     bool ac_enabled_;
     bool link_views_enabled_;
 
@@ -180,8 +224,11 @@ class MainWindow : public QMainWindow
     const int icon_height_base_;
 
     double render_framerate_;
+    // Renderer selected in the settings: auto, opengl or software
+    QString renderer_;
 
     QTimer settings_persist_timer_;
+    SettingsWriter settings_writer_;
     QTimer update_timer_;
 
     QString default_export_suffix_;
@@ -190,13 +237,46 @@ class MainWindow : public QMainWindow
 
     std::map<std::string, std::shared_ptr<uint8_t>> held_buffers_;
     std::map<std::string, std::shared_ptr<Stage>> stages_;
+    // Stages of removed buffers, kept for buffers that appear with the same
+    // layout, from the least to the most recently removed
+    std::deque<std::shared_ptr<Stage>> stage_pool_;
+    std::map<std::string, StageMemoryUsage> stage_memory_usage_;
+    size_t memory_high_water_mark_;
 
     std::set<std::string> previous_session_buffers_;
     std::set<std::string> removed_buffer_names_;
+    std::string previous_session_selected_buffer_;
+
+    // Previous session buffers found by set_available_symbols(), which still
+    // need a placeholder item (guarded by ui_mutex_)
+    std::deque<std::string> scheduled_restores_;
+    uint64_t restore_started_us_;
+
+    // Placeholder buffers waiting to be fetched, in fetch order. Only one of
+    // them is requested at a time, when no other plot request is pending
+    std::deque<std::string> restore_queue_;
+    std::string restore_in_flight_;
+    uint64_t restore_in_flight_since_us_;
+    // Start of the ongoing restore, or 0
+    uint64_t restore_begin_us_;
+    bool restore_first_buffer_pending_;
+    // Start of the restore whose first restored buffer is about to be
+    // presented, or 0
+    uint64_t restore_first_frame_begin_us_;
 
     std::deque<BufferRequestMessage> pending_updates_;
 
-    QStringList available_vars_;
+    // Refresh policy of each observed buffer and name of the selected buffer
+    // (guarded by ui_mutex_)
+    std::map<std::string, BufferRefreshState> refresh_states_;
+    std::string selected_buffer_name_;
+    bool stale_badges_outdated_;
+
+    // Symbols available in the current context, and the changes to it not
+    // yet applied to the completer (guarded by ui_mutex_)
+    std::set<std::string> available_symbols_;
+    QStringList added_symbols_;
+    QStringList removed_symbols_;
 
     std::mutex ui_mutex_;
 
@@ -206,8 +286,17 @@ class MainWindow : public QMainWindow
 
     QLabel* status_bar_;
     GoToWidget* go_to_widget_;
+    MemoryUsagePanel* memory_usage_panel_;
 
     int (*plot_callback_)(const char*);
+    int (*region_callback_)(const char*, int, int, int, int, int);
+
+    // Cancelled when the window is destroyed, so that the completion
+    // callbacks of its tasks are not called anymore
+    CancellationToken tasks_token_;
+
+    std::string pending_benchmark_report_path_;
+    std::unique_ptr<InteractionBenchmark> interaction_benchmark_;
 
     ///
     // Assorted methods - private - implemented in main_window.cpp
@@ -223,6 +312,37 @@ class MainWindow : public QMainWindow
 
     vec4 get_stage_coordinates(float pos_window_x, float pos_window_y);
 
+    void update_stage_memory_usage(const std::string& buffer_name,
+                                   const StageMemoryUsage& usage,
+                                   QListWidgetItem* item);
+
+    void remove_stage_memory_usage(const std::string& buffer_name);
+
+    void recycle_stage(const std::string& buffer_name);
+
+    std::shared_ptr<Stage>
+    take_pooled_stage(const BufferRequestMessage& request, uint8_t* buffer);
+
+    QListWidgetItem* find_buffer_item(const std::string& buffer_name);
+
+    void add_restore_placeholders();
+
+    void request_next_restore();
+
+    void finish_restore(const std::string& buffer_name);
+
+    void request_buffer_regions();
+
+    void start_float_conversion(BufferRequestMessage& request);
+
+    void mark_buffer_refreshed(const std::string& buffer_name);
+
+    void update_stale_badges();
+
+    void add_available_symbol(const std::string& symbol);
+
+    void remove_available_symbol(const std::string& symbol);
+
     ///
     // Auto contrast pane - private - implemented in auto_contrast.cpp
     void set_ac_min_value(int idx, float value);
@@ -252,6 +372,8 @@ class MainWindow : public QMainWindow
     void initialize_settings();
 
     void initialize_go_to_widget();
+
+    void initialize_memory_usage_panel();
 };
 
 #endif // MAIN_WINDOW_H_
@@ -23,11 +23,15 @@
  * IN THE SOFTWARE.
  */
 
+#include <algorithm>
+
 #include <QFileDialog>
+#include <QInputDialog>
 
 #include "main_window.h"
 
 #include "io/buffer_exporter.h"
+#include "profiling/tracer.h"
 #include "ui_main_window.h"
 #include "visualization/components/camera.h"
 #include "visualization/game_object.h"
@@ -224,15 +228,42 @@ void MainWindow::buffer_selected(QListWidgetItem* item)
     if (item == nullptr)
         return;
 
-    auto stage =
-        stages_.find(item->data(Qt::UserRole).toString().toStdString());
+    const string buffer_name =
+        item->data(Qt::UserRole).toString().toStdString();
+
+    bool refresh_stale_buffer = false;
+    {
+        std::unique_lock<std::mutex> lock(ui_mutex_);
+        selected_buffer_name_ = buffer_name;
+
+        auto refresh_state = refresh_states_.find(buffer_name);
+        refresh_stale_buffer =
+            refresh_state != refresh_states_.end() &&
+            refresh_state->second.policy == RefreshPolicy::WhenSelected &&
+            refresh_state->second.stale_stops > 0;
+    }
+    if (refresh_stale_buffer) {
+        plot_callback_(buffer_name.c_str());
+    }
+
+    auto stage = stages_.find(buffer_name);
     if (stage != stages_.end()) {
         set_currently_selected_stage(stage->second.get());
         reset_ac_min_labels();
         reset_ac_max_labels();
 
         update_status_bar();
+    } else {
+        // Placeholder of a restored buffer: fetch it next
+        auto queued_restore =
+            find(restore_queue_.begin(), restore_queue_.end(), buffer_name);
+        if (queued_restore != restore_queue_.end()) {
+            restore_queue_.erase(queued_restore);
+            restore_queue_.push_front(buffer_name);
+        }
     }
+
+    persist_settings_deferred();
 }
 
 
@@ -243,12 +274,21 @@ void MainWindow::remove_selected_buffer()
             ui_->imageList->takeItem(ui_->imageList->currentRow());
         string buffer_name =
             removed_item->data(Qt::UserRole).toString().toStdString();
-        stages_.erase(buffer_name);
+        recycle_stage(buffer_name);
         held_buffers_.erase(buffer_name);
+        remove_stage_memory_usage(buffer_name);
+        restore_queue_.erase(
+            remove(restore_queue_.begin(), restore_queue_.end(), buffer_name),
+            restore_queue_.end());
         delete removed_item;
 
         removed_buffer_names_.insert(buffer_name);
 
+        {
+            std::unique_lock<std::mutex> lock(ui_mutex_);
+            refresh_states_.erase(buffer_name);
+        }
+
         if (stages_.size() == 0) {
             set_currently_selected_stage(nullptr);
         }
@@ -286,8 +326,9 @@ void MainWindow::export_buffer()
 {
     auto sender_action(static_cast<QAction*>(sender()));
 
-    auto stage =
-        stages_.find(sender_action->data().toString().toStdString())->second;
+    const string buffer_name =
+        sender_action->data().toString().toStdString();
+    auto stage = stages_.find(buffer_name)->second;
 
     GameObject* buffer_obj = stage->get_game_object("buffer");
     Buffer* component = buffer_obj->get_component<Buffer>("buffer_component");
@@ -321,11 +362,25 @@ void MainWindow::export_buffer()
         string file_name = file_dialog.selectedFiles()[0].toStdString();
         const auto selected_filter = file_dialog.selectedNameFilter();
 
-        // Export buffer
-        BufferExporter::export_buffer(
-            component,
-            file_name,
-            output_extensions[selected_filter]);
+        // The buffer is exported by a task worker, from a snapshot that
+        // isn't affected by later updates of the buffer
+        const BufferExporter::ExportedBuffer exported_buffer(
+            component, held_buffers_[buffer_name]);
+        const BufferExporter::OutputType output_type =
+            output_extensions[selected_filter];
+
+        status_bar_->setText(("Exporting " + file_name + "...").c_str());
+        TaskScheduler::instance().submit(
+            [exported_buffer, file_name, output_type]() {
+                GIW_TRACE_SCOPE("export");
+                BufferExporter::export_buffer(
+                    exported_buffer, file_name, output_type);
+            },
+            TaskPriority::Low,
+            tasks_token_,
+            [this, file_name]() {
+                status_bar_->setText(("Exported " + file_name).c_str());
+            });
 
         // Update default export suffix to the previously used suffix
         default_export_suffix_ = selected_filter;
@@ -349,7 +404,41 @@ void MainWindow::show_context_menu(const QPoint& pos)
             myMenu.addAction("Export buffer", this, SLOT(export_buffer()));
 
         // Add parameter to action: buffer name
-        exportAction->setData(ui_->imageList->itemAt(pos)->data(Qt::UserRole));
+        const QVariant buffer_name =
+            ui_->imageList->itemAt(pos)->data(Qt::UserRole);
+        exportAction->setData(buffer_name);
+
+        BufferRefreshState refresh_state;
+        {
+            std::unique_lock<std::mutex> lock(ui_mutex_);
+            auto buffer_refresh_state =
+                refresh_states_.find(buffer_name.toString().toStdString());
+            if (buffer_refresh_state != refresh_states_.end()) {
+                refresh_state = buffer_refresh_state->second;
+            }
+        }
+
+        QMenu* policyMenu = myMenu.addMenu("Refresh policy");
+        const pair<RefreshPolicy, QString> policies[] = {
+            {RefreshPolicy::EveryStop, "Every stop"},
+            {RefreshPolicy::WhenSelected, "Only when selected"},
+            {RefreshPolicy::EveryNthStop,
+             QString("Every N stops (%1)...").arg(refresh_state.period)},
+            {RefreshPolicy::Manual, "Manually"}};
+        for (const auto& policy : policies) {
+            QAction* policyAction = policyMenu->addAction(
+                policy.second, this, SLOT(set_refresh_policy()));
+            policyAction->setCheckable(true);
+            policyAction->setChecked(policy.first == refresh_state.policy);
+            // Add parameters to action: buffer name and policy
+            policyAction->setData(QStringList{
+                buffer_name.toString(),
+                QString::number(static_cast<int>(policy.first))});
+        }
+
+        QAction* refreshAction =
+            myMenu.addAction("Refresh now", this, SLOT(refresh_buffer()));
+        refreshAction->setData(buffer_name);
 
         // Show context menu at handling position
         myMenu.exec(globalPos);
@@ -357,6 +446,63 @@ void MainWindow::show_context_menu(const QPoint& pos)
 }
 
 
+void MainWindow::set_refresh_policy()
+{
+    auto sender_action(static_cast<QAction*>(sender()));
+    const QStringList parameters = sender_action->data().toStringList();
+    const string buffer_name     = parameters[0].toStdString();
+    const RefreshPolicy policy =
+        static_cast<RefreshPolicy>(parameters[1].toInt());
+
+    int period;
+    {
+        std::unique_lock<std::mutex> lock(ui_mutex_);
+        period = refresh_states_[buffer_name].period;
+    }
+
+    if (policy == RefreshPolicy::EveryNthStop) {
+        bool ok;
+        period = QInputDialog::getInt(this,
+                                      "Refresh policy",
+                                      "Refresh the buffer every N stops:",
+                                      period,
+                                      2,
+                                      1000,
+                                      1,
+                                      &ok);
+        if (!ok) {
+            return;
+        }
+    }
+
+    bool refresh_stale_buffer;
+    {
+        std::unique_lock<std::mutex> lock(ui_mutex_);
+        BufferRefreshState& refresh_state = refresh_states_[buffer_name];
+        refresh_state.policy              = policy;
+        refresh_state.period              = period;
+        refresh_stale_buffer = policy == RefreshPolicy::EveryStop &&
+                               refresh_state.stale_stops > 0;
+    }
+
+    // A buffer that missed stops is brought up to date right away when it
+    // goes back to being refreshed on every stop
+    if (refresh_stale_buffer) {
+        plot_callback_(buffer_name.c_str());
+    }
+}
+
+
+void MainWindow::refresh_buffer()
+{
+    auto sender_action(static_cast<QAction*>(sender()));
+    const QByteArray buffer_name_qba =
+        sender_action->data().toString().toLocal8Bit();
+
+    plot_callback_(buffer_name_qba.constData());
+}
+
+
 void MainWindow::toggle_go_to_dialog()
 {
     if (!go_to_widget_->isVisible()) {
@@ -367,7 +513,13 @@ void MainWindow::toggle_go_to_dialog()
                 currently_selected_stage_->get_game_object("camera");
             Camera* cam = cam_obj->get_component<Camera>("camera_component");
 
-            default_goal = cam->get_position();
+            GameObject* buffer_obj =
+                currently_selected_stage_->get_game_object("buffer");
+            Buffer* buffer =
+                buffer_obj->get_component<Buffer>("buffer_component");
+
+            default_goal =
+                buffer->stage_to_source_coordinates(cam->get_position());
         }
 
         go_to_widget_->set_defaults(default_goal.x(), default_goal.y());
@@ -0,0 +1,187 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include <QHeaderView>
+#include <QStringList>
+#include <QVBoxLayout>
+
+#include "memory_usage_panel.h"
+
+
+using namespace std;
+
+
+namespace
+{
+
+enum Column {
+    ColumnName = 0,
+    ColumnHostBuffer,
+    ColumnFloatCopy,
+    ColumnTextures,
+    ColumnIcon,
+    ColumnPixmap,
+    ColumnTotal,
+    NumColumns
+};
+
+
+/**
+ * Table cell that displays a human readable size but is sorted by its exact
+ * number of bytes
+ */
+class MemorySizeItem : public QTableWidgetItem
+{
+  public:
+    explicit MemorySizeItem(size_t bytes)
+        : QTableWidgetItem(format_memory_size(bytes))
+    {
+        setData(Qt::UserRole, static_cast<qulonglong>(bytes));
+        setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+    }
+
+    bool operator<(const QTableWidgetItem& other) const
+    {
+        return data(Qt::UserRole).toULongLong() <
+               other.data(Qt::UserRole).toULongLong();
+    }
+};
+
+} // namespace
+
+
+size_t StageMemoryUsage::host_total() const
+{
+    return host_buffer + float_copy + icon + pixmap;
+}
+
+
+size_t StageMemoryUsage::gpu_total() const
+{
+    return textures;
+}
+
+
+size_t StageMemoryUsage::total() const
+{
+    return host_total() + gpu_total();
+}
+
+
+QString format_memory_size(size_t bytes)
+{
+    const char* units[] = {"B", "KiB", "MiB", "GiB"};
+    const int num_units = sizeof(units) / sizeof(units[0]);
+
+    double size = static_cast<double>(bytes);
+    int unit    = 0;
+    while (size >= 1024.0 && unit < num_units - 1) {
+        size /= 1024.0;
+        ++unit;
+    }
+
+    return QString("%1 %2").arg(size, 0, 'f', unit == 0 ? 0 : 1).arg(
+        units[unit]);
+}
+
+
+MemoryUsagePanel::MemoryUsagePanel(QWidget* parent)
+    : QDockWidget("Memory usage", parent)
+{
+    setObjectName("memoryUsagePanel");
+
+    QWidget* contents   = new QWidget(this);
+    QVBoxLayout* layout = new QVBoxLayout(contents);
+    layout->setMargin(0);
+
+    table_ = new QTableWidget(0, NumColumns, contents);
+    table_->setHorizontalHeaderLabels(QStringList() << "Buffer"
+                                                    << "Host copy"
+                                                    << "Float copy"
+                                                    << "Textures"
+                                                    << "Icon"
+                                                    << "Pixmap"
+                                                    << "Total");
+    table_->horizontalHeader()->setSectionResizeMode(ColumnName,
+                                                     QHeaderView::Stretch);
+    table_->verticalHeader()->setVisible(false);
+    table_->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table_->setSelectionBehavior(QAbstractItemView::SelectRows);
+    table_->setSortingEnabled(true);
+    table_->sortByColumn(ColumnTotal, Qt::DescendingOrder);
+
+    summary_ = new QLabel(contents);
+
+    layout->addWidget(table_);
+    layout->addWidget(summary_);
+    setWidget(contents);
+
+    set_usage(map<string, StageMemoryUsage>(), 0);
+}
+
+
+void MemoryUsagePanel::set_usage(const map<string, StageMemoryUsage>& usage,
+                                 size_t high_water_mark)
+{
+    // Sorting must be disabled while the rows are filled, otherwise they
+    // are moved around as each cell is set
+    table_->setSortingEnabled(false);
+    table_->setRowCount(static_cast<int>(usage.size()));
+
+    StageMemoryUsage total_usage;
+    int row = 0;
+
+    for (const auto& stage_usage : usage) {
+        const StageMemoryUsage& stage = stage_usage.second;
+
+        table_->setItem(
+            row, ColumnName, new QTableWidgetItem(stage_usage.first.c_str()));
+        table_->setItem(
+            row, ColumnHostBuffer, new MemorySizeItem(stage.host_buffer));
+        table_->setItem(
+            row, ColumnFloatCopy, new MemorySizeItem(stage.float_copy));
+        table_->setItem(row, ColumnTextures, new MemorySizeItem(stage.textures));
+        table_->setItem(row, ColumnIcon, new MemorySizeItem(stage.icon));
+        table_->setItem(row, ColumnPixmap, new MemorySizeItem(stage.pixmap));
+        table_->setItem(row, ColumnTotal, new MemorySizeItem(stage.total()));
+
+        total_usage.host_buffer += stage.host_buffer;
+        total_usage.float_copy += stage.float_copy;
+        total_usage.textures += stage.textures;
+        total_usage.icon += stage.icon;
+        total_usage.pixmap += stage.pixmap;
+
+        ++row;
+    }
+
+    table_->setSortingEnabled(true);
+
+    summary_->setText(QString("Total: %1 (host: %2, GPU: %3) | "
+                              "High-water mark: %4")
+                          .arg(format_memory_size(total_usage.total()))
+                          .arg(format_memory_size(total_usage.host_total()))
+                          .arg(format_memory_size(total_usage.gpu_total()))
+                          .arg(format_memory_size(high_water_mark)));
+}
@@ -0,0 +1,80 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef MEMORY_USAGE_PANEL_H_
+#define MEMORY_USAGE_PANEL_H_
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+#include <QDockWidget>
+#include <QLabel>
+#include <QTableWidget>
+
+
+/**
+ * Memory held by the window on behalf of a single stage, in bytes
+ */
+struct StageMemoryUsage
+{
+    // Copy of the debuggee buffer kept alive in held_buffers_
+    size_t host_buffer = 0;
+    // Float32 conversion of Float64 buffers (replaces host_buffer)
+    size_t float_copy = 0;
+    // Buffer tiles (always allocated as RGBA32F)
+    size_t textures = 0;
+    // Stage::buffer_icon
+    size_t icon = 0;
+    // Pixmap of the buffer list item
+    size_t pixmap = 0;
+
+    size_t host_total() const;
+
+    size_t gpu_total() const;
+
+    size_t total() const;
+};
+
+
+QString format_memory_size(size_t bytes);
+
+
+class MemoryUsagePanel : public QDockWidget
+{
+    Q_OBJECT
+
+  public:
+    explicit MemoryUsagePanel(QWidget* parent = nullptr);
+
+    void set_usage(const std::map<std::string, StageMemoryUsage>& usage,
+                   size_t high_water_mark);
+
+  private:
+    QTableWidget* table_;
+    QLabel* summary_;
+};
+
+#endif // MEMORY_USAGE_PANEL_H_
@@ -23,6 +23,8 @@
  * IN THE SOFTWARE.
  */
 
+#include <algorithm>
+
 #include "symbol_completer.h"
 
 
@@ -44,9 +46,37 @@ void SymbolCompleter::update(const QString& word)
 }
 
 
-void SymbolCompleter::update_symbol_list(const QStringList& symbols)
+// Order of the symbol list, matching the CaseInsensitivelySortedModel
+// sorting of the completer. Names that only differ in case are ordered case
+// sensitively, so that each name has a single position in the list
+static bool symbol_less(const QString& lhs, const QString& rhs)
+{
+    const int comparison = lhs.compare(rhs, Qt::CaseInsensitive);
+    return comparison < 0 || (comparison == 0 && lhs < rhs);
+}
+
+
+void SymbolCompleter::add_symbols(const QStringList& symbols)
+{
+    for (const auto& symbol : symbols) {
+        auto position =
+            std::lower_bound(list_.begin(), list_.end(), symbol, symbol_less);
+        if (position == list_.end() || *position != symbol) {
+            list_.insert(position, symbol);
+        }
+    }
+}
+
+
+void SymbolCompleter::remove_symbols(const QStringList& symbols)
 {
-    list_ = symbols;
+    for (const auto& symbol : symbols) {
+        auto position =
+            std::lower_bound(list_.begin(), list_.end(), symbol, symbol_less);
+        if (position != list_.end() && *position == symbol) {
+            list_.erase(position);
+        }
+    }
 }
 
 
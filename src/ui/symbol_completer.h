@@ -40,7 +40,11 @@ class SymbolCompleter : public QCompleter
 
     void update(const QString& word);
 
-    void update_symbol_list(const QStringList& symbols);
+    // The symbol list is kept sorted, so that it is patched in place when
+    // the available symbols change
+    void add_symbols(const QStringList& symbols);
+
+    void remove_symbols(const QStringList& symbols);
 
     const QString& word() const;
 
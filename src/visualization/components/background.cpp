@@ -23,8 +23,11 @@
  * IN THE SOFTWARE.
  */
 
+#include <algorithm>
+
 #include "background.h"
 
+#include "buffer.h"
 #include "math/linear_algebra.h"
 #include "visualization/game_object.h"
 #include "visualization/shader.h"
@@ -51,7 +54,7 @@ bool Background::initialize()
                            shader::background_frag_shader,
                            ShaderProgram::FormatR,
                            "rgba",
-                           {});
+                           {"ndc_rect"});
 
     // Generate square VBO
     // clang-format off
@@ -76,13 +79,74 @@ bool Background::initialize()
 }
 
 
-void Background::draw(const mat4&, const mat4&)
+void Background::draw(const mat4& projection, const mat4& view_inv)
 {
     background_prog.use();
 
     gl_canvas_->glEnableVertexAttribArray(0);
     gl_canvas_->glBindBuffer(GL_ARRAY_BUFFER, background_vbo);
     gl_canvas_->glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
+
+    GameObject* buffer_obj = game_object_->stage->get_game_object("buffer");
+    Buffer* buffer = buffer_obj->get_component<Buffer>("buffer_component");
+
+    if (!buffer->is_opaque()) {
+        draw_rect(-1, -1, 1, 1);
+        return;
+    }
+
+    // The checkerboard is only shaded around opaque buffers. Their bounding
+    // box is shrunk by a small margin, so that no seam is left between them
+    // and the background
+    const float margin = 0.01f;
+    const mat4 mvp     = projection * view_inv * buffer_obj->get_pose();
+    const float half_w = buffer->buffer_width_f / 2.f;
+    const float half_h = buffer->buffer_height_f / 2.f;
+    const vec4 buffer_corners[] = {vec4(-half_w, -half_h, 0, 1),
+                                   vec4(half_w, -half_h, 0, 1),
+                                   vec4(half_w, half_h, 0, 1),
+                                   vec4(-half_w, half_h, 0, 1)};
+
+    float left = 1.f, bottom = 1.f, right = -1.f, top = -1.f;
+    for (const auto& corner : buffer_corners) {
+        const vec4 ndc_corner = mvp * corner;
+        left                  = std::min(left, ndc_corner.x() + margin);
+        bottom                = std::min(bottom, ndc_corner.y() + margin);
+        right                 = std::max(right, ndc_corner.x() - margin);
+        top                   = std::max(top, ndc_corner.y() - margin);
+    }
+
+    left   = std::max(left, -1.f);
+    bottom = std::max(bottom, -1.f);
+    right  = std::min(right, 1.f);
+    top    = std::min(top, 1.f);
+
+    if (left >= right || bottom >= top) {
+        // The buffer is out of the view, or too small to be worth it
+        draw_rect(-1, -1, 1, 1);
+        return;
+    }
+
+    if (bottom > -1.f) {
+        draw_rect(-1, -1, 1, bottom);
+    }
+    if (top < 1.f) {
+        draw_rect(-1, top, 1, 1);
+    }
+    if (left > -1.f) {
+        draw_rect(-1, bottom, left, top);
+    }
+    if (right < 1.f) {
+        draw_rect(right, bottom, 1, top);
+    }
+}
+
+
+void Background::draw_rect(float left, float bottom, float right, float top)
+{
+    const float ndc_rect[] = {left, bottom, right, top};
+
+    background_prog.uniform4fv("ndc_rect", 1, ndc_rect);
     gl_canvas_->glDrawArrays(GL_TRIANGLES, 0, 6);
 }
 
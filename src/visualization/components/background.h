@@ -50,6 +50,10 @@ class Background : public Component
   private:
     ShaderProgram background_prog;
     GLuint background_vbo;
+
+    // Shade the checkerboard in the given rectangle, in normalized device
+    // coordinates
+    void draw_rect(float left, float bottom, float right, float top);
 };
 
 #endif // BACKGROUND_H_
@@ -23,6 +23,7 @@
  * IN THE SOFTWARE.
  */
 
+#include <algorithm>
 #include <limits>
 
 #include "GL/gl.h"
@@ -30,6 +31,11 @@
 #include "buffer.h"
 
 #include "camera.h"
+#include "math/buffer_dispatch.h"
+#include "math/simd_dispatch.h"
+#include "profiling/metrics.h"
+#include "profiling/tracer.h"
+#include "ui/gl_texture_pool.h"
 #include "visualization/game_object.h"
 #include "visualization/shaders/giw_shaders.h"
 #include "visualization/stage.h"
@@ -40,6 +46,49 @@ using namespace std;
 const float Buffer::no_ac_params[8] = {1.0, 1.0, 1.0, 1.0, 0, 0, 0, 0};
 
 
+template <typename T>
+static void print_value(stringstream& message, T value)
+{
+    message << value;
+}
+
+
+// Bytes are printed as numbers rather than as characters
+static void print_value(stringstream& message, uint8_t value)
+{
+    message << static_cast<int>(value);
+}
+
+
+struct PixelInfoKernel
+{
+    template <typename T, int Channels>
+    static void run(const uint8_t* data, int pos, stringstream& message)
+    {
+        const T* values = reinterpret_cast<const T*>(data) + pos;
+
+        message << "[";
+        for (int c = 0; c < Channels; ++c) {
+            print_value(message, values[c]);
+            if (c < Channels - 1) {
+                message << " ";
+            }
+        }
+        message << "]";
+    }
+};
+
+
+struct MaxIntensityKernel
+{
+    template <typename T, int Channels>
+    static void run(float& max_intensity)
+    {
+        max_intensity = get_max_intensity<T>();
+    }
+};
+
+
 Buffer::Buffer(GameObject* game_object, GLCanvas* gl_canvas)
     : Component(game_object, gl_canvas)
     , buff_prog(gl_canvas)
@@ -49,17 +98,18 @@ Buffer::Buffer(GameObject* game_object, GLCanvas* gl_canvas)
 
 Buffer::~Buffer()
 {
-    int num_textures = num_textures_x * num_textures_y;
-
-    gl_canvas_->glDeleteTextures(num_textures, buff_tex.data());
+    release_textures();
+    release_regions();
     gl_canvas_->glDeleteBuffers(1, &vbo);
 }
 
 
 bool Buffer::buffer_update()
 {
-    int num_textures = num_textures_x * num_textures_y;
-    glDeleteTextures(num_textures, buff_tex.data());
+    // Tiles with the same dimensions as before get their textures back from
+    // the pool. Regions of the previous contents are dropped
+    release_textures();
+    release_regions();
 
     create_shader_program();
     setup_gl_buffer();
@@ -69,39 +119,56 @@ bool Buffer::buffer_update()
 
 void Buffer::get_pixel_info(stringstream& message, int x, int y)
 {
-    if (x < 0 || x >= buffer_width_f || y < 0 || y >= buffer_height_f) {
+    // Downsampled buffers are inspected in full buffer pixels
+    const int width_i  = downsample > 1 ? full_width : buffer_width_f;
+    const int height_i = downsample > 1 ? full_height : buffer_height_f;
+
+    if (x < 0 || x >= width_i || y < 0 || y >= height_i) {
         message << "[out of bounds]";
         return;
     }
 
-    int pos = channels * (y * step + x);
-
-    message << "[";
-
-    for (int c = 0; c < channels; ++c) {
-        if (type == Buffer::BufferType::Float32 ||
-            type == Buffer::BufferType::Float64) {
-            float fpix = reinterpret_cast<float*>(buffer)[pos + c];
-            message << fpix;
-        } else if (type == Buffer::BufferType::UnsignedByte) {
-            short fpix = buffer[pos + c];
-            message << fpix;
-        } else if (type == Buffer::BufferType::Short) {
-            short fpix = reinterpret_cast<short*>(buffer)[pos + c];
-            message << fpix;
-        } else if (type == Buffer::BufferType::UnsignedShort) {
-            unsigned short fpix =
-                reinterpret_cast<unsigned short*>(buffer)[pos + c];
-            message << fpix;
-        } else if (type == Buffer::BufferType::Int32) {
-            int fpix = reinterpret_cast<int*>(buffer)[pos + c];
-            message << fpix;
-        }
-        if (c < channels - 1) {
-            message << " ";
+    const uint8_t* data = buffer;
+    int pos             = channels * (y * step + x);
+
+    if (downsample > 1) {
+        // Show the closest sample, from the finest region available
+        const CachedRegion* region = finest_region_at(x, y);
+        if (region != nullptr) {
+            const BufferRegionRequest& request = region->request;
+            data                               = region->data;
+            pos = channels * ((y - request.y) / request.step *
+                                  region->sampled_width +
+                              (x - request.x) / request.step);
+        } else {
+            pos = channels * (y / downsample * step + x / downsample);
         }
     }
-    message << "]";
+
+    dispatch_buffer_type<PixelInfoKernel>(
+        get_stored_type(), channels, data, pos, message);
+}
+
+
+vec4 Buffer::stage_to_source_coordinates(const vec4& stage_coordinates) const
+{
+    const float scale = static_cast<float>(downsample * slice_step);
+
+    return vec4(slice_x + stage_coordinates.x() * scale,
+                slice_y + stage_coordinates.y() * scale,
+                stage_coordinates.z(),
+                stage_coordinates.w());
+}
+
+
+vec4 Buffer::source_to_stage_coordinates(const vec4& source_coordinates) const
+{
+    const float scale = static_cast<float>(downsample * slice_step);
+
+    return vec4((source_coordinates.x() - slice_x) / scale,
+                (source_coordinates.y() - slice_y) / scale,
+                source_coordinates.z(),
+                source_coordinates.w());
 }
 
 
@@ -113,98 +180,67 @@ void Buffer::rotate(float angle)
 
 void Buffer::recompute_min_color_values()
 {
-    int buffer_width_i  = static_cast<int>(buffer_width_f);
-    int buffer_height_i = static_cast<int>(buffer_height_f);
-
     float* lowest = min_buffer_values();
+    float upper[4];
 
-    for (int i = 0; i < 4; ++i)
-        lowest[i] = std::numeric_limits<float>::max();
+    compute_min_max_color_values(lowest, upper);
+}
 
-    for (int y = 0; y < buffer_height_i; ++y) {
-        for (int x = 0; x < buffer_width_i; ++x) {
-            int i = y * step + x;
-            for (int c = 0; c < channels; ++c) {
-                if (type == BufferType::Float32 || type == BufferType::Float64)
-                    lowest[c] = std::min(
-                        lowest[c],
-                        reinterpret_cast<float*>(buffer)[channels * i + c]);
-                else if (type == BufferType::UnsignedByte)
-                    lowest[c] =
-                        std::min(lowest[c],
-                                 static_cast<float>(buffer[channels * i + c]));
-                else if (type == BufferType::Short)
-                    lowest[c] =
-                        std::min(lowest[c],
-                                 static_cast<float>(reinterpret_cast<short*>(
-                                     buffer)[channels * i + c]));
-                else if (type == BufferType::UnsignedShort)
-                    lowest[c] = std::min(
-                        lowest[c],
-                        static_cast<float>(reinterpret_cast<unsigned short*>(
-                            buffer)[channels * i + c]));
-                else if (type == BufferType::Int32)
-                    lowest[c] =
-                        std::min(lowest[c],
-                                 static_cast<float>(reinterpret_cast<int*>(
-                                     buffer)[channels * i + c]));
-            }
-        }
-    }
 
-    // For single channel buffers: fill with 0
-    for (int c = channels; c < 4; ++c)
-        lowest[c] = 0.0;
+void Buffer::recompute_max_color_values()
+{
+    float lowest[4];
+    float* upper = max_buffer_values();
+
+    compute_min_max_color_values(lowest, upper);
 }
 
 
-void Buffer::recompute_max_color_values()
+void Buffer::compute_min_max_color_values(float* lowest, float* upper) const
 {
-    int buffer_width_i  = static_cast<int>(buffer_width_f);
-    int buffer_height_i = static_cast<int>(buffer_height_f);
+    for (int i = 0; i < 4; ++i) {
+        lowest[i] = std::numeric_limits<float>::max();
+        upper[i]  = std::numeric_limits<float>::lowest();
+    }
 
-    float* upper = max_buffer_values();
-    for (int i = 0; i < 4; ++i)
-        upper[i] = std::numeric_limits<float>::lowest();
-
-    for (int y = 0; y < buffer_height_i; ++y) {
-        for (int x = 0; x < buffer_width_i; ++x) {
-            int i = y * step + x;
-            for (int c = 0; c < channels; ++c) {
-                if (type == BufferType::Float32 || type == BufferType::Float64)
-                    upper[c] = std::max(
-                        upper[c],
-                        reinterpret_cast<float*>(buffer)[channels * i + c]);
-                else if (type == BufferType::UnsignedByte)
-                    upper[c] = std::max(
-                        upper[c], static_cast<float>(buffer[channels * i + c]));
-                else if (type == BufferType::Short)
-                    upper[c] =
-                        std::max(upper[c],
-                                 static_cast<float>(reinterpret_cast<short*>(
-                                     buffer)[channels * i + c]));
-                else if (type == BufferType::UnsignedShort)
-                    upper[c] = std::max(
-                        upper[c],
-                        static_cast<float>(reinterpret_cast<unsigned short*>(
-                            buffer)[channels * i + c]));
-                else if (type == BufferType::Int32)
-                    upper[c] =
-                        std::max(upper[c],
-                                 static_cast<float>(reinterpret_cast<int*>(
-                                     buffer)[channels * i + c]));
-            }
+    BufferDescriptor descriptor{buffer,
+                                static_cast<int>(buffer_width_f),
+                                static_cast<int>(buffer_height_f),
+                                channels,
+                                get_stored_type(),
+                                step};
+
+    // Large buffers are scanned by blocks of rows in the task workers
+    const int num_blocks = get_num_scan_blocks(descriptor);
+    vector<float> block_lowest(4 * num_blocks, lowest[0]);
+    vector<float> block_upper(4 * num_blocks, upper[0]);
+
+    for_each_row_block(
+        descriptor, num_blocks, [&](int block, int first_row, int last_row) {
+            get_simd_kernels().min_max(descriptor.rows(first_row, last_row),
+                                       &block_lowest[4 * block],
+                                       &block_upper[4 * block]);
+        });
+
+    for (int block = 0; block < num_blocks; ++block) {
+        for (int c = 0; c < channels; ++c) {
+            lowest[c] = std::min(lowest[c], block_lowest[4 * block + c]);
+            upper[c]  = std::max(upper[c], block_upper[4 * block + c]);
         }
     }
 
     // For single channel buffers: fill with 0
-    for (int c = channels; c < 4; ++c)
-        upper[c] = 0.0;
+    for (int c = channels; c < 4; ++c) {
+        lowest[c] = 0.0;
+        upper[c]  = 0.0;
+    }
 }
 
 
 void Buffer::reset_contrast_brightness_parameters()
 {
+    GIW_TRACE_SCOPE("min_max");
+
     recompute_min_color_values();
     recompute_max_color_values();
 
@@ -220,20 +256,11 @@ void Buffer::compute_contrast_brightness_parameters()
     float* auto_buffer_contrast   = auto_buffer_contrast_brightness_;
     float* auto_buffer_brightness = auto_buffer_contrast_brightness_ + 4;
 
-    for (int c = 0; c < channels; ++c) {
-        float maxIntensity = 1.0f;
-        if (type == BufferType::UnsignedByte)
-            maxIntensity = 255.0f;
-        else if (type ==
-                 BufferType::Short) // All non-real values have max color 255
-            maxIntensity = std::numeric_limits<short>::max();
-        else if (type == BufferType::UnsignedShort)
-            maxIntensity = std::numeric_limits<unsigned short>::max();
-        else if (type == BufferType::Int32)
-            maxIntensity = std::numeric_limits<int>::max();
-        else if (type == BufferType::Float32 || type == BufferType::Float64)
-            maxIntensity = 1.0f;
+    float maxIntensity = 1.0f;
+    dispatch_buffer_type<MaxIntensityKernel>(
+        get_stored_type(), channels, maxIntensity);
 
+    for (int c = 0; c < channels; ++c) {
         float upp_minus_low = upper[c] - lowest[c];
 
         if (upp_minus_low == 0)
@@ -296,6 +323,19 @@ const char* Buffer::get_pixel_layout() const
 }
 
 
+Buffer::BufferType Buffer::get_stored_type() const
+{
+    return type == BufferType::Float64 ? BufferType::Float32 : type;
+}
+
+
+bool Buffer::is_opaque() const
+{
+    // Textures of buffers with less than four channels have an alpha of 1
+    return channels < 4 && pixel_layout_[3] == 'a';
+}
+
+
 float Buffer::tile_coord_x(int x)
 {
     int buffer_width_i = static_cast<int>(buffer_width_f);
@@ -416,12 +456,39 @@ bool Buffer::initialize()
 }
 
 
+// Axis-aligned bounding box [lower, upper] of the area of the model space
+// that is visible through the transform mvp
+static void get_visible_area(const mat4& mvp, vec4& lower, vec4& upper)
+{
+    const mat4 mvp_inv = mvp.inv();
+    const vec4 ndc_corners[] = {vec4(-1, -1, 0, 1),
+                                vec4(1, -1, 0, 1),
+                                vec4(1, 1, 0, 1),
+                                vec4(-1, 1, 0, 1)};
+
+    lower = mvp_inv * ndc_corners[0];
+    upper = lower;
+    for (int i = 1; i < 4; ++i) {
+        vec4 corner = mvp_inv * ndc_corners[i];
+        lower.x()   = std::min(lower.x(), corner.x());
+        lower.y()   = std::min(lower.y(), corner.y());
+        upper.x()   = std::max(upper.x(), corner.x());
+        upper.y()   = std::max(upper.y(), corner.y());
+    }
+}
+
+
 void Buffer::draw(const mat4& projection, const mat4& viewInv)
 {
     buff_prog.use();
     mat4 model = game_object_->get_pose();
     mat4 mvp   = projection * viewInv * model;
 
+    // Tiles out of the view are not drawn
+    vec4 visible_lower;
+    vec4 visible_upper;
+    get_visible_area(mvp, visible_lower, visible_upper);
+
     gl_canvas_->glEnableVertexAttribArray(0);
     gl_canvas_->glActiveTexture(GL_TEXTURE0);
 
@@ -459,34 +526,44 @@ void Buffer::draw(const mat4& projection, const mat4& viewInv)
             px -= 0.5;
         }
 
+        const bool row_visible = py + buff_h / 2.f >= visible_lower.y() &&
+                                 py - buff_h / 2.f <= visible_upper.y();
+
         for (int tx = 0; tx < num_textures_x; ++tx) {
             int buff_w = std::min(remaining_w, max_texture_size);
             remaining_w -= buff_w;
 
-            glBindTexture(GL_TEXTURE_2D, buff_tex[ty * num_textures_x + tx]);
-
-            mat4 tile_model;
-
             px += buff_w / 2;
             if (buff_w % 2 == 1) {
                 px += 0.5;
             }
 
-            tile_model.set_from_st(buff_w, buff_h, 1.0, px, py, 0.0f);
-            buff_prog.uniform_matrix4fv(
-                "mvp", 1, GL_FALSE, (mvp * tile_model).data());
-            buff_prog.uniform2f("buffer_dimension", buff_w, buff_h);
+            if (row_visible && px + buff_w / 2.f >= visible_lower.x() &&
+                px - buff_w / 2.f <= visible_upper.x()) {
+                glBindTexture(GL_TEXTURE_2D,
+                              buff_tex[ty * num_textures_x + tx]);
+
+                mat4 tile_model;
+                tile_model.set_from_st(buff_w, buff_h, 1.0, px, py, 0.0f);
+                buff_prog.uniform_matrix4fv(
+                    "mvp", 1, GL_FALSE, (mvp * tile_model).data());
+                buff_prog.uniform2f("buffer_dimension", buff_w, buff_h);
+
+                gl_canvas_->glBindBuffer(GL_ARRAY_BUFFER, vbo);
+                gl_canvas_->glVertexAttribPointer(
+                    0, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
+                gl_canvas_->glDrawArrays(GL_TRIANGLES, 0, 6);
+            }
 
             px += buff_w / 2;
-
-            gl_canvas_->glBindBuffer(GL_ARRAY_BUFFER, vbo);
-            gl_canvas_->glVertexAttribPointer(
-                0, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
-            gl_canvas_->glDrawArrays(GL_TRIANGLES, 0, 6);
         }
 
         py += buff_h / 2;
     }
+
+    if (!regions_.empty()) {
+        draw_regions(mvp);
+    }
 }
 
 
@@ -521,36 +598,24 @@ void Buffer::setup_gl_buffer()
     num_textures_y = ceil(((float)buffer_height_i) / ((float)max_texture_size));
     int num_textures = num_textures_x * num_textures_y;
 
-    buff_tex.resize(num_textures);
-    glGenTextures(num_textures, buff_tex.data());
+    // The software renderer samples the buffer in host memory
+    if (gl_canvas_->is_software_rendering()) {
+        return;
+    }
 
-    GLuint tex_type   = GL_UNSIGNED_BYTE;
-    GLuint tex_format = GL_RED;
+    buff_tex.resize(num_textures);
 
-    if (type == BufferType::Float32 || type == BufferType::Float64) {
-        tex_type = GL_FLOAT;
-    } else if (type == BufferType::UnsignedByte) {
-        tex_type = GL_UNSIGNED_BYTE;
-    } else if (type == BufferType::Short) {
-        tex_type = GL_SHORT;
-    } else if (type == BufferType::UnsignedShort) {
-        tex_type = GL_UNSIGNED_SHORT;
-    } else if (type == BufferType::Int32) {
-        tex_type = GL_INT;
-    }
+    GLTexturePool* texture_pool = gl_canvas_->get_texture_pool();
 
-    if (channels == 1) {
-        tex_format = GL_RED;
-    } else if (channels == 2) {
-        tex_format = GL_RG;
-    } else if (channels == 3) {
-        tex_format = GL_RGB;
-    } else if (channels == 4) {
-        tex_format = GL_RGBA;
-    }
+    GLuint tex_type;
+    GLuint tex_format;
+    int tex_type_size;
+    get_texture_format(tex_type, tex_format, tex_type_size);
 
     int remaining_h = buffer_height_i;
 
+    GIW_TRACE_SCOPE("texture_upload");
+
     glPixelStoref(GL_UNPACK_ALIGNMENT, 1);
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
     glPixelStorei(GL_UNPACK_ROW_LENGTH, step);
@@ -564,7 +629,11 @@ void Buffer::setup_gl_buffer()
             int buff_w = std::min(remaining_w, max_texture_size);
             remaining_w -= buff_w;
 
+            // The pool allocates the texture storage and sets the sampling
+            // parameters; only the contents must be uploaded
             int tex_id = ty * num_textures_x + tx;
+            buff_tex[tex_id] =
+                texture_pool->acquire(buff_w, buff_h, GL_RGBA32F);
             gl_canvas_->glBindTexture(GL_TEXTURE_2D, buff_tex[tex_id]);
 
             gl_canvas_->glPixelStorei(GL_UNPACK_SKIP_ROWS,
@@ -572,16 +641,6 @@ void Buffer::setup_gl_buffer()
             gl_canvas_->glPixelStorei(GL_UNPACK_SKIP_PIXELS,
                                       tx * max_texture_size);
 
-            gl_canvas_->glTexImage2D(GL_TEXTURE_2D,
-                                     0,
-                                     GL_RGBA32F,
-                                     buff_w,
-                                     buff_h,
-                                     0,
-                                     tex_format,
-                                     tex_type,
-                                     nullptr);
-
             gl_canvas_->glTexSubImage2D(GL_TEXTURE_2D,
                                         0,
                                         0,
@@ -591,21 +650,474 @@ void Buffer::setup_gl_buffer()
                                         tex_format,
                                         tex_type,
                                         reinterpret_cast<GLvoid*>(buffer));
+        }
+    }
+
+    gl_canvas_->glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    gl_canvas_->glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+    gl_canvas_->glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
 
-            gl_canvas_->glTexParameteri(
-                GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-            gl_canvas_->glTexParameteri(
-                GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-            gl_canvas_->glTexParameteri(
-                GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-            gl_canvas_->glTexParameteri(
-                GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-            gl_canvas_->glTexParameteri(
-                GL_TEXTURE_2D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    Metrics::add_to_counter("bytes_uploaded",
+                            static_cast<uint64_t>(buffer_width_i) *
+                                buffer_height_i * channels * tex_type_size);
+}
+
+
+void Buffer::release_video_memory()
+{
+    release_textures();
+    release_regions();
+}
+
+
+void Buffer::release_textures()
+{
+    GLTexturePool* texture_pool = gl_canvas_->get_texture_pool();
+
+    for (GLuint texture : buff_tex) {
+        texture_pool->release(texture);
+    }
+
+    buff_tex.clear();
+}
+
+
+void Buffer::update_rows(const vector<pair<int, int>>& dirty_rows)
+{
+    int buffer_width_i  = static_cast<int>(buffer_width_f);
+    int buffer_height_i = static_cast<int>(buffer_height_f);
+
+    // The contrast parameters depend on the whole buffer
+    reset_contrast_brightness_parameters();
+
+    if (buff_tex.empty()) {
+        return;
+    }
+
+    GLuint tex_type;
+    GLuint tex_format;
+    int tex_type_size;
+    get_texture_format(tex_type, tex_format, tex_type_size);
+
+    GIW_TRACE_SCOPE("texture_upload");
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, step);
+
+    uint64_t uploaded_rows = 0;
+
+    for (const auto& rows : dirty_rows) {
+        const int last_row = std::min(rows.second, buffer_height_i);
+
+        // A range of rows may cross the boundary between two rows of tiles
+        for (int row = std::max(rows.first, 0); row < last_row;) {
+            const int ty             = row / max_texture_size;
+            const int tile_first_row = ty * max_texture_size;
+            const int tile_last_row  =
+                std::min(last_row, tile_first_row + max_texture_size);
+
+            int remaining_w = buffer_width_i;
+            for (int tx = 0; tx < num_textures_x; ++tx) {
+                int buff_w = std::min(remaining_w, max_texture_size);
+                remaining_w -= buff_w;
+
+                int tex_id = ty * num_textures_x + tx;
+                gl_canvas_->glBindTexture(GL_TEXTURE_2D, buff_tex[tex_id]);
+
+                gl_canvas_->glPixelStorei(GL_UNPACK_SKIP_ROWS, row);
+                gl_canvas_->glPixelStorei(GL_UNPACK_SKIP_PIXELS,
+                                          tx * max_texture_size);
+
+                gl_canvas_->glTexSubImage2D(GL_TEXTURE_2D,
+                                            0,
+                                            0,
+                                            row - tile_first_row,
+                                            buff_w,
+                                            tile_last_row - row,
+                                            tex_format,
+                                            tex_type,
+                                            reinterpret_cast<GLvoid*>(buffer));
+            }
+
+            uploaded_rows += tile_last_row - row;
+            row = tile_last_row;
         }
     }
 
     gl_canvas_->glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
     gl_canvas_->glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
     gl_canvas_->glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+
+    Metrics::add_to_counter("partial_buffer_updates", 1);
+    Metrics::add_to_counter("bytes_uploaded",
+                            uploaded_rows * buffer_width_i * channels *
+                                tex_type_size);
+}
+
+
+bool Buffer::has_layout(int buffer_width_i,
+                        int buffer_height_i,
+                        int channels,
+                        BufferType type,
+                        int step,
+                        bool transpose) const
+{
+    return static_cast<int>(buffer_width_f) == buffer_width_i &&
+           static_cast<int>(buffer_height_f) == buffer_height_i &&
+           this->channels == channels && this->type == type &&
+           this->step == step && this->transpose == transpose;
+}
+
+
+void Buffer::get_texture_format(GLuint& tex_type,
+                                GLuint& tex_format,
+                                int& tex_type_size) const
+{
+    tex_type      = GL_UNSIGNED_BYTE;
+    tex_format    = GL_RED;
+    tex_type_size = 1;
+
+    if (type == BufferType::Float32 || type == BufferType::Float64) {
+        tex_type      = GL_FLOAT;
+        tex_type_size = sizeof(float);
+    } else if (type == BufferType::UnsignedByte) {
+        tex_type      = GL_UNSIGNED_BYTE;
+        tex_type_size = sizeof(uint8_t);
+    } else if (type == BufferType::Short) {
+        tex_type      = GL_SHORT;
+        tex_type_size = sizeof(short);
+    } else if (type == BufferType::UnsignedShort) {
+        tex_type      = GL_UNSIGNED_SHORT;
+        tex_type_size = sizeof(unsigned short);
+    } else if (type == BufferType::Int32) {
+        tex_type      = GL_INT;
+        tex_type_size = sizeof(int);
+    }
+
+    if (channels == 1) {
+        tex_format = GL_RED;
+    } else if (channels == 2) {
+        tex_format = GL_RG;
+    } else if (channels == 3) {
+        tex_format = GL_RGB;
+    } else if (channels == 4) {
+        tex_format = GL_RGBA;
+    }
+}
+
+
+size_t Buffer::texture_memory_usage() const
+{
+    // Textures are always stored as GL_RGBA32F. The buffer has none when it
+    // is drawn by the software renderer
+    size_t texels = 0;
+    if (!buff_tex.empty()) {
+        texels = static_cast<size_t>(buffer_width_f) *
+                 static_cast<size_t>(buffer_height_f);
+    }
+
+    for (const auto& region : regions_) {
+        texels += static_cast<size_t>(region.second.sampled_width) *
+                  region.second.sampled_height;
+    }
+
+    return texels * 4 * sizeof(float);
+}
+
+
+bool Buffer::RegionKey::operator<(const RegionKey& other) const
+{
+    if (step != other.step) {
+        return step < other.step;
+    }
+    if (index_y != other.index_y) {
+        return index_y < other.index_y;
+    }
+    return index_x < other.index_x;
+}
+
+
+vector<BufferRegionRequest> Buffer::take_missing_regions()
+{
+    vector<BufferRegionRequest> missing_regions;
+
+    // Regions are drawn from textures, which the software renderer lacks
+    if (downsample <= 1 || gl_canvas_->is_software_rendering()) {
+        return missing_regions;
+    }
+
+    const uint64_t now_us = Tracer::now_us();
+
+    // Requests may be lost (e.g. if the debuggee is running)
+    for (auto request = requested_regions_.begin();
+         request != requested_regions_.end();) {
+        if (now_us - request->second > region_request_timeout_us) {
+            request = requested_regions_.erase(request);
+        } else {
+            ++request;
+        }
+    }
+
+    GameObject* cam_obj = game_object_->stage->get_game_object("camera");
+    Camera* camera      = cam_obj->get_component<Camera>("camera_component");
+    const float zoom    = camera->compute_zoom();
+
+    // Finest power of two step with at most one sample per screen pixel
+    int region_step = 1;
+    while (region_step * zoom < downsample) {
+        region_step *= 2;
+    }
+
+    if (region_step >= downsample) {
+        // The overview is detailed enough
+        return missing_regions;
+    }
+
+    // Visible area, in buffer pixels. Its half extent is computed from the
+    // largest canvas dimension, so that it covers rotated views as well
+    vec4 center            = camera->get_position();
+    const float center_x   = center.x() * downsample;
+    const float center_y   = center.y() * downsample;
+    const float half_extent =
+        std::max(gl_canvas_->width(), gl_canvas_->height()) * 0.5f /
+        zoom * downsample;
+    const int region_extent = region_size * region_step;
+
+    const int first_x = std::max(
+        0, static_cast<int>(floor((center_x - half_extent) / region_extent)));
+    const int last_x =
+        std::min((full_width - 1) / region_extent,
+                 static_cast<int>(floor((center_x + half_extent) /
+                                        region_extent)));
+    const int first_y = std::max(
+        0, static_cast<int>(floor((center_y - half_extent) / region_extent)));
+    const int last_y =
+        std::min((full_height - 1) / region_extent,
+                 static_cast<int>(floor((center_y + half_extent) /
+                                        region_extent)));
+
+    vector<pair<float, RegionKey>> candidates;
+
+    for (int index_y = first_y; index_y <= last_y; ++index_y) {
+        for (int index_x = first_x; index_x <= last_x; ++index_x) {
+            const RegionKey key{region_step, index_x, index_y};
+
+            auto cached_region = regions_.find(key);
+            if (cached_region != regions_.end()) {
+                cached_region->second.last_visible_us = now_us;
+                continue;
+            }
+
+            if (requested_regions_.find(key) != requested_regions_.end()) {
+                continue;
+            }
+
+            const float distance_x =
+                (index_x + 0.5f) * region_extent - center_x;
+            const float distance_y =
+                (index_y + 0.5f) * region_extent - center_y;
+            candidates.emplace_back(
+                distance_x * distance_x + distance_y * distance_y, key);
+        }
+    }
+
+    std::sort(candidates.begin(),
+              candidates.end(),
+              [](const pair<float, RegionKey>& a,
+                 const pair<float, RegionKey>& b) {
+                  return a.first < b.first;
+              });
+
+    for (const auto& candidate : candidates) {
+        if (requested_regions_.size() >= max_requested_regions) {
+            break;
+        }
+
+        const RegionKey& key = candidate.second;
+        requested_regions_[key] = now_us;
+
+        BufferRegionRequest request;
+        request.x      = key.index_x * region_extent;
+        request.y      = key.index_y * region_extent;
+        request.width  = std::min(region_extent, full_width - request.x);
+        request.height = std::min(region_extent, full_height - request.y);
+        request.step   = region_step;
+        missing_regions.push_back(request);
+    }
+
+    return missing_regions;
+}
+
+
+void Buffer::add_region(const BufferRegionRequest& region,
+                        int channels,
+                        BufferType type,
+                        const shared_ptr<uint8_t>& data_owner,
+                        uint8_t* data)
+{
+    const int region_extent = region_size * region.step;
+    const RegionKey key{
+        region.step, region.x / region_extent, region.y / region_extent};
+
+    requested_regions_.erase(key);
+
+    if (gl_canvas_->is_software_rendering()) {
+        return;
+    }
+
+    const int sampled_width  = (region.width + region.step - 1) / region.step;
+    const int sampled_height = (region.height + region.step - 1) / region.step;
+
+    // Regions requested before the buffer changed its dimensions or type are
+    // discarded
+    if (downsample <= 1 || region.step >= downsample ||
+        channels != this->channels || type != this->type ||
+        region.x % region_extent != 0 || region.y % region_extent != 0 ||
+        region.x + (sampled_width - 1) * region.step >= full_width ||
+        region.y + (sampled_height - 1) * region.step >= full_height) {
+        return;
+    }
+
+    CachedRegion cached_region;
+    cached_region.request = region;
+    cached_region.request.width =
+        std::min(region.width, full_width - region.x);
+    cached_region.request.height =
+        std::min(region.height, full_height - region.y);
+    cached_region.sampled_width   = sampled_width;
+    cached_region.sampled_height  = sampled_height;
+    cached_region.data_owner      = data_owner;
+    cached_region.data            = data;
+    cached_region.last_visible_us = Tracer::now_us();
+
+    GLuint tex_type;
+    GLuint tex_format;
+    int tex_type_size;
+    get_texture_format(tex_type, tex_format, tex_type_size);
+
+    GLTexturePool* texture_pool = gl_canvas_->get_texture_pool();
+
+    {
+        GIW_TRACE_SCOPE("texture_upload");
+
+        cached_region.texture = texture_pool->acquire(
+            cached_region.sampled_width,
+            cached_region.sampled_height,
+            GL_RGBA32F);
+        gl_canvas_->glBindTexture(GL_TEXTURE_2D, cached_region.texture);
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        gl_canvas_->glTexSubImage2D(GL_TEXTURE_2D,
+                                    0,
+                                    0,
+                                    0,
+                                    cached_region.sampled_width,
+                                    cached_region.sampled_height,
+                                    tex_format,
+                                    tex_type,
+                                    reinterpret_cast<GLvoid*>(data));
+    }
+
+    Metrics::add_to_counter("bytes_uploaded",
+                            static_cast<uint64_t>(
+                                cached_region.sampled_width) *
+                                cached_region.sampled_height * channels *
+                                tex_type_size);
+
+    auto previous_region = regions_.find(key);
+    if (previous_region != regions_.end()) {
+        texture_pool->release(previous_region->second.texture);
+    }
+    regions_[key] = cached_region;
+
+    // Evict the regions that were out of view for the longest time
+    while (regions_.size() > max_cached_regions) {
+        auto evicted_region = regions_.begin();
+        for (auto it = regions_.begin(); it != regions_.end(); ++it) {
+            if (it->second.last_visible_us <
+                evicted_region->second.last_visible_us) {
+                evicted_region = it;
+            }
+        }
+
+        texture_pool->release(evicted_region->second.texture);
+        regions_.erase(evicted_region);
+    }
+}
+
+
+const Buffer::CachedRegion* Buffer::finest_region_at(int x, int y) const
+{
+    // Regions are sorted by increasing step
+    for (const auto& region : regions_) {
+        const BufferRegionRequest& request = region.second.request;
+        if (x >= request.x && x < request.x + request.width &&
+            y >= request.y && y < request.y + request.height) {
+            return &region.second;
+        }
+    }
+
+    return nullptr;
+}
+
+
+void Buffer::draw_regions(const mat4& mvp)
+{
+    const float overview_scale = 1.f / downsample;
+
+    vec4 visible_lower;
+    vec4 visible_upper;
+    get_visible_area(mvp, visible_lower, visible_upper);
+
+    // Finer regions are drawn last, over the coarser ones
+    for (auto region = regions_.rbegin(); region != regions_.rend();
+         ++region) {
+        const CachedRegion& cached_region  = region->second;
+        const BufferRegionRequest& request = cached_region.request;
+
+        // The last sample of each row and column may extend past the region
+        const float width  = cached_region.sampled_width * request.step;
+        const float height = cached_region.sampled_height * request.step;
+
+        const float left = request.x * overview_scale - buffer_width_f / 2.f;
+        const float top  = request.y * overview_scale - buffer_height_f / 2.f;
+        if (left > visible_upper.x() || top > visible_upper.y() ||
+            left + width * overview_scale < visible_lower.x() ||
+            top + height * overview_scale < visible_lower.y()) {
+            continue;
+        }
+
+        mat4 region_model;
+        region_model.set_from_st(width * overview_scale,
+                                 height * overview_scale,
+                                 1.0,
+                                 left + width * overview_scale / 2.f,
+                                 top + height * overview_scale / 2.f,
+                                 0.0f);
+
+        glBindTexture(GL_TEXTURE_2D, cached_region.texture);
+        buff_prog.uniform_matrix4fv(
+            "mvp", 1, GL_FALSE, (mvp * region_model).data());
+        buff_prog.uniform2f("buffer_dimension",
+                            cached_region.sampled_width,
+                            cached_region.sampled_height);
+
+        gl_canvas_->glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        gl_canvas_->glVertexAttribPointer(
+            0, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
+        gl_canvas_->glDrawArrays(GL_TRIANGLES, 0, 6);
+    }
+}
+
+
+void Buffer::release_regions()
+{
+    GLTexturePool* texture_pool = gl_canvas_->get_texture_pool();
+
+    for (const auto& region : regions_) {
+        texture_pool->release(region.second.texture);
+    }
+
+    regions_.clear();
+    requested_regions_.clear();
 }
@@ -26,13 +26,31 @@
 #ifndef BUFFER_H_
 #define BUFFER_H_
 
+#include <cstdint>
+#include <map>
+#include <memory>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 #include "component.h"
 #include "visualization/shader.h"
 
 
+/**
+ * Region of a downsampled buffer to be fetched from the debuggee: every
+ * step-th pixel of [x, x + width) x [y, y + height), in buffer pixels
+ */
+struct BufferRegionRequest
+{
+    int x;
+    int y;
+    int width;
+    int height;
+    int step;
+};
+
+
 class Buffer : public Component
 {
   public:
@@ -65,10 +83,39 @@ class Buffer : public Component
 
     bool transpose;
 
+    // Buffers too large to be fetched at full resolution are shown as an
+    // overview, in which each pixel stands for downsample x downsample pixels
+    // of a buffer of full_width x full_height pixels. The world coordinates
+    // of the stage remain those of the overview
+    int downsample  = 1;
+    int full_width  = 0;
+    int full_height = 0;
+
+    // Buffers plotted from a slice expression (e.g. img[100:612, ::2]) hold
+    // every slice_step-th pixel of every slice_step-th row of the sliced
+    // buffer, from its pixel (slice_x, slice_y)
+    int slice_x    = 0;
+    int slice_y    = 0;
+    int slice_step = 1;
+
     ~Buffer();
 
     bool buffer_update();
 
+    /**
+     * Re-upload the rows [first, last) in dirty_rows to the existing textures.
+     * The buffer dimensions and format must not have changed since the last
+     * full update (see has_layout())
+     */
+    void update_rows(const std::vector<std::pair<int, int>>& dirty_rows);
+
+    bool has_layout(int buffer_width_i,
+                    int buffer_height_i,
+                    int channels,
+                    BufferType type,
+                    int step,
+                    bool transpose) const;
+
     void recompute_min_color_values();
 
     void recompute_max_color_values();
@@ -83,6 +130,17 @@ class Buffer : public Component
 
     const char* get_pixel_layout() const;
 
+    /**
+     * Type of the values in buffer, which differs from type for Float64
+     * buffers: they are converted to Float32 when they are plotted
+     */
+    BufferType get_stored_type() const;
+
+    /**
+     * Whether the buffer hides everything drawn behind it
+     */
+    bool is_opaque() const;
+
     float tile_coord_x(int x);
     float tile_coord_y(int y);
 
@@ -106,15 +164,102 @@ class Buffer : public Component
 
     void get_pixel_info(std::stringstream& output, int x, int y);
 
+    /**
+     * Convert stage coordinates to pixel coordinates of the buffer in the
+     * debuggee, which differ for downsampled and sliced buffers, and back
+     */
+    vec4 stage_to_source_coordinates(const vec4& stage_coordinates) const;
+    vec4 source_to_stage_coordinates(const vec4& source_coordinates) const;
+
     void rotate(float angle);
 
+    /**
+     * Video memory taken by the buffer textures, in bytes
+     */
+    size_t texture_memory_usage() const;
+
+    /**
+     * Give the textures of the buffer and of its regions back to the texture
+     * pool. The buffer must not be drawn until its next buffer_update()
+     */
+    void release_video_memory();
+
+    /**
+     * Regions of a downsampled buffer that must be fetched with a finer
+     * sampling step for the current view, nearest to the center of the view
+     * first. Returned regions are considered requested, and are only
+     * returned again if they are not received within a few seconds
+     */
+    std::vector<BufferRegionRequest> take_missing_regions();
+
+    /**
+     * Show a region returned by take_missing_regions(), whose samples are
+     * contiguous in data. The region is kept, and its samples are shown in
+     * get_pixel_info(), until the next buffer update
+     */
+    void add_region(const BufferRegionRequest& region,
+                    int channels,
+                    BufferType type,
+                    const std::shared_ptr<uint8_t>& data_owner,
+                    uint8_t* data);
+
   private:
+    // Side of the regions of downsampled buffers, in samples
+    static const int region_size = 512;
+    // Maximum number of regions kept by each buffer. It must be larger than
+    // the number of regions in view
+    static const size_t max_cached_regions = 48;
+    // Maximum number of regions requested and not received yet
+    static const size_t max_requested_regions = 4;
+    static const uint64_t region_request_timeout_us = 5000000;
+
+    struct RegionKey
+    {
+        int step;
+        int index_x;
+        int index_y;
+
+        bool operator<(const RegionKey& other) const;
+    };
+
+    struct CachedRegion
+    {
+        BufferRegionRequest request;
+        int sampled_width;
+        int sampled_height;
+        GLuint texture;
+        std::shared_ptr<uint8_t> data_owner;
+        uint8_t* data;
+        uint64_t last_visible_us;
+    };
+
+    std::map<RegionKey, CachedRegion> regions_;
+    std::map<RegionKey, uint64_t> requested_regions_;
+
+    const CachedRegion* finest_region_at(int x, int y) const;
+
+    void draw_regions(const mat4& mvp);
+
+    void release_regions();
+
     void create_shader_program();
 
     void setup_gl_buffer();
 
+    void release_textures();
+
+    void get_texture_format(GLuint& tex_type,
+                            GLuint& tex_format,
+                            int& tex_type_size) const;
+
     void update_object_pose();
 
+    /**
+     * Compute the min and max values of each channel, for the channels the
+     * buffer has; the others are set to 0
+     */
+    void compute_min_max_color_values(float* lowest, float* upper) const;
+
     char pixel_layout_[4] = {'r', 'g', 'b', 'a'};
 
     float min_buffer_values_[4];
@@ -23,6 +23,8 @@
  * IN THE SOFTWARE.
  */
 
+#include <vector>
+
 #include <QFontMetrics>
 
 #include "buffer_values.h"
@@ -30,6 +32,7 @@
 #include "buffer.h"
 #include "camera.h"
 #include "math/assorted.h"
+#include "math/buffer_dispatch.h"
 #include "visualization/game_object.h"
 #include "visualization/stage.h"
 
@@ -54,34 +57,95 @@ int BufferValues::render_index() const
 }
 
 
-inline void pix2str(const Buffer::BufferType& type,
-                    const uint8_t* buffer,
-                    const int& pos,
-                    const int& channel,
-                    const int label_length,
-                    char* pix_label)
+static const int label_length = BufferValues::label_length;
+
+
+template <typename T>
+static void format_value(T value, char* label)
+{
+    snprintf(label, label_length, "%d", static_cast<int>(value));
+}
+
+
+static void format_value(int32_t value, char* label)
 {
-    if (type == Buffer::BufferType::Float32 ||
-        type == Buffer::BufferType::Float64) {
-        float fpix = reinterpret_cast<const float*>(buffer)[pos + channel];
-        snprintf(pix_label, label_length, "%.3f", fpix);
-        if (strlen(pix_label) > 7)
-            snprintf(pix_label, label_length, "%.3e", fpix);
-    } else if (type == Buffer::BufferType::UnsignedByte) {
-        snprintf(pix_label, label_length, "%d", buffer[pos + channel]);
-    } else if (type == Buffer::BufferType::Short) {
-        short fpix = reinterpret_cast<const short*>(buffer)[pos + channel];
-        snprintf(pix_label, label_length, "%d", fpix);
-    } else if (type == Buffer::BufferType::UnsignedShort) {
-        unsigned short fpix =
-            reinterpret_cast<const unsigned short*>(buffer)[pos + channel];
-        snprintf(pix_label, label_length, "%d", fpix);
-    } else if (type == Buffer::BufferType::Int32) {
-        int fpix = reinterpret_cast<const int*>(buffer)[pos + channel];
-        snprintf(pix_label, label_length, "%d", fpix);
-        if (strlen(pix_label) > 7)
-            snprintf(pix_label, label_length, "%.3e", static_cast<float>(fpix));
+    snprintf(label, label_length, "%d", value);
+    if (strlen(label) > 7)
+        snprintf(label, label_length, "%.3e", static_cast<float>(value));
+}
+
+
+static void format_value(float value, char* label)
+{
+    snprintf(label, label_length, "%.3f", value);
+    if (strlen(label) > 7)
+        snprintf(label, label_length, "%.3e", value);
+}
+
+
+static void format_value(double value, char* label)
+{
+    format_value(static_cast<float>(value), label);
+}
+
+
+/**
+ * Format the values of the pixels [first_x, last_x) x [first_y, last_y) of a
+ * buffer into labels, label_length characters each, in the order in which
+ * they are drawn
+ */
+struct PixelLabelsKernel
+{
+    template <typename T, int Channels>
+    static void run(const uint8_t* buffer,
+                    int step,
+                    int first_x,
+                    int last_x,
+                    int first_y,
+                    int last_y,
+                    vector<char>& labels)
+    {
+        if (last_x <= first_x || last_y <= first_y) {
+            return;
+        }
+
+        labels.resize(static_cast<size_t>(last_x - first_x) *
+                      (last_y - first_y) * Channels * label_length);
+
+        const T* values = reinterpret_cast<const T*>(buffer);
+        char* label     = labels.data();
+
+        for (int y = first_y; y < last_y; ++y) {
+            for (int x = first_x; x < last_x; ++x) {
+                const T* pixel = values + (y * step + x) * Channels;
+
+                for (int c = 0; c < Channels; ++c) {
+                    format_value(pixel[c], label);
+                    label += label_length;
+                }
+            }
+        }
     }
+};
+
+
+void BufferValues::format_labels(const Buffer* buffer,
+                                 int first_x,
+                                 int last_x,
+                                 int first_y,
+                                 int last_y,
+                                 vector<char>& labels)
+{
+    // All labels are formatted at once, for the concrete value type
+    dispatch_buffer_type<PixelLabelsKernel>(buffer->get_stored_type(),
+                                            buffer->channels,
+                                            buffer->buffer,
+                                            buffer->step,
+                                            first_x,
+                                            last_x,
+                                            first_y,
+                                            last_y,
+                                            labels);
 }
 
 
@@ -96,12 +160,16 @@ void BufferValues::draw(const mat4& projection, const mat4& view_inv)
 
         Buffer* buffer_component =
             game_object_->get_component<Buffer>("buffer_component");
-        float buffer_width_f    = buffer_component->buffer_width_f;
-        float buffer_height_f   = buffer_component->buffer_height_f;
-        int step                = buffer_component->step;
-        int channels            = buffer_component->channels;
-        Buffer::BufferType type = buffer_component->type;
-        uint8_t* buffer         = buffer_component->buffer;
+
+        // The labels of a downsampled buffer would show the overview samples
+        // instead of the pixels drawn under them
+        if (buffer_component->downsample > 1) {
+            return;
+        }
+
+        float buffer_width_f  = buffer_component->buffer_width_f;
+        float buffer_height_f = buffer_component->buffer_height_f;
+        int channels          = buffer_component->channels;
 
         vec4 tl_ndc(-1, 1, 0, 1);
         vec4 br_ndc(1, -1, 0, 1);
@@ -134,10 +202,19 @@ void BufferValues::draw(const mat4& projection, const mat4& view_inv)
         int pos_center_x = -buffer_width_f / 2;
         int pos_center_y = -buffer_height_f / 2;
 
-        const int label_length = 30;
-        char pix_label[label_length];
+        const int first_x = lower_x - pos_center_x;
+        const int last_x  = upper_x - pos_center_x;
+        const int first_y = lower_y - pos_center_y;
+        const int last_y  = upper_y - pos_center_y;
+
+        vector<char> labels;
+        format_labels(
+            buffer_component, first_x, last_x, first_y, last_y, labels);
+        if (labels.empty()) {
+            return;
+        }
 
-        int pos;
+        const char* pix_label = labels.data();
         float y_off;
 
         // Offset for vertical channel position to account for padding
@@ -157,16 +234,12 @@ void BufferValues::draw(const mat4& projection, const mat4& view_inv)
             recenter_factors = {rfUp, rfDown, -rfDown, -rfUp};
         }
 
-        for (int y = lower_y - pos_center_y; y < upper_y - pos_center_y; ++y) {
-            for (int x = lower_x - pos_center_x; x < upper_x - pos_center_x;
-                 ++x) {
-                pos = (y * step + x) * channels;
-
+        for (int y = first_y; y < last_y; ++y) {
+            for (int x = first_x; x < last_x; ++x) {
                 for (int c = 0; c < channels; ++c) {
                     y_off = (0.5f * (channels - 1) - c) / channels -
                             recenter_factors[c];
 
-                    pix2str(type, buffer, pos, c, label_length, pix_label);
                     draw_text(projection,
                               view_inv,
                               buffer_pose,
@@ -175,6 +248,7 @@ void BufferValues::draw(const mat4& projection, const mat4& view_inv)
                               y + pos_center_y,
                               y_off,
                               channels);
+                    pix_label += label_length;
                 }
             }
         }
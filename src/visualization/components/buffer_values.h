@@ -27,12 +27,17 @@
 #define BUFFER_VALUES_H_
 
 #include <iostream>
+#include <vector>
 
 #include <QFont>
 
 #include "component.h"
 #include "ui/gl_text_renderer.h"
 
+
+class Buffer;
+
+
 class BufferValues : public Component
 {
   public:
@@ -49,6 +54,21 @@ class BufferValues : public Component
 
     virtual void draw(const mat4& projection, const mat4& view_inv);
 
+    // Length of the value labels, including the terminating null character
+    static const int label_length = 30;
+
+    /**
+     * Format the values of the pixels [first_x, last_x) x [first_y, last_y)
+     * of buffer into labels, label_length characters each: the channels of
+     * each pixel, for the pixels of each row, from the first row
+     */
+    static void format_labels(const Buffer* buffer,
+                              int first_x,
+                              int last_x,
+                              int first_y,
+                              int last_y,
+                              std::vector<char>& labels);
+
   private:
     float text_pixel_scale         = 1.0;
     static float constexpr padding = 0.125f; // Must be smaller than 0.5
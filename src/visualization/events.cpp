@@ -7,17 +7,21 @@
 
 
 std::set<int> KeyboardState::pressed_keys_;
+int KeyboardState::simulated_modifiers_ = 0;
 
 
 bool KeyboardState::is_modifier_key_pressed(ModifierKey key)
 {
+    const int modifiers =
+        QApplication::keyboardModifiers() | simulated_modifiers_;
+
     switch (key) {
     case ModifierKey::Alt:
-        return (QApplication::keyboardModifiers() & Qt::AltModifier) != 0;
+        return (modifiers & Qt::AltModifier) != 0;
     case ModifierKey::Control:
-        return (QApplication::keyboardModifiers() & Qt::ControlModifier) != 0;
+        return (modifiers & Qt::ControlModifier) != 0;
     case ModifierKey::Shift:
-        return (QApplication::keyboardModifiers() & Qt::ShiftModifier) != 0;
+        return (modifiers & Qt::ShiftModifier) != 0;
     default:
         assert(!"Invalid modifier key");
         return false;
@@ -30,12 +30,14 @@
 
 enum class EventProcessCode { IGNORED, INTERCEPTED };
 
+class InteractionBenchmark;
 class MainWindow;
 class QEvent;
 
 class KeyboardState
 {
   public:
+    friend class InteractionBenchmark;
     friend class MainWindow;
 
     enum class ModifierKey { Control, Alt, Shift };
@@ -49,6 +51,9 @@ class KeyboardState
     static void update_keyboard_state(const QEvent* event);
 
     static std::set<int> pressed_keys_;
+
+    // Qt::KeyboardModifiers held by synthetic input (see InteractionBenchmark)
+    static int simulated_modifiers_;
 };
 
 #endif // EVENTS_H_
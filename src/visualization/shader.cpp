@@ -27,6 +27,8 @@
 
 #include "shader.h"
 
+#include "profiling/metrics.h"
+
 
 ShaderProgram::ShaderProgram(GLCanvas* gl_canvas)
     : program_(0)
@@ -78,12 +80,15 @@ bool ShaderProgram::create(const char* v_source,
     if (program_ != 0) {
         // Check if the program needs to be recompiled
         if (!is_shader_outdated(texel_format, uniforms, pixel_layout)) {
+            Metrics::record_cache_access("shader_program", true);
             return true;
         }
         // Delete old program
         gl_canvas_->glDeleteProgram(program_);
     }
 
+    Metrics::record_cache_access("shader_program", false);
+
     texel_format_ = texel_format;
     memcpy(pixel_layout_, pixel_layout, 4);
     pixel_layout_[4]       = '\0';
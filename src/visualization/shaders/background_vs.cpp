@@ -30,8 +30,13 @@ const char* background_vert_shader = R"(
 
 attribute vec2 input_position;
 
+// Rectangle (left, bottom, right, top) covered by the square, in normalized
+// device coordinates
+uniform vec4 ndc_rect;
+
 void main(void) {
-    gl_Position = vec4(input_position, 0.0, 1.0);
+    vec2 corner = input_position * 0.5 + 0.5;
+    gl_Position = vec4(mix(ndc_rect.xy, ndc_rect.zw, corner), 0.0, 1.0);
 }
 
 )";
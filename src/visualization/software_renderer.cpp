@@ -0,0 +1,514 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include <QPainter>
+
+#include "software_renderer.h"
+
+#include "concurrency/task_scheduler.h"
+#include "math/buffer_dispatch.h"
+#include "math/simd_dispatch.h"
+#include "profiling/tracer.h"
+#include "visualization/components/buffer.h"
+#include "visualization/components/buffer_values.h"
+#include "visualization/components/camera.h"
+#include "visualization/game_object.h"
+#include "visualization/stage.h"
+
+
+using namespace std;
+
+
+// Pixels of a row shaded at once
+static const int span_size = 256;
+// Rows of the image rendered by each block of parallel_for
+static const int rows_per_block = 16;
+// Side of the checkerboard tiles, in image pixels (see background_fs)
+static const int checkerboard_tile_size = 10;
+// Zoom above which the pixel borders and values are drawn (see
+// Buffer::update() and BufferValues::draw())
+static const float details_zoom = 40.f;
+// Margin of the value labels within their pixel, relative to its size
+static const float label_padding = 0.125f;
+
+
+/**
+ * Mapping of the image pixels to the buffer pixels, and parameters of the
+ * shading of a frame
+ */
+struct FrameParameters
+{
+    const Buffer* buffer;
+    Buffer::BufferType type;
+    int buffer_width;
+    int buffer_height;
+
+    int image_width;
+    int image_height;
+    uint8_t* image_bits;
+    int image_bytes_per_line;
+
+    // Buffer coordinates, in pixels from its first pixel, of the center of
+    // the image pixel (0, 0), and their increments from one image pixel to
+    // the next along its rows and along its columns
+    float origin_x;
+    float origin_y;
+    float row_delta_x;
+    float row_delta_y;
+    float column_delta_x;
+    float column_delta_y;
+
+    // Buffer channel shown in each output channel (red, green, blue and
+    // alpha), or -1 for constant channels, and their scale, offset and
+    // border scale (see SimdKernels::shade_pixels)
+    int source_channels[4];
+    float scale[4];
+    float offset[4];
+    float border_scale[4];
+
+    bool borders;
+    // Width of the image pixels, in buffer pixels
+    float border_width;
+};
+
+
+/**
+ * Copy the values of the count buffer pixels (pixels_x[i], pixels_y[i]) to
+ * planes of span_size values per channel
+ */
+struct GatherKernel
+{
+    template <typename T, int Channels>
+    static void run(const uint8_t* buffer,
+                    int step,
+                    const int* pixels_x,
+                    const int* pixels_y,
+                    int count,
+                    float* planes)
+    {
+        const T* values = reinterpret_cast<const T*>(buffer);
+        // Integer values are normalized as in the OpenGL textures
+        const float normalization = 1.f / get_max_intensity<T>();
+
+        for (int i = 0; i < count; ++i) {
+            const T* pixel =
+                values +
+                (static_cast<size_t>(pixels_y[i]) * step + pixels_x[i]) *
+                    Channels;
+
+            for (int c = 0; c < Channels; ++c) {
+                planes[c * span_size + i] =
+                    static_cast<float>(pixel[c]) * normalization;
+            }
+        }
+    }
+};
+
+
+static int get_color_component(char layout_component)
+{
+    switch (layout_component) {
+    case 'r':
+        return 0;
+    case 'g':
+        return 1;
+    case 'b':
+        return 2;
+    default:
+        return 3;
+    }
+}
+
+
+// Narrow [first, last) to the pixels x of an image row whose buffer
+// coordinate origin + x * delta is in [0, size). Empty ranges become [0, 0)
+static void clip_to_buffer(float origin,
+                           float delta,
+                           float size,
+                           int& first,
+                           int& last)
+{
+    if (delta == 0.f) {
+        if (origin < 0.f || origin >= size) {
+            first = last = 0;
+        }
+        return;
+    }
+
+    float begin = -origin / delta;
+    float end   = (size - origin) / delta;
+    if (delta < 0.f) {
+        swap(begin, end);
+    }
+
+    // Pixels far out of the row are clamped before the conversion to int
+    const float row_end = static_cast<float>(last);
+    first = max(first, static_cast<int>(ceilf(min(max(begin, 0.f), row_end))));
+    last  = min(last, static_cast<int>(ceilf(min(max(end, 0.f), row_end))));
+
+    if (first >= last) {
+        first = last = 0;
+    }
+}
+
+
+// Intensity added at a buffer coordinate by the borders between pixels,
+// computed as in buffer_fs
+static float get_border(float position, float width)
+{
+    const float fraction = position - floorf(position);
+    const float border =
+        fabsf((0.5f - fraction) / width) - (0.5f / width - 1.f);
+    return min(max(border, 0.f), 1.f);
+}
+
+
+static uint32_t pack_gray(float intensity)
+{
+    const uint32_t level = static_cast<uint32_t>(intensity);
+    return 0xff000000u | level << 16 | level << 8 | level;
+}
+
+
+static void render_rows(const FrameParameters& frame,
+                        int first_row,
+                        int last_row)
+{
+    const SimdKernels& kernels = get_simd_kernels();
+
+    // Rows of the checkerboard, which is aligned to gl_FragCoord, for even
+    // and odd rows of tiles
+    vector<float> checkerboard_rows[2];
+    for (int parity = 0; parity < 2; ++parity) {
+        checkerboard_rows[parity].resize(frame.image_width);
+        for (int x = 0; x < frame.image_width; ++x) {
+            const int tile_x = x / checkerboard_tile_size;
+            checkerboard_rows[parity][x] =
+                (tile_x + parity) % 2 == 1 ? 153.f : 102.f;
+        }
+    }
+
+    vector<float> planes(4 * span_size);
+    vector<float> zeros(span_size, 0.f);
+    vector<float> borders(span_size);
+    vector<int> pixels_x(span_size);
+    vector<int> pixels_y(span_size);
+
+    const float* output_planes[4];
+    for (int c = 0; c < 4; ++c) {
+        const int source = frame.source_channels[c];
+        output_planes[c] =
+            source < 0 ? zeros.data() : planes.data() + source * span_size;
+    }
+
+    for (int y = first_row; y < last_row; ++y) {
+        uint32_t* row = reinterpret_cast<uint32_t*>(
+            frame.image_bits + static_cast<size_t>(y) *
+                                   frame.image_bytes_per_line);
+
+        // gl_FragCoord counts the rows from the bottom
+        const int tile_y =
+            (frame.image_height - 1 - y) / checkerboard_tile_size;
+        const float* background = checkerboard_rows[tile_y % 2].data();
+
+        const float row_x = frame.origin_x + y * frame.column_delta_x;
+        const float row_y = frame.origin_y + y * frame.column_delta_y;
+
+        int first = 0;
+        int last  = frame.image_width;
+        clip_to_buffer(
+            row_x, frame.row_delta_x, frame.buffer_width, first, last);
+        clip_to_buffer(
+            row_y, frame.row_delta_y, frame.buffer_height, first, last);
+
+        for (int x = 0; x < first; ++x) {
+            row[x] = pack_gray(background[x]);
+        }
+        for (int x = last; x < frame.image_width; ++x) {
+            row[x] = pack_gray(background[x]);
+        }
+
+        for (int span_x = first; span_x < last; span_x += span_size) {
+            const int count = min(span_size, last - span_x);
+
+            // Clamped against rounding errors at the buffer edges
+            kernels.nearest_pixels(row_x + span_x * frame.row_delta_x,
+                                   row_y + span_x * frame.row_delta_y,
+                                   frame.row_delta_x,
+                                   frame.row_delta_y,
+                                   frame.buffer_width,
+                                   frame.buffer_height,
+                                   count,
+                                   pixels_x.data(),
+                                   pixels_y.data());
+
+            if (frame.borders) {
+                for (int i = 0; i < count; ++i) {
+                    const float buffer_x =
+                        row_x + (span_x + i) * frame.row_delta_x;
+                    const float buffer_y =
+                        row_y + (span_x + i) * frame.row_delta_y;
+                    borders[i] = get_border(buffer_x, frame.border_width) +
+                                 get_border(buffer_y, frame.border_width);
+                }
+            }
+
+            dispatch_buffer_type<GatherKernel>(frame.type,
+                                               frame.buffer->channels,
+                                               frame.buffer->buffer,
+                                               frame.buffer->step,
+                                               pixels_x.data(),
+                                               pixels_y.data(),
+                                               count,
+                                               planes.data());
+
+            kernels.shade_pixels(output_planes,
+                                 frame.scale,
+                                 frame.offset,
+                                 frame.borders ? borders.data() : nullptr,
+                                 frame.border_scale,
+                                 background + span_x,
+                                 count,
+                                 row + span_x);
+        }
+    }
+}
+
+
+// Draw the values of the visible buffer pixels over them, as BufferValues
+static void draw_labels(const Buffer* buffer, const mat4& mvp, QImage& image)
+{
+    // The labels of a downsampled buffer would show the overview samples
+    // instead of the pixels drawn under them
+    if (buffer->downsample > 1) {
+        return;
+    }
+
+    const int buffer_width  = static_cast<int>(buffer->buffer_width_f);
+    const int buffer_height = static_cast<int>(buffer->buffer_height_f);
+    const vec4 buffer_origin(
+        -buffer->buffer_width_f / 2.f, -buffer->buffer_height_f / 2.f, 0, 0);
+
+    // Since the view may be rotated, the visible pixels are those in the
+    // bounding box of the corners of the image
+    const mat4 mvp_inv       = mvp.inv();
+    const vec4 ndc_corners[] = {vec4(-1, -1, 0, 1),
+                                vec4(1, -1, 0, 1),
+                                vec4(1, 1, 0, 1),
+                                vec4(-1, 1, 0, 1)};
+    float lower_x = buffer_width, lower_y = buffer_height;
+    float upper_x = 0.f, upper_y = 0.f;
+    for (const auto& ndc_corner : ndc_corners) {
+        const vec4 corner = mvp_inv * ndc_corner - buffer_origin;
+        lower_x           = min(lower_x, corner.x());
+        lower_y           = min(lower_y, corner.y());
+        upper_x           = max(upper_x, corner.x());
+        upper_y           = max(upper_y, corner.y());
+    }
+
+    const int first_x = max(0, static_cast<int>(floorf(lower_x)));
+    const int last_x  = min(buffer_width, static_cast<int>(ceilf(upper_x)));
+    const int first_y = max(0, static_cast<int>(floorf(lower_y)));
+    const int last_y  = min(buffer_height, static_cast<int>(ceilf(upper_y)));
+
+    vector<char> labels;
+    BufferValues::format_labels(
+        buffer, first_x, last_x, first_y, last_y, labels);
+    if (labels.empty()) {
+        return;
+    }
+
+    const int channels   = buffer->channels;
+    const int num_labels = static_cast<int>(labels.size()) /
+                           BufferValues::label_length;
+
+    // The font is sized so that the longest label fits in its pixel
+    const char* longest_label = labels.data();
+    for (int i = 1; i < num_labels; ++i) {
+        const char* label = labels.data() + i * BufferValues::label_length;
+        if (strlen(label) > strlen(longest_label)) {
+            longest_label = label;
+        }
+    }
+
+    const vec4 pixel_extent_ndc = mvp * vec4(1, 0, 0, 0);
+    const float zoom = hypotf(pixel_extent_ndc.x() * image.width() / 2.f,
+                              pixel_extent_ndc.y() * image.height() / 2.f);
+    const float label_width  = zoom * (1.f - 2.f * label_padding);
+    const float label_height = label_width / channels;
+
+    QPainter painter(&image);
+    QFont font = painter.font();
+    font.setPixelSize(max(1, static_cast<int>(label_height)));
+
+    const float longest_width =
+        QFontMetricsF(font).boundingRect(longest_label).width();
+    if (longest_width > label_width) {
+        font.setPixelSize(max(
+            1, static_cast<int>(label_height * label_width / longest_width)));
+    }
+    painter.setFont(font);
+
+    const char* label = labels.data();
+
+    for (int y = first_y; y < last_y; ++y) {
+        for (int x = first_x; x < last_x; ++x) {
+            const vec4 center_ndc =
+                mvp * (vec4(x + 0.5f, y + 0.5f, 0, 1) + buffer_origin);
+            const float center_x = (center_ndc.x() + 1.f) / 2.f *
+                                   image.width();
+            const float center_y = (1.f - center_ndc.y()) / 2.f *
+                                   image.height();
+
+            // The text is black over bright pixels, and white otherwise
+            const int sample_x =
+                min(max(static_cast<int>(center_x), 0), image.width() - 1);
+            const int sample_y =
+                min(max(static_cast<int>(center_y), 0), image.height() - 1);
+            painter.setPen(qGray(image.pixel(sample_x, sample_y)) > 127
+                               ? Qt::black
+                               : Qt::white);
+
+            for (int c = 0; c < channels; ++c) {
+                const float line_y =
+                    center_y + (c - 0.5f * (channels - 1)) * label_height;
+
+                painter.drawText(QRectF(center_x - zoom / 2.f,
+                                        line_y - label_height / 2.f,
+                                        zoom,
+                                        label_height),
+                                 Qt::AlignCenter,
+                                 QString(label));
+                label += BufferValues::label_length;
+            }
+        }
+    }
+}
+
+
+void SoftwareRenderer::render(Stage* stage, QImage& image)
+{
+    GIW_TRACE_SCOPE("software_render");
+
+    GameObject* camera_obj = stage->get_game_object("camera");
+    GameObject* buffer_obj = stage->get_game_object("buffer");
+    Camera* camera = camera_obj->get_component<Camera>("camera_component");
+    Buffer* buffer = buffer_obj->get_component<Buffer>("buffer_component");
+
+    if (camera == nullptr || buffer == nullptr || image.isNull()) {
+        return;
+    }
+
+    const mat4 mvp = camera->projection * camera_obj->get_pose().inv() *
+                     buffer_obj->get_pose();
+    const mat4 mvp_inv = mvp.inv();
+
+    FrameParameters frame;
+    frame.buffer        = buffer;
+    frame.type          = buffer->get_stored_type();
+    frame.buffer_width  = static_cast<int>(buffer->buffer_width_f);
+    frame.buffer_height = static_cast<int>(buffer->buffer_height_f);
+
+    frame.image_width  = image.width();
+    frame.image_height = image.height();
+    // Detaches the image, if shared, before the rows are written in parallel
+    frame.image_bits           = image.bits();
+    frame.image_bytes_per_line = image.bytesPerLine();
+
+    // Buffer coordinates of the center of an image pixel
+    const vec4 buffer_origin(
+        buffer->buffer_width_f / 2.f, buffer->buffer_height_f / 2.f, 0, 0);
+    const auto to_buffer = [&](float x, float y) {
+        const vec4 ndc(2.f * (x + 0.5f) / frame.image_width - 1.f,
+                       1.f - 2.f * (y + 0.5f) / frame.image_height,
+                       0,
+                       1);
+        return mvp_inv * ndc + buffer_origin;
+    };
+
+    // The view transform is affine, so the buffer coordinates change by a
+    // constant amount from one image pixel to the next
+    const vec4 origin       = to_buffer(0, 0);
+    const vec4 row_delta    = to_buffer(1, 0) - origin;
+    const vec4 column_delta = to_buffer(0, 1) - origin;
+    frame.origin_x          = origin.x();
+    frame.origin_y          = origin.y();
+    frame.row_delta_x       = row_delta.x();
+    frame.row_delta_y       = row_delta.y();
+    frame.column_delta_x    = column_delta.x();
+    frame.column_delta_y    = column_delta.y();
+
+    // Output channels are picked from the color computed by buffer_fs as
+    // specified by the pixel layout
+    const float* contrast_brightness =
+        stage->contrast_enabled ? buffer->auto_buffer_contrast_brightness()
+                                : Buffer::no_ac_params;
+    const char* pixel_layout = buffer->get_pixel_layout();
+
+    for (int c = 0; c < 4; ++c) {
+        const int component = get_color_component(pixel_layout[c]);
+
+        if (component < buffer->channels ||
+            (buffer->channels == 1 && component < 3)) {
+            // Grayscale buffers are shown in the red, green and blue
+            // components
+            const int source         = buffer->channels == 1 ? 0 : component;
+            frame.source_channels[c] = source;
+            frame.scale[c]           = contrast_brightness[source] * 255.f;
+            frame.offset[c] = contrast_brightness[4 + source] * 255.f;
+        } else {
+            // Missing blue components are 0, and missing alphas 1
+            frame.source_channels[c] = -1;
+            frame.scale[c]           = 0.f;
+            frame.offset[c]          = component == 3 ? 255.f : 0.f;
+        }
+
+        // Borders are added to the red, green and blue components
+        frame.border_scale[c] = component < 3 ? 255.f : 0.f;
+    }
+
+    const float zoom   = camera->compute_zoom();
+    frame.borders      = zoom > details_zoom;
+    frame.border_width = max(fabsf(frame.row_delta_x),
+                             fabsf(frame.row_delta_y));
+
+    const int num_blocks =
+        (frame.image_height + rows_per_block - 1) / rows_per_block;
+    TaskScheduler::instance().parallel_for(num_blocks, [&](int block) {
+        const int first_row = block * rows_per_block;
+        render_rows(frame,
+                    first_row,
+                    min(first_row + rows_per_block, frame.image_height));
+    });
+
+    if (zoom > details_zoom) {
+        draw_labels(buffer, mvp, image);
+    }
+}
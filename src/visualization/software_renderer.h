@@ -0,0 +1,53 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 GDB ImageWatch contributors
+ * (github.com/csantosbh/gdb-imagewatch/)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef SOFTWARE_RENDERER_H_
+#define SOFTWARE_RENDERER_H_
+
+#include <QImage>
+
+
+class Stage;
+
+
+/**
+ * CPU fallback of the OpenGL rendering of the stages, for systems whose
+ * OpenGL implementation is missing features or is a software rasterizer
+ * itself (see GLCanvas::Renderer). It draws the checkerboard background, the
+ * buffer, the pixel borders and the pixel values as the stage components do,
+ * sampling the buffer at the nearest pixel. The rows of the image are shaded
+ * in parallel by the TaskScheduler workers, with the shade_pixels SIMD kernel.
+ */
+class SoftwareRenderer
+{
+  public:
+    /**
+     * Render the stage, as seen by its camera, into image, which must have
+     * the size of the camera viewport and the format QImage::Format_RGB32
+     */
+    static void render(Stage* stage, QImage& image);
+};
+
+#endif // SOFTWARE_RENDERER_H_
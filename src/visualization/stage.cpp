@@ -28,10 +28,12 @@
 #include "stage.h"
 
 #include "game_object.h"
+#include "ui/gl_canvas.h"
 #include "ui/main_window/main_window.h"
 #include "visualization/components/background.h"
 #include "visualization/components/buffer_values.h"
 #include "visualization/components/camera.h"
+#include "visualization/software_renderer.h"
 
 
 using namespace std;
@@ -158,6 +160,38 @@ bool Stage::buffer_update(uint8_t* buffer,
 }
 
 
+bool Stage::buffer_update_rows(uint8_t* buffer,
+                               int buffer_width_i,
+                               int buffer_height_i,
+                               int channels,
+                               Buffer::BufferType type,
+                               int step,
+                               const string& pixel_layout,
+                               bool transpose_buffer,
+                               const vector<pair<int, int>>& dirty_rows)
+{
+    GameObject* buffer_obj = all_game_objects["buffer"].get();
+    Buffer* buffer_component =
+        buffer_obj->get_component<Buffer>("buffer_component");
+
+    if (!buffer_component->has_layout(buffer_width_i,
+                                      buffer_height_i,
+                                      channels,
+                                      type,
+                                      step,
+                                      transpose_buffer) ||
+        pixel_layout.compare(0, 4, buffer_component->get_pixel_layout(), 4) !=
+            0) {
+        return false;
+    }
+
+    buffer_component->buffer = buffer;
+    buffer_component->update_rows(dirty_rows);
+
+    return true;
+}
+
+
 GameObject* Stage::get_game_object(string tag)
 {
     if (all_game_objects.find(tag) == all_game_objects.end()) {
@@ -190,6 +224,12 @@ void Stage::draw()
     if (camera_component == nullptr)
         return;
 
+    GLCanvas* gl_canvas = main_window->gl_canvas();
+    if (gl_canvas->is_software_rendering()) {
+        SoftwareRenderer::render(this, gl_canvas->get_software_frame());
+        return;
+    }
+
     mat4 view_inv = camera_obj->get_pose().inv();
 
     for (const auto& game_obj : all_game_objects) {
@@ -261,5 +301,11 @@ void Stage::go_to_pixel(float x, float y)
     Camera* camera_component =
         cam_obj->get_component<Camera>("camera_component");
 
-    camera_component->move_to(x, y);
+    GameObject* buffer_obj = all_game_objects["buffer"].get();
+    Buffer* buffer_component =
+        buffer_obj->get_component<Buffer>("buffer_component");
+
+    const vec4 goal =
+        buffer_component->source_to_stage_coordinates(vec4(x, y, 0, 1));
+    camera_component->move_to(goal.x(), goal.y());
 }
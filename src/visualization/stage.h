@@ -62,6 +62,19 @@ class Stage
                        const std::string& pixel_layout,
                        bool transpose_buffer);
 
+    // Re-upload only the rows in dirty_rows. Returns false, without changing
+    // the stage, if the buffer layout differs from the current one; in this
+    // case, buffer_update() must be called instead
+    bool buffer_update_rows(uint8_t* buffer,
+                            int buffer_width_i,
+                            int buffer_height_i,
+                            int channels,
+                            Buffer::BufferType type,
+                            int step,
+                            const std::string& pixel_layout,
+                            bool transpose_buffer,
+                            const std::vector<std::pair<int, int>>& dirty_rows);
+
     GameObject* get_game_object(std::string tag);
 
     void update();
@@ -78,6 +91,10 @@ class Stage
 
     EventProcessCode key_press_event(int key_code);
 
+    /**
+     * Center the camera at pixel (x, y) of the buffer in the debuggee (see
+     * Buffer::source_to_stage_coordinates)
+     */
     void go_to_pixel(float x, float y);
 
   private:
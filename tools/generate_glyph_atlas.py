@@ -0,0 +1,501 @@
+#!/usr/bin/python3
+
+# -*- coding: utf-8 -*-
+
+"""
+Generates src/ui/glyph_atlas.cpp, the font atlas used by GLTextRenderer to
+draw pixel values, so that no font has to be rasterized when a window is
+created. Only depends on the Python standard library: the glyphs are read
+from a TrueType font file and rasterized with a small scanline rasterizer.
+
+Usage: generate_glyph_atlas.py FONT.ttf [OUTPUT.cpp]
+
+The committed atlas was generated from DejaVu Serif, the font that
+fontconfig substitutes for "Times New Roman" on most Linux distributions.
+"""
+
+import argparse
+import struct
+
+# Characters required for numbers, scientific notation (e), nan and inf. Must
+# match the characters drawn by BufferValues
+ATLAS_CHARACTERS = '0123456789., -+enaif'
+# Font size in pixels (96 points at 96 DPI)
+FONT_PIXEL_SIZE = 96.0 * 96.0 / 72.0
+# Vertical and horizontal samples per pixel
+SUPERSAMPLING = 4
+# Segments used to approximate each quadratic curve
+CURVE_SEGMENTS = 8
+
+
+class TrueTypeFont():
+    """
+    Minimal TrueType reader: character map, horizontal metrics and glyph
+    outlines
+    """
+    def __init__(self, path):
+        with open(path, 'rb') as font_file:
+            self._data = font_file.read()
+
+        num_tables = struct.unpack_from('>H', self._data, 4)[0]
+        self._tables = {}
+        for idx in range(num_tables):
+            tag, _, offset, length = struct.unpack_from(
+                '>4sIII', self._data, 12 + 16 * idx)
+            self._tables[tag.decode('ascii')] = (offset, length)
+
+        head = self._tables['head'][0]
+        self.units_per_em = struct.unpack_from('>H', self._data, head + 18)[0]
+        self._index_to_loc_format = struct.unpack_from(
+            '>h', self._data, head + 50)[0]
+
+        hhea = self._tables['hhea'][0]
+        self.ascender, self.descender = struct.unpack_from(
+            '>hh', self._data, hhea + 4)
+        self._num_h_metrics = struct.unpack_from(
+            '>H', self._data, hhea + 34)[0]
+
+        self._cmap = self._read_cmap()
+
+    def glyph_index(self, character):
+        return self._cmap.get(ord(character), 0)
+
+    def advance_width(self, glyph):
+        hmtx = self._tables['hmtx'][0]
+        glyph = min(glyph, self._num_h_metrics - 1)
+        return struct.unpack_from('>H', self._data, hmtx + 4 * glyph)[0]
+
+    def contours(self, glyph):
+        """
+        List of contours of 'glyph', each one a list of (x, y, on_curve)
+        points in font units
+        """
+        offset, length = self._glyph_location(glyph)
+        if length == 0:
+            return []
+
+        num_contours = struct.unpack_from('>h', self._data, offset)[0]
+        if num_contours >= 0:
+            return self._simple_contours(offset, num_contours)
+
+        return self._composite_contours(offset)
+
+    def _read_cmap(self):
+        cmap = self._tables['cmap'][0]
+        num_subtables = struct.unpack_from('>H', self._data, cmap + 2)[0]
+
+        for idx in range(num_subtables):
+            platform, encoding, offset = struct.unpack_from(
+                '>HHI', self._data, cmap + 4 + 8 * idx)
+            subtable = cmap + offset
+            if (platform, encoding) in [(3, 1), (0, 3)] and struct.unpack_from(
+                    '>H', self._data, subtable)[0] == 4:
+                return self._read_cmap_format4(subtable)
+
+        raise Exception('Font has no unicode BMP character map')
+
+    def _read_cmap_format4(self, subtable):
+        seg_count = struct.unpack_from('>H', self._data, subtable + 6)[0] // 2
+        end_codes = subtable + 14
+        start_codes = end_codes + 2 * seg_count + 2
+        id_deltas = start_codes + 2 * seg_count
+        id_range_offsets = id_deltas + 2 * seg_count
+
+        mapping = {}
+        for seg in range(seg_count):
+            end, = struct.unpack_from('>H', self._data, end_codes + 2 * seg)
+            start, = struct.unpack_from('>H', self._data,
+                                        start_codes + 2 * seg)
+            delta, = struct.unpack_from('>h', self._data, id_deltas + 2 * seg)
+            range_offset_pos = id_range_offsets + 2 * seg
+            range_offset, = struct.unpack_from('>H', self._data,
+                                               range_offset_pos)
+
+            for code in range(start, min(end, 0x7f) + 1):
+                if range_offset == 0:
+                    glyph = (code + delta) & 0xffff
+                else:
+                    glyph, = struct.unpack_from(
+                        '>H', self._data,
+                        range_offset_pos + range_offset + 2 * (code - start))
+                    if glyph != 0:
+                        glyph = (glyph + delta) & 0xffff
+                mapping[code] = glyph
+
+        return mapping
+
+    def _glyph_location(self, glyph):
+        loca = self._tables['loca'][0]
+        if self._index_to_loc_format == 0:
+            begin, end = struct.unpack_from('>HH', self._data,
+                                            loca + 2 * glyph)
+            begin, end = 2 * begin, 2 * end
+        else:
+            begin, end = struct.unpack_from('>II', self._data,
+                                            loca + 4 * glyph)
+
+        return self._tables['glyf'][0] + begin, end - begin
+
+    def _simple_contours(self, offset, num_contours):
+        pos = offset + 10
+        end_points = struct.unpack_from('>%dH' % num_contours, self._data, pos)
+        pos += 2 * num_contours
+        num_points = end_points[-1] + 1 if num_contours > 0 else 0
+
+        instructions_length, = struct.unpack_from('>H', self._data, pos)
+        pos += 2 + instructions_length
+
+        flags = []
+        while len(flags) < num_points:
+            flag = self._data[pos]
+            pos += 1
+            flags.append(flag)
+            if flag & 8:
+                repeat = self._data[pos]
+                pos += 1
+                flags.extend([flag] * repeat)
+
+        coordinates = []
+        for short_bit, same_bit in [(2, 16), (4, 32)]:
+            value = 0
+            values = []
+            for flag in flags:
+                if flag & short_bit:
+                    delta = self._data[pos]
+                    pos += 1
+                    value += delta if flag & same_bit else -delta
+                elif not flag & same_bit:
+                    value += struct.unpack_from('>h', self._data, pos)[0]
+                    pos += 2
+                values.append(value)
+            coordinates.append(values)
+
+        contours = []
+        first = 0
+        for last in end_points:
+            contours.append([(coordinates[0][idx],
+                              coordinates[1][idx],
+                              bool(flags[idx] & 1))
+                             for idx in range(first, last + 1)])
+            first = last + 1
+
+        return contours
+
+    def _composite_contours(self, offset):
+        pos = offset + 10
+        contours = []
+
+        while True:
+            flags, glyph = struct.unpack_from('>HH', self._data, pos)
+            pos += 4
+            if flags & 1:
+                dx, dy = struct.unpack_from('>hh', self._data, pos)
+                pos += 4
+            else:
+                dx, dy = struct.unpack_from('>bb', self._data, pos)
+                pos += 2
+            # Scaled components are not used by the atlas characters
+            if flags & 8:
+                pos += 2
+            elif flags & 0x40:
+                pos += 4
+            elif flags & 0x80:
+                pos += 8
+
+            for contour in self.contours(glyph):
+                contours.append([(x + dx, y + dy, on_curve)
+                                 for x, y, on_curve in contour])
+
+            if not flags & 0x20:
+                return contours
+
+
+def _flatten_contour(contour):
+    """
+    Convert a contour with quadratic curves into a closed polygon
+    """
+    # Make the contour start with an on-curve point, inserting the implied
+    # midpoint between two consecutive off-curve points if necessary
+    if not contour[0][2]:
+        if contour[-1][2]:
+            contour = contour[-1:] + contour[:-1]
+        else:
+            mid = ((contour[0][0] + contour[-1][0]) / 2.0,
+                   (contour[0][1] + contour[-1][1]) / 2.0,
+                   True)
+            contour = [mid] + contour
+
+    polygon = [contour[0][:2]]
+    control = None
+    for x, y, on_curve in contour[1:] + contour[:1]:
+        if on_curve:
+            if control is None:
+                polygon.append((x, y))
+            else:
+                polygon.extend(_quadratic_points(polygon[-1], control, (x, y)))
+                control = None
+        elif control is None:
+            control = (x, y)
+        else:
+            mid = ((control[0] + x) / 2.0, (control[1] + y) / 2.0)
+            polygon.extend(_quadratic_points(polygon[-1], control, mid))
+            control = (x, y)
+
+    return polygon
+
+
+def _quadratic_points(begin, control, end):
+    points = []
+    for step in range(1, CURVE_SEGMENTS + 1):
+        t = step / float(CURVE_SEGMENTS)
+        u = 1.0 - t
+        points.append(tuple(u * u * begin[axis] +
+                            2 * u * t * control[axis] +
+                            t * t * end[axis] for axis in range(2)))
+    return points
+
+
+def _rasterize(polygons, width, height):
+    """
+    Rasterize polygons (in pixel coordinates, y pointing down) with the
+    nonzero winding rule. Returns a list of rows of coverage values in [0, 1].
+    """
+    edges = []
+    for polygon in polygons:
+        for idx, begin in enumerate(polygon):
+            end = polygon[(idx + 1) % len(polygon)]
+            if begin[1] != end[1]:
+                edges.append((begin, end))
+
+    image = [[0.0] * width for _ in range(height)]
+    sample_weight = 1.0 / SUPERSAMPLING
+
+    for row in range(height):
+        for sub_row in range(SUPERSAMPLING):
+            y = row + (sub_row + 0.5) / SUPERSAMPLING
+            crossings = []
+            for begin, end in edges:
+                if (begin[1] <= y < end[1]) or (end[1] <= y < begin[1]):
+                    t = (y - begin[1]) / (end[1] - begin[1])
+                    winding = 1 if end[1] > begin[1] else -1
+                    crossings.append((begin[0] + t * (end[0] - begin[0]),
+                                      winding))
+            crossings.sort()
+
+            winding = 0
+            for idx, (x, direction) in enumerate(crossings[:-1]):
+                winding += direction
+                if winding != 0:
+                    _fill_span(image[row], x, crossings[idx + 1][0],
+                               sample_weight)
+
+    return image
+
+
+def _fill_span(row, begin, end, weight):
+    """
+    Add the horizontal coverage of [begin, end) to the pixels of 'row'
+    """
+    begin = max(begin, 0.0)
+    end = min(end, float(len(row)))
+    pixel = int(begin)
+    while pixel < end:
+        covered = min(end, pixel + 1.0) - max(begin, float(pixel))
+        row[pixel] += covered * weight
+        pixel += 1
+
+
+def _next_power_of_two(value):
+    power = 1
+    while power < value:
+        power *= 2
+    return power
+
+
+def build_atlas(font):
+    """
+    Rasterize ATLAS_CHARACTERS side by side, with the same layout and metrics
+    as the ones computed by QFontMetrics/QPainter in the previous runtime
+    implementation. Returns the atlas and the per-character metrics.
+    """
+    scale = FONT_PIXEL_SIZE / font.units_per_em
+    ascent = int(round(font.ascender * scale))
+    descent = int(round(-font.descender * scale))
+    line_height = ascent + descent
+
+    glyphs = [font.glyph_index(char) for char in ATLAS_CHARACTERS]
+    advances = [int(round(font.advance_width(glyph) * scale))
+                for glyph in glyphs]
+
+    bitmap_width = sum(advances)
+    bitmap_height = line_height
+    texture_width = _next_power_of_two(bitmap_width)
+    texture_height = _next_power_of_two(bitmap_height)
+
+    polygons = []
+    pen_x = 0
+    for glyph, advance in zip(glyphs, advances):
+        for contour in font.contours(glyph):
+            polygons.append([(pen_x + x * scale, ascent - y * scale)
+                             for x, y in _flatten_contour(contour)])
+        pen_x += advance
+
+    coverage = _rasterize(polygons, bitmap_width, bitmap_height)
+
+    pixels = bytearray(texture_width * texture_height)
+    for y, row in enumerate(coverage):
+        for x, value in enumerate(row):
+            pixels[y * texture_width + x] = min(255, int(value * 255 + 0.5))
+
+    # Crop the empty rows above and below the glyphs, as the runtime
+    # implementation did
+    real_ascent = bitmap_height - 1
+    real_descent = 0
+    found_real_descent = False
+    found_real_ascent = False
+    for y in range(bitmap_height):
+        row = pixels[y * texture_width:y * texture_width + bitmap_width]
+        if not any(row):
+            if not found_real_descent:
+                real_descent = y
+            elif not found_real_ascent:
+                real_ascent = y
+                found_real_ascent = True
+        else:
+            found_real_descent = True
+
+    cropped_height = real_ascent - real_descent
+
+    metrics = []
+    offset_x = 0
+    for char, advance in zip(ATLAS_CHARACTERS, advances):
+        metrics.append({'character': char,
+                        'offset': (offset_x, real_descent),
+                        'advance': (advance, 0),
+                        'size': (advance, cropped_height),
+                        'tl': (0, cropped_height)})
+        offset_x += advance
+
+    return texture_width, texture_height, pixels, metrics
+
+
+def compress(pixels):
+    """
+    Run-length encode the runs of zeros: a zero byte is followed by the length
+    of the run (1 to 255); other bytes are stored as they are
+    """
+    compressed = bytearray()
+    idx = 0
+    while idx < len(pixels):
+        if pixels[idx] != 0:
+            compressed.append(pixels[idx])
+            idx += 1
+            continue
+
+        run = 1
+        while (idx + run < len(pixels) and pixels[idx + run] == 0 and
+               run < 255):
+            run += 1
+        compressed.extend([0, run])
+        idx += run
+
+    return compressed
+
+
+def _format_bytes(data, indent='    ', per_line=16):
+    lines = []
+    for begin in range(0, len(data), per_line):
+        lines.append(indent + ', '.join(
+            '%d' % value for value in data[begin:begin + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def _format_metric(metrics, key):
+    return '\n'.join('    {%d, %d}, // %r' % (metric[key][0],
+                                             metric[key][1],
+                                             metric['character'])
+                     for metric in metrics)
+
+
+def write_source(output_path, license_header, atlas):
+    texture_width, texture_height, pixels, metrics = atlas
+    compressed = compress(pixels)
+
+    with open(output_path, 'w') as output:
+        output.write(license_header)
+        output.write('''
+// Generated by tools/generate_glyph_atlas.py. Do not edit.
+
+#include "glyph_atlas.h"
+
+
+namespace glyph_atlas
+{
+
+const char characters[] = "%s";
+
+const int texture_width  = %d;
+const int texture_height = %d;
+
+const int offsets[num_characters][2] = {
+%s
+};
+
+const int advances[num_characters][2] = {
+%s
+};
+
+const int sizes[num_characters][2] = {
+%s
+};
+
+const int tls[num_characters][2] = {
+%s
+};
+
+const size_t compressed_texture_size = %d;
+
+const uint8_t compressed_texture[] = {
+%s
+};
+
+} // namespace glyph_atlas
+''' % (ATLAS_CHARACTERS,
+       texture_width,
+       texture_height,
+       _format_metric(metrics, 'offset'),
+       _format_metric(metrics, 'advance'),
+       _format_metric(metrics, 'size'),
+       _format_metric(metrics, 'tl'),
+       len(compressed),
+       _format_bytes(compressed)))
+
+
+def _read_license_header(output_path):
+    """
+    Keep the license header of the file being regenerated
+    """
+    try:
+        with open(output_path) as previous:
+            contents = previous.read()
+        end = contents.index('*/') + 3
+        return contents[:end]
+    except (IOError, ValueError):
+        return ''
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('font', help='TrueType font file')
+    parser.add_argument('output',
+                        nargs='?',
+                        default='src/ui/glyph_atlas.cpp',
+                        help='Generated source file')
+    args = parser.parse_args()
+
+    atlas = build_atlas(TrueTypeFont(args.font))
+    write_source(args.output, _read_license_header(args.output), atlas)
+
+
+if __name__ == '__main__':
+    main()